@@ -0,0 +1,361 @@
+#include <QtCore>
+#include <numeric>
+#include "AccountManager.h"
+#include "Config.h"
+#include "log.h"
+
+#if defined(Q_OS_WIN)
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(Q_OS_LINUX)
+#include <unistd.h>
+#endif
+
+constexpr auto AccountsSaveRelPath = "accounts.json";
+constexpr auto AccountsDataRelPath = "accounts";
+constexpr auto GameVersionSaveRelPath = "gameVersion.json";
+constexpr auto SessionStoreRelPath = "sessions.db";
+
+constexpr auto OverheadLogInterval = std::chrono::minutes{60};
+constexpr auto RebalanceInterval = std::chrono::minutes{10};
+constexpr double ShardOverloadRatio = 1.5;
+constexpr int RqstExecutorThreadCount = 2;
+constexpr int MaxConcurrentTokenRefreshes = 2;
+
+static int64_t currentMemoryUsage() {
+#if defined(Q_OS_WIN)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<int64_t>(counters.WorkingSetSize);
+    }
+    return 0;
+#elif defined(Q_OS_LINUX)
+    QFile statm{u"/proc/self/statm"_s};
+    if (!statm.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2) {
+        return 0;
+    }
+    return fields[1].toLongLong() * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
+static QString accountDataDir(const QString &accountId) {
+    QDir appDir{QCoreApplication::applicationDirPath()};
+    if (accountId == AccountManager::DefaultAccountId) {
+        return appDir.path();
+    }
+    QString path = appDir.filePath(QString{AccountsDataRelPath} + u'/' + accountId);
+    QDir{}.mkpath(path);
+    return path;
+}
+
+
+AccountManager::~AccountManager() {
+    for (auto &account : accounts) {
+        destroyAccount(account);
+    }
+}
+
+AccountManager::AccountManager()
+    : shards{QThread::idealThreadCount()},
+      loginAdmission{Config::get(Config::MaxConcurrentLogins)},
+      tokenRefreshAdmission{MaxConcurrentTokenRefreshes},
+      rqstExecutor{RqstExecutorThreadCount},
+      gameVersionCache{QDir{QCoreApplication::applicationDirPath()}.filePath(GameVersionSaveRelPath), rqstExecutor},
+      sessionStore{QDir{QCoreApplication::applicationDirPath()}.filePath(SessionStoreRelPath)}
+{
+    overheadTimer.callOnTimeout(this, &AccountManager::logOverhead);
+    rebalanceTimer.callOnTimeout(this, &AccountManager::rebalance);
+    connect(Config::notifier(), &Config::Notifier::changed, this, &AccountManager::onConfigChanged);
+}
+
+void AccountManager::load() {
+    baselineMemory = currentMemoryUsage();
+    gameVersionCache.load();
+    sessionStore.load();
+
+    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(AccountsSaveRelPath);
+    QFile file{filePath};
+    QJsonArray accountList;
+    if (file.open(QIODevice::ReadOnly)) {
+        accountList = QJsonDocument::fromJson(file.readAll()).object()[u"accounts"_s].toArray();
+    }
+    if (accountList.isEmpty()) {
+        accountList.append(QJsonObject{{u"id"_s, DefaultAccountId}});
+    }
+    for (const auto obj : std::as_const(accountList)) {
+        createAccount(obj[u"id"_s].toString(), obj[u"config"_s].toObject());
+    }
+
+    overheadTimer.start(OverheadLogInterval);
+    rebalanceTimer.start(RebalanceInterval);
+}
+
+void AccountManager::save() {
+    QJsonArray accountList;
+    for (const auto &account : accounts) {
+        accountList.append(QJsonObject{
+            {u"id"_s, account.id},
+            {u"config"_s, account.config},
+        });
+    }
+    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(AccountsSaveRelPath);
+    QSaveFile file{filePath};
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "failed to open accounts save file";
+        return;
+    }
+    file.write(QJsonDocument{QJsonObject{{u"accounts"_s, accountList}}}.toJson());
+    file.commit();
+}
+
+TopwarHelper* AccountManager::createAccount(const QString &accountId, const QJsonObject &config) {
+    int shard = shards.shardOf(accountId);
+    QString dataDir = accountDataDir(accountId);
+    auto helper = shards.create<TopwarHelper>(shard, [=, this] {
+        return new TopwarHelper{this, accountId, dataDir, config};
+    });
+    accounts.push_back(Account{accountId, config, shard, helper});
+    return helper;
+}
+
+void AccountManager::destroyAccount(Account &account) {
+    gameVersionCache.cancel(account.helper);
+    loginAdmission.cancel(account.helper);
+    tokenRefreshAdmission.cancel(account.helper);
+    shards.destroy(account.shard, account.helper);
+    account.helper = nullptr;
+}
+
+void AccountManager::startAll(Callback<TopwarHelper*> onNoSession) {
+    for (const auto &account : accounts) {
+        startAccount(account.helper, onNoSession);
+    }
+}
+
+void AccountManager::startAccount(TopwarHelper *helper, Callback<TopwarHelper*> onNoSession) {
+    QMetaObject::invokeMethod(helper, [this, helper, onNoSession] {
+        unique_ptr<GameSessionInfo> session = helper->readSavedSession();
+        if (session != nullptr) {
+            helper->start(std::move(session));
+        } else if (onNoSession) {
+            QMetaObject::invokeMethod(this, [helper, onNoSession] { onNoSession(helper); });
+        }
+    });
+}
+
+TopwarHelper* AccountManager::addAccount() {
+    QString accountId;
+    do {
+        accountId = QString::number(QRandomGenerator::global()->generate(), 36);
+    } while (getAccount(accountId) != nullptr);
+    auto helper = createAccount(accountId, {});
+    save();
+    return helper;
+}
+
+void AccountManager::removeAccount(const QString &accountId) {
+    for (auto &account : accounts) {
+        if (account.id == accountId) {
+            destroyAccount(account);
+        }
+    }
+    std::erase_if(accounts, [&](const auto &account) {
+        return account.id == accountId;
+    });
+    shards.unassign(accountId);
+    sessionStore.remove(accountId);
+    save();
+}
+
+TopwarHelper* AccountManager::getAccount(const QString &accountId) const {
+    for (const auto &account : accounts) {
+        if (account.id == accountId) {
+            return account.helper;
+        }
+    }
+    return nullptr;
+}
+
+TopwarHelper* AccountManager::primary() const {
+    return accounts.empty() ? nullptr : accounts.front().helper;
+}
+
+std::vector<TopwarHelper*> AccountManager::getAccounts() const {
+    std::vector<TopwarHelper*> ret;
+    ret.reserve(accounts.size());
+    for (const auto &account : accounts) {
+        ret.push_back(account.helper);
+    }
+    return ret;
+}
+
+void AccountManager::setAccountConfig(const QString &accountId, QLatin1StringView k, const QJsonValue &v) {
+    for (auto &account : accounts) {
+        if (account.id == accountId) {
+            account.config.insert(k, v);
+            QMetaObject::invokeMethod(account.helper, [helper=account.helper, config=account.config] {
+                helper->setConfigOverrides(config);
+            });
+            save();
+        }
+    }
+}
+
+void AccountManager::onConfigChanged() {
+    loginAdmission.setMaxConcurrent(Config::get(Config::MaxConcurrentLogins));
+    for (const auto &account : accounts) {
+        QMetaObject::invokeMethod(account.helper, [helper=account.helper] { helper->onConfigChanged(); });
+    }
+}
+
+LoginAdmission& AccountManager::getLoginAdmission() {
+    return loginAdmission;
+}
+
+LoginAdmission& AccountManager::getTokenRefreshAdmission() {
+    return tokenRefreshAdmission;
+}
+
+SessionStore& AccountManager::getSessionStore() {
+    return sessionStore;
+}
+
+RqstExecutor& AccountManager::getRqstExecutor() {
+    return rqstExecutor;
+}
+
+void AccountManager::prewarmGameHosts() {
+    // the game version (GameVersionCache) and the session exchange (loginByToken)
+    rqstExecutor.prewarm({u"warh5.rivergame.net"_s, u"serverlist-knight.rivergame.net"_s});
+}
+
+void AccountManager::requestGameVersion(QObject *context, Callback<const QString&> callback) {
+    runInManagerThread(context, [this, context, callback=std::move(callback)]() mutable {
+        gameVersionCache.request(context, std::move(callback));
+    });
+}
+
+void AccountManager::revalidateGameVersion(QObject *context, const QString &version, Callback<const QString&> callback) {
+    runInManagerThread(context, [this, context, version, callback=std::move(callback)]() mutable {
+        gameVersionCache.revalidate(version, context, std::move(callback));
+    });
+}
+
+void AccountManager::runInManagerThread(QObject *context, Callback<> func) {
+    if (QThread::currentThread() == thread()) {
+        func();
+        return;
+    }
+    QMetaObject::invokeMethod(this, [this, context, func=std::move(func)] {
+        // the account may have been removed while this call is queued
+        bool isAlive = std::ranges::any_of(accounts, [&](const auto &account) {
+            return account.helper == context;
+        });
+        if (isAlive) {
+            func();
+        }
+    });
+}
+
+void AccountManager::logOverhead() {
+    if (accounts.empty()) {
+        return;
+    }
+    auto n = static_cast<int64_t>(accounts.size());
+    int64_t memPerAccount = (currentMemoryUsage() - baselineMemory) / n;
+    std::vector<nanoseconds> shardBusyTime(shards.shardCount(), nanoseconds{0});
+    shards.runOnEach([&](int shard) {
+        for (const auto &account : accounts) {
+            if (account.shard == shard) {
+                shardBusyTime[shard] += account.helper->getBusyTime();
+            }
+        }
+    });
+    nanoseconds busyTime = std::reduce(shardBusyTime.begin(), shardBusyTime.end());
+    log() << u"账号数："_s << n << u"，线程数："_s << shards.shardCount()
+          << u"，平均每账号内存 "_s << max<int64_t>(memPerAccount, 0) / 1_KiB << u" KiB"_s
+          << u"，CPU时间 "_s << DurationCast::round<milliseconds>(busyTime / n).count() << u" ms"_s;
+
+    LoginAdmission::Stats stats = loginAdmission.takeStats();
+    log() << u"登录队列：排队 "_s << stats.queueDepth << u"，进行中 "_s << stats.active
+          << u"，本期登录 "_s << stats.admitted
+          << u"，平均等待 "_s << stats.avgWait.count() << u" ms"_s
+          << u"，最长等待 "_s << stats.maxWait.count() << u" ms"_s;
+
+    int64_t handshakes = HttpRqst::takeHandshakeCount();
+    log() << u"TLS握手 "_s << handshakes << u" 次，平均每次登录 "_s
+          << QString::number(stats.admitted == 0 ? 0.0 : static_cast<double>(handshakes) / stats.admitted, 'f', 2);
+}
+
+void AccountManager::rebalance() {
+    int shardCount = shards.shardCount();
+    if (shardCount < 2 || accounts.empty()) {
+        return;
+    }
+
+    // busy time of each account since last rebalance, and whether it is idle
+    std::vector<nanoseconds> accountLoad(accounts.size(), nanoseconds{0});
+    std::vector<bool> accountIdle(accounts.size(), false);
+    shards.runOnEach([&](int shard) {
+        for (size_t i = 0; i < accounts.size(); i++) {
+            auto &account = accounts[i];
+            if (account.shard != shard) {
+                continue;
+            }
+            nanoseconds busyTime = account.helper->getBusyTime();
+            accountLoad[i] = max(busyTime - account.lastBusyTime, nanoseconds{0});
+            accountIdle[i] = !account.helper->isConnected();
+            account.lastBusyTime = busyTime;
+        }
+    });
+
+    std::vector<nanoseconds> shardLoad(shardCount, nanoseconds{0});
+    for (size_t i = 0; i < accounts.size(); i++) {
+        shardLoad[accounts[i].shard] += accountLoad[i];
+    }
+    auto busiest = std::ranges::max_element(shardLoad) - shardLoad.begin();
+    auto idlest = std::ranges::min_element(shardLoad) - shardLoad.begin();
+    auto mean = std::reduce(shardLoad.begin(), shardLoad.end()) / shardCount;
+    if (busiest == idlest || shardLoad[busiest] <= mean * ShardOverloadRatio) {
+        return;
+    }
+
+    optional<size_t> candidate;
+    for (size_t i = 0; i < accounts.size(); i++) {
+        if (accounts[i].shard != busiest || !accountIdle[i]) {
+            continue;
+        }
+        // moving must not overload the target shard in turn
+        if (shardLoad[idlest] + accountLoad[i] >= shardLoad[busiest] - accountLoad[i]) {
+            continue;
+        }
+        if (!candidate.has_value() || accountLoad[i] > accountLoad[*candidate]) {
+            candidate = i;
+        }
+    }
+    if (!candidate.has_value()) {
+        return;
+    }
+
+    // The state of an idle account is all on disk (session, task state),
+    // so it is moved by recreating it in the target shard.
+    Account &account = accounts[*candidate];
+    qDebug() << "move account" << account.id << "from shard" << account.shard << "to" << idlest;
+    destroyAccount(account);
+    shards.assign(account.id, static_cast<int>(idlest));
+    QString dataDir = accountDataDir(account.id);
+    account.shard = static_cast<int>(idlest);
+    account.lastBusyTime = nanoseconds{0};
+    account.helper = shards.create<TopwarHelper>(account.shard, [=, this, id=account.id, config=account.config] {
+        return new TopwarHelper{this, id, dataDir, config};
+    });
+    startAccount(account.helper, {});
+    emit accountMoved(account.id, account.helper);
+}
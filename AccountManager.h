@@ -0,0 +1,121 @@
+#pragma once
+
+#include <QObject>
+#include <QJsonObject>
+#include "TopwarHelper.h"
+#include "ShardPool.h"
+#include "LoginAdmission.h"
+#include "GameVersionCache.h"
+#include "Config.h"
+#include "SessionStore.h"
+
+/**
+ * Runs many independent account contexts (TopwarHelper) in one process.
+ *
+ * Each account has its own data directory (session, task state) and config
+ * overrides, while the HTTP stack and the game version are shared.
+ *
+ * Accounts are spread over the threads of a ShardPool. Each TopwarHelper
+ * lives in the thread of its shard and shares that thread's scheduler and
+ * network access manager with the other accounts of the shard. Methods of
+ * a TopwarHelper must be called in its own thread (QMetaObject::invokeMethod).
+ * Shards are rebalanced periodically: when a shard is overloaded, its busiest
+ * idle account is moved to the least loaded shard.
+ *
+ * The account list is saved to accounts.json. The legacy single account
+ * is kept as account "default" whose data stays in the application directory.
+ */
+class AccountManager: public QObject
+{
+    Q_OBJECT
+
+public:
+    static constexpr QLatin1StringView DefaultAccountId{"default"};
+
+    AccountManager();
+    ~AccountManager() override;
+
+    void load();
+
+    /**
+     * Starts every account from its saved session.
+     * onNoSession is called in the thread of the manager for each account
+     * without a saved session.
+     */
+    void startAll(Callback<TopwarHelper*> onNoSession);
+
+    TopwarHelper* addAccount();
+    void removeAccount(const QString &accountId);
+
+    TopwarHelper* getAccount(const QString &accountId) const;
+    TopwarHelper* primary() const;
+    std::vector<TopwarHelper*> getAccounts() const;
+
+    // Overrides a setting for one account, which applies it right away
+    template <class T>
+    void setAccountConfig(const QString &accountId, Config::Key<T> key, T value) {
+        setAccountConfig(accountId, key.name, QJsonValue{value});
+    }
+
+    // Shared by all accounts, thread-safe
+    LoginAdmission& getLoginAdmission();
+    // Caps the concurrent background refreshes of session tokens, thread-safe
+    LoginAdmission& getTokenRefreshAdmission();
+    // Threads for HTTP requests made off the thread of the manager
+    RqstExecutor& getRqstExecutor();
+    // Opens connections to the hosts of the login requests in the threads of the
+    // RqstExecutor, shortly before a login. Thread-safe
+    void prewarmGameHosts();
+    // Saved sessions of all accounts, keyed by account id. Thread-safe
+    SessionStore& getSessionStore();
+
+    /**
+     * Calls callback in the thread of context with the game version shared by
+     * all accounts (see GameVersionCache). An empty version is passed on failure.
+     * This function is thread-safe. context must be a TopwarHelper owned by
+     * this manager or an object living in the thread of the manager.
+     */
+    void requestGameVersion(QObject *context, Callback<const QString&> callback);
+
+    /**
+     * Checks version after the game server rejected it, and calls callback
+     * like requestGameVersion(). See GameVersionCache::revalidate().
+     */
+    void revalidateGameVersion(QObject *context, const QString &version, Callback<const QString&> callback);
+
+    void logOverhead();
+    void rebalance();
+
+signals:
+    // The helper of the account is recreated in another shard
+    void accountMoved(const QString &accountId, TopwarHelper *helper);
+
+private:
+    struct Account {
+        QString id;
+        QJsonObject config;
+        int shard;
+        TopwarHelper *helper;
+        nanoseconds lastBusyTime{0};
+    };
+
+    TopwarHelper* createAccount(const QString &accountId, const QJsonObject &config);
+    void destroyAccount(Account &account);
+    void startAccount(TopwarHelper *helper, Callback<TopwarHelper*> onNoSession);
+    void save();
+    void setAccountConfig(const QString &accountId, QLatin1StringView k, const QJsonValue &v);
+    void onConfigChanged();
+    // Runs func in the thread of the manager, unless the account context is removed meanwhile
+    void runInManagerThread(QObject *context, Callback<> func);
+
+    ShardPool shards;
+    LoginAdmission loginAdmission;
+    LoginAdmission tokenRefreshAdmission;
+    std::vector<Account> accounts;
+    int64_t baselineMemory{0};
+    QTimer overheadTimer;
+    QTimer rebalanceTimer;
+    RqstExecutor rqstExecutor;
+    GameVersionCache gameVersionCache;
+    SessionStore sessionStore;
+};
@@ -0,0 +1,129 @@
+#include "BatchLoginDialog.h"
+#include "WeixinLoginDialog.h"
+#include <QtWidgets>
+
+constexpr int GridColumns = 5;
+constexpr int QrModuleSize = 3;
+constexpr int AddMoreCount = 10;
+
+BatchLoginDialog::BatchLoginDialog(const QString &appId, const QString &redirectUri,
+                                   RqstExecutor &executor, int count, QWidget *parent)
+    : QDialog(parent)
+{
+    batch = new WeixinLoginBatch{appId, redirectUri, executor, this};
+    connect(batch, &WeixinLoginBatch::qrCodeChanged, this, &BatchLoginDialog::showQrCode);
+    connect(batch, &WeixinLoginBatch::statusChanged, this, &BatchLoginDialog::showStatus);
+    connect(batch, &WeixinLoginBatch::codeReceived, this, [this](int, const QString &code) {
+        updateSummary();
+        emit codeReceived(code);
+    });
+
+    auto mainLayout = new QVBoxLayout{this};
+    summaryLabel = new QLabel{this};
+    mainLayout->addWidget(summaryLabel);
+
+    auto gridWidget = new QWidget;
+    gridLayout = new QGridLayout{gridWidget};
+    auto scrollArea = new QScrollArea{this};
+    scrollArea->setWidget(gridWidget);
+    scrollArea->setWidgetResizable(true);
+    scrollArea->setMinimumSize(GridColumns * 150 + 40, 420);
+    mainLayout->addWidget(scrollArea, 1);
+
+    auto buttonLayout = new QHBoxLayout;
+    auto addMoreBtn = new QPushButton{u"再添加%1个"_s.arg(AddMoreCount)};
+    auto exportBtn = new QPushButton{u"导出二维码图片"_s};
+    auto closeBtn = new QPushButton{u"关闭"_s};
+    buttonLayout->addWidget(addMoreBtn);
+    buttonLayout->addWidget(exportBtn);
+    buttonLayout->addStretch();
+    buttonLayout->addWidget(closeBtn);
+    mainLayout->addLayout(buttonLayout);
+    connect(addMoreBtn, &QPushButton::clicked, this, [this] { addCells(AddMoreCount); });
+    connect(exportBtn, &QPushButton::clicked, this, &BatchLoginDialog::exportQrCodes);
+    connect(closeBtn, &QPushButton::clicked, this, &QDialog::accept);
+
+    setLayout(mainLayout);
+    setWindowTitle(u"批量添加账号"_s);
+
+    addCells(count);
+}
+
+void BatchLoginDialog::addCells(int n) {
+    int first = cells.size();
+    for (int i = first; i < first + n; i++) {
+        auto cellLayout = new QVBoxLayout;
+        auto qrCodeLabel = new QLabel{u"加载中…"_s};
+        qrCodeLabel->setFixedSize(130, 130);
+        qrCodeLabel->setAlignment(Qt::AlignCenter);
+        auto tipLabel = new QLabel{u"#%1"_s.arg(i + 1)};
+        tipLabel->setAlignment(Qt::AlignCenter);
+        auto refreshButton = new QToolButton;
+        refreshButton->setText(u"刷新"_s);
+        refreshButton->setHidden(true);
+        connect(refreshButton, &QToolButton::clicked, this, [this, i] { batch->refresh(i); });
+
+        cellLayout->addWidget(qrCodeLabel, 0, Qt::AlignCenter);
+        cellLayout->addWidget(tipLabel, 0, Qt::AlignCenter);
+        cellLayout->addWidget(refreshButton, 0, Qt::AlignCenter);
+        gridLayout->addLayout(cellLayout, i / GridColumns, i % GridColumns);
+        cells.push_back({qrCodeLabel, tipLabel, refreshButton});
+    }
+    batch->addSlots(n);
+    updateSummary();
+}
+
+void BatchLoginDialog::showQrCode(int index, const QString &content) {
+    QPixmap pixmap = QPixmap::fromImage(makeQrCodeImage(content, QrModuleSize));
+    cells[index].qrCodeLabel->setFixedSize(pixmap.size());
+    cells[index].qrCodeLabel->setPixmap(pixmap);
+}
+
+void BatchLoginDialog::showStatus(int index, WeixinLoginBatch::Status status) {
+    using enum WeixinLoginBatch::Status;
+    const Cell &cell = cells[index];
+    QString prefix = u"#%1 "_s.arg(index + 1);
+    cell.refreshButton->setHidden(status != Expired && status != Error);
+    switch (status) {
+    case Loading:
+        cell.tipLabel->setText(prefix + u"加载中"_s);
+        break;
+    case Waiting:
+        cell.tipLabel->setText(prefix + u"等待扫码"_s);
+        break;
+    case Scanned:
+        cell.tipLabel->setText(prefix + u"✅ 扫描成功"_s);
+        break;
+    case Canceled:
+        cell.tipLabel->setText(prefix + u"❌ 已取消"_s);
+        break;
+    case Expired:
+        cell.qrCodeLabel->clear();
+        cell.tipLabel->setText(prefix + u"二维码已失效"_s);
+        break;
+    case Error:
+        cell.qrCodeLabel->clear();
+        cell.tipLabel->setText(prefix + u"❌ 请求错误"_s);
+        break;
+    case Done:
+        cell.qrCodeLabel->clear();
+        cell.qrCodeLabel->setText(u"✅"_s);
+        cell.tipLabel->setText(prefix + u"已登录"_s);
+        break;
+    }
+}
+
+void BatchLoginDialog::updateSummary() {
+    summaryLabel->setText(u"使用微信扫一扫登录，每个二维码对应一个新账号。已登录 %1 / %2"_s
+                              .arg(batch->doneCount()).arg(batch->slotCount()));
+}
+
+void BatchLoginDialog::exportQrCodes() {
+    QString defaultDir = QDir{QCoreApplication::applicationDirPath()}.filePath(u"qrcodes"_s);
+    QString dir = QFileDialog::getExistingDirectory(this, u"导出二维码图片"_s, defaultDir);
+    if (dir.isEmpty()) {
+        return;
+    }
+    // kept up to date from now on: new codes are written, used ones removed
+    batch->setQrSaveDir(dir);
+}
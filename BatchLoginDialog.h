@@ -0,0 +1,43 @@
+#pragma once
+
+#include <QDialog>
+#include "WeixinLoginBatch.h"
+
+class QLabel;
+class QGridLayout;
+class QToolButton;
+
+/**
+ * Shows the QR codes of a WeixinLoginBatch in a grid, for adding many
+ * accounts in one go. codeReceived is emitted for each scanned code,
+ * while the others keep waiting.
+ */
+class BatchLoginDialog : public QDialog
+{
+    Q_OBJECT
+
+public:
+    BatchLoginDialog(const QString &appId, const QString &redirectUri,
+                     RqstExecutor &executor, int count, QWidget *parent = nullptr);
+
+signals:
+    void codeReceived(const QString &code);
+
+private:
+    struct Cell {
+        QLabel *qrCodeLabel;
+        QLabel *tipLabel;
+        QToolButton *refreshButton;
+    };
+
+    void addCells(int n);
+    void showQrCode(int index, const QString &content);
+    void showStatus(int index, WeixinLoginBatch::Status status);
+    void updateSummary();
+    void exportQrCodes();
+
+    WeixinLoginBatch *batch;
+    std::vector<Cell> cells;
+    QGridLayout *gridLayout;
+    QLabel *summaryLabel;
+};
@@ -1,75 +1,164 @@
 #include <QtCore>
 #include "Config.h"
-#include "MainWindow.h"
 
+namespace Config
+{
 
-static QJsonObject* data = nullptr;
-static QTimer* saveTimer = nullptr;
-constexpr auto ConfigSaveRelPath = "config.json";
+namespace {
 
-static void doSave() {
-    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(ConfigSaveRelPath);
-    QFile configFile{filePath};
-    if (!configFile.open(QIODevice::WriteOnly)) {
-        qDebug() << "failed to open session save file";
-        return;
-    }
-    configFile.write(QJsonDocument{*data}.toJson());
+struct KeyInfo {
+    int index;
+    QLatin1StringView name;
+    Value defaultValue;
+};
+
+template <class T>
+constexpr KeyInfo info(Key<T> key) {
+    return {key.index, key.name, key.defaultValue};
 }
 
-void Config::init() {
-    data = new QJsonObject{};
-    saveTimer = new QTimer{getMainWindow()};
-    saveTimer->setSingleShot(true);
-    saveTimer->callOnTimeout(getMainWindow(), doSave);
+constexpr KeyInfo AllKeys[] = {
+    info(Warzone),
+    info(RunInterval),
+    info(ScienceDonatePrefer),
+    info(DonateCoinConsume),
+    info(WorldSiteDonatePrefer),
+    info(MaxConcurrentLogins),
+};
+static_assert(std::size(AllKeys) == KeyCount);
 
-    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(ConfigSaveRelPath);
-    QFile configFile{filePath};
-    if (configFile.open(QIODevice::ReadOnly)) {
-        *data = QJsonDocument::fromJson(configFile.readAll()).object();
+constexpr bool indexesMatch() {
+    for (int i = 0; i < KeyCount; i++) {
+        if (AllKeys[i].index != i) {
+            return false;
+        }
     }
+    return true;
+}
+static_assert(indexesMatch(), "AllKeys must be in the order of Key::index");
 
-    if (!data->contains(KeyWarzone)) {
-        data->insert(KeyWarzone, 0);
-    }
-    if (!data->contains(KeyRunInterval)) {
-        data->insert(KeyRunInterval, RunIntervalDefault);
+} // END anonymous namespace
+
+constexpr auto ConfigSaveRelPath = "config.json";
+constexpr auto SaveDelay = 3s;
+
+static std::atomic<shared_ptr<const Values>> current{std::make_shared<const Values>()};
+// used in the main thread only
+static QJsonObject fileContent; // keeps the entries of other versions
+static Notifier *changeNotifier = nullptr;
+static QTimer *saveTimer = nullptr;
+// one thread, so that the saves are written in order
+static QThreadPool *savePool = nullptr;
+
+static QString configFilePath() {
+    return QDir{QCoreApplication::applicationDirPath()}.filePath(ConfigSaveRelPath);
+}
+
+Values::Values() {
+    for (const KeyInfo &key : AllKeys) {
+        values[key.index] = key.defaultValue;
     }
-    if (!data->contains(KeyScienceDonatePrefer)) {
-        data->insert(KeyScienceDonatePrefer, 0);
+}
+
+void Values::merge(const QJsonObject &obj) {
+    for (const KeyInfo &key : AllKeys) {
+        auto it = obj.constFind(key.name);
+        if (it == obj.constEnd()) {
+            continue;
+        }
+        QJsonValue v = it.value();
+        if (std::holds_alternative<bool>(key.defaultValue)) {
+            if (v.isBool()) {
+                values[key.index] = v.toBool();
+            }
+        } else if (v.isDouble()) {
+            values[key.index] = v.toInt();
+        }
     }
-    if (!data->contains(KeyDonateCoinConsume)) {
-        data->insert(KeyDonateCoinConsume, false);
+}
+
+QJsonObject Values::toJson() const {
+    QJsonObject obj;
+    for (const KeyInfo &key : AllKeys) {
+        std::visit([&](auto v) { obj.insert(key.name, v); }, values[key.index]);
     }
-    if (!data->contains(KeyWorldSiteDonatePrefer)) {
-        data->insert(KeyWorldSiteDonatePrefer, 0);
+    return obj;
+}
+
+static void doSave() {
+    const QJsonObject values = snapshot()->toJson();
+    for (auto it = values.begin(); it != values.end(); it++) {
+        fileContent.insert(it.key(), it.value());
     }
+    QByteArray data = QJsonDocument{fileContent}.toJson();
+    savePool->start([data=std::move(data)] {
+        QSaveFile file{configFilePath()};
+        if (!file.open(QIODevice::WriteOnly)) {
+            qDebug() << "failed to open config save file";
+            return;
+        }
+        file.write(data);
+        if (!file.commit()) {
+            qDebug() << "failed to save config" << file.errorString();
+        }
+    });
 }
 
-void Config::save() {
-    if (!saveTimer->isActive()) {
-        saveTimer->start(3s);
+void init() {
+    changeNotifier = new Notifier{};
+    saveTimer = new QTimer{changeNotifier};
+    saveTimer->setSingleShot(true);
+    saveTimer->callOnTimeout(changeNotifier, doSave);
+    savePool = new QThreadPool{changeNotifier};
+    savePool->setMaxThreadCount(1);
+
+    QFile configFile{configFilePath()};
+    if (configFile.open(QIODevice::ReadOnly)) {
+        fileContent = QJsonDocument::fromJson(configFile.readAll()).object();
     }
+    auto values = std::make_shared<Values>();
+    values->merge(fileContent);
+    current.store(std::move(values));
 }
 
-const QJsonObject &Config::get() {
-    return *data;
+void flush() {
+    if (saveTimer->isActive()) {
+        saveTimer->stop();
+        doSave();
+    }
+    savePool->waitForDone();
 }
 
-const QJsonValue Config::get(QLatin1StringView k) {
-    return data->value(k);
+shared_ptr<const Values> snapshot() {
+    return current.load(std::memory_order_acquire);
 }
 
-const QJsonValue Config::get(QStringView k) {
-    return data->value(k);
+void setValue(int index, const Value &value) {
+    auto old = snapshot();
+    auto values = std::make_shared<Values>(*old);
+    values->set(index, value);
+    if (*values == *old) {
+        return;
+    }
+    current.store(std::move(values), std::memory_order_release);
+    if (!saveTimer->isActive()) {
+        saveTimer->start(SaveDelay);
+    }
+    emit changeNotifier->changed();
 }
 
-void Config::set(QLatin1StringView k, const QJsonValue &v) {
-    data->insert(k, v);
-    save();
+shared_ptr<const Values> resolve(const QJsonObject &overrides) {
+    auto global = snapshot();
+    if (overrides.isEmpty()) {
+        return global;
+    }
+    auto values = std::make_shared<Values>(*global);
+    values->merge(overrides);
+    return values;
 }
 
-void Config::set(QStringView k, const QJsonValue &v) {
-    data->insert(k, v);
-    save();
+Notifier* notifier() {
+    return changeNotifier;
 }
+
+} // END namespace Config
@@ -1,23 +1,111 @@
 #pragma once
 
-#include <QJsonDocument>
+#include <QJsonObject>
+#include <QObject>
+#include <array>
+#include <atomic>
+#include <variant>
+#include "common.h"
 
+/**
+ * Global settings, saved in config.json, with per-account overrides.
+ *
+ * Each setting is a Key with its type and default, so a lookup is an index
+ * into an array instead of a JSON lookup by name. The settings are published
+ * as immutable Values snapshots: readers in any thread take the current one
+ * without locking, set() publishes a new one. Saves are deferred and written
+ * in a background thread through QSaveFile (a temporary file renamed over
+ * config.json), so a crash never leaves a truncated file.
+ */
 namespace Config
 {
 constexpr int RunIntervalDefault = 60 * 60;
+constexpr int MaxConcurrentLoginsDefault = 8;
 
-constexpr QLatin1StringView KeyWarzone{"warzone"};
-constexpr QLatin1StringView KeyRunInterval{"RunInterval"};
-constexpr QLatin1StringView KeyScienceDonatePrefer{"ScienceDonatePrefer"};
-constexpr QLatin1StringView KeyDonateCoinConsume{"DonateCoinConsume"};
-constexpr QLatin1StringView KeyWorldSiteDonatePrefer{"WorldSiteDonatePrefer"};
+template <class T>
+struct Key {
+    int index;
+    QLatin1StringView name;
+    T defaultValue;
+};
+
+constexpr Key<int> Warzone{0, QLatin1StringView{"warzone"}, 0};
+constexpr Key<int> RunInterval{1, QLatin1StringView{"RunInterval"}, RunIntervalDefault};
+constexpr Key<int> ScienceDonatePrefer{2, QLatin1StringView{"ScienceDonatePrefer"}, 0};
+constexpr Key<bool> DonateCoinConsume{3, QLatin1StringView{"DonateCoinConsume"}, false};
+constexpr Key<int> WorldSiteDonatePrefer{4, QLatin1StringView{"WorldSiteDonatePrefer"}, 0};
+constexpr Key<int> MaxConcurrentLogins{5, QLatin1StringView{"MaxConcurrentLogins"}, MaxConcurrentLoginsDefault};
+constexpr int KeyCount = 6;
+
+using Value = std::variant<int, bool>;
+
+// A value of every setting, indexed by Key::index
+class Values
+{
+public:
+    Values();
+
+    template <class T>
+    T get(Key<T> key) const {
+        return std::get<T>(values[key.index]);
+    }
+
+    template <class T>
+    void set(Key<T> key, T value) {
+        values[key.index] = value;
+    }
+
+    // value must have the type of the key at index
+    void set(int index, const Value &value) {
+        values[index] = value;
+    }
+
+    // The settings in obj, by name, replace the current ones. Values of a wrong type are ignored
+    void merge(const QJsonObject &obj);
+    QJsonObject toJson() const;
+
+    bool operator== (const Values &other) const = default;
+
+private:
+    std::array<Value, KeyCount> values;
+};
+
+/**
+ * Emits changed() in the main thread after set() published a new snapshot.
+ * Accounts resolve their settings again, see TopwarHelper::onConfigChanged().
+ */
+class Notifier: public QObject
+{
+    Q_OBJECT
+
+signals:
+    void changed();
+};
 
     void init();
-    void save();
 
-    const QJsonObject& get();
-    const QJsonValue get(QLatin1StringView k);
-    const QJsonValue get(QStringView k);
-    void set(QLatin1StringView k, const QJsonValue &v);
-    void set(QStringView k, const QJsonValue &v);
+    // Writes a pending save now and waits for it
+    void flush();
+
+    // The current settings. Thread-safe: readers never block on setValue(), at most
+    // they wait for its pointer swap (std::atomic<shared_ptr> is not lock-free everywhere)
+    shared_ptr<const Values> snapshot();
+
+    template <class T>
+    T get(Key<T> key) {
+        return snapshot()->get(key);
+    }
+
+    // Must be called in the main thread
+    void setValue(int index, const Value &value);
+
+    template <class T>
+    void set(Key<T> key, T value) {
+        setValue(key.index, value);
+    }
+
+    // The current settings with the overrides of an account (by key name) on top
+    shared_ptr<const Values> resolve(const QJsonObject &overrides);
+
+    Notifier* notifier();
 } // END namespace Config
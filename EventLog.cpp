@@ -0,0 +1,411 @@
+#include <QtCore>
+#include "EventLog.h"
+#include "TopwarIds.h"
+
+namespace EventLog {
+
+static constexpr const char* EventNames[] = {
+    "Text",
+    "Dropped",
+    "ConnectFailed",
+    "ServerClosed",
+    "Disconnected",
+    "Connected",
+    "ChangeServerNoAccount",
+    "DonateScience",
+    "DonateSite",
+    "CollectCoin",
+    "AdReward",
+    "MysteryReward",
+    "ConsumeCoinBusy",
+    "DeepSeaCollect",
+    "DeepSeaStart",
+    "CurrentCoin",
+    "TrainDone",
+    "WxShareReward",
+    "ShareBoxHelped",
+    "ShareBoxOpened",
+    "WarningText",
+};
+static_assert(std::size(EventNames) == static_cast<size_t>(LogEvent::EventCount));
+
+const char* eventName(LogEvent event) {
+    auto i = static_cast<size_t>(event);
+    return i < std::size(EventNames) ? EventNames[i] : "Unknown";
+}
+
+optional<LogEvent> eventFromName(QStringView name) {
+    for (size_t i = 0; i < std::size(EventNames); i++) {
+        if (name.compare(QLatin1StringView{EventNames[i]}, Qt::CaseInsensitive) == 0) {
+            return static_cast<LogEvent>(i);
+        }
+    }
+    return {};
+}
+
+LogSeverity severityOf(LogEvent event) {
+    switch (event) {
+    case LogEvent::WarningText:
+    case LogEvent::Dropped:
+    case LogEvent::ConnectFailed:
+    case LogEvent::ServerClosed:
+    case LogEvent::ChangeServerNoAccount:
+    case LogEvent::ConsumeCoinBusy:
+        return LogSeverity::Warning;
+    default:
+        return LogSeverity::Info;
+    }
+}
+
+} // END namespace EventLog
+
+
+int64_t EventRecord::intArg(size_t i) const {
+    if (i >= args.size()) {
+        return 0;
+    }
+    if (auto p = std::get_if<int64_t>(&args[i])) {
+        return *p;
+    }
+    if (auto p = std::get_if<double>(&args[i])) {
+        return static_cast<int64_t>(*p);
+    }
+    return 0;
+}
+
+double EventRecord::doubleArg(size_t i) const {
+    if (i >= args.size()) {
+        return 0;
+    }
+    if (auto p = std::get_if<double>(&args[i])) {
+        return *p;
+    }
+    if (auto p = std::get_if<int64_t>(&args[i])) {
+        return static_cast<double>(*p);
+    }
+    return 0;
+}
+
+QString EventRecord::stringArg(size_t i) const {
+    if (i >= args.size()) {
+        return {};
+    }
+    if (auto p = std::get_if<QString>(&args[i])) {
+        return *p;
+    }
+    if (auto p = std::get_if<int64_t>(&args[i])) {
+        return QString::number(*p);
+    }
+    return QString::number(std::get<double>(args[i]));
+}
+
+namespace {
+
+class Reader {
+public:
+    explicit Reader(QByteArrayView data)
+        : data{data} {}
+
+    template <class T>
+    bool read(T &out) {
+        if (pos + qsizetype(sizeof(T)) > data.size()) {
+            return false;
+        }
+        out = qFromLittleEndian<T>(data.data() + pos);
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readBytes(qsizetype n, QByteArrayView &out) {
+        if (n < 0 || pos + n > data.size()) {
+            return false;
+        }
+        out = data.sliced(pos, n);
+        pos += n;
+        return true;
+    }
+
+    bool atEnd() const {
+        return pos == data.size();
+    }
+
+private:
+    QByteArrayView data;
+    qsizetype pos{0};
+};
+
+} // END anonymous namespace
+
+optional<EventRecord> EventRecord::decode(QByteArrayView &data) {
+    Reader sizeReader{data};
+    uint32_t size;
+    if (!sizeReader.read(size) || qsizetype(size) > data.size() - 4) {
+        return {};
+    }
+    Reader r{data.sliced(4, size)};
+
+    EventRecord rec;
+    uint16_t event;
+    uint8_t argCnt;
+    int32_t warzone;
+    if (!r.read(rec.timeMs) || !r.read(event) || !r.read(argCnt)
+        || !r.read(rec.uid) || !r.read(warzone)) {
+        return {};
+    }
+    rec.event = static_cast<LogEvent>(event);
+    rec.warzone = warzone;
+    rec.args.reserve(argCnt);
+    for (int i = 0; i < argCnt; i++) {
+        uint8_t type;
+        if (!r.read(type)) {
+            return {};
+        }
+        switch (type) {
+        case EventLog::IntArg: {
+            int64_t v;
+            if (!r.read(v)) {
+                return {};
+            }
+            rec.args.emplace_back(v);
+            break;
+        }
+        case EventLog::DoubleArg: {
+            double v;
+            if (!r.read(v)) {
+                return {};
+            }
+            rec.args.emplace_back(v);
+            break;
+        }
+        case EventLog::StringArg: {
+            uint32_t len;
+            QByteArrayView bytes;
+            if (!r.read(len) || !r.readBytes(len, bytes)) {
+                return {};
+            }
+            rec.args.emplace_back(QString::fromUtf8(bytes));
+            break;
+        }
+        default:
+            return {};
+        }
+    }
+    if (!r.atEnd()) {
+        return {};
+    }
+    data = data.sliced(4 + size);
+    return rec;
+}
+
+
+QStringView TimePrefix::get(int64_t timeMs) {
+    int64_t sec = timeMs >= 0 ? timeMs / 1000 : (timeMs - 999) / 1000;
+    if (sec != second) {
+        second = sec;
+        QString s = QDateTime::fromSecsSinceEpoch(sec).toString(u"[yyyy/MM/dd hh:mm:ss] "_s);
+        length = std::min(s.size(), MaxLength);
+        std::copy_n(s.utf16(), length, text);
+    }
+    return QStringView{text, length};
+}
+
+
+static void appendInt(QString &out, int64_t val) {
+    char16_t buf[24];
+    char16_t *end = std::end(buf);
+    char16_t *p = end;
+    uint64_t v = val < 0 ? 0 - static_cast<uint64_t>(val) : static_cast<uint64_t>(val);
+    do {
+        *--p = static_cast<char16_t>(u'0' + v % 10);
+        v /= 10;
+    } while (v != 0);
+    if (val < 0) {
+        *--p = u'-';
+    }
+    out.append(reinterpret_cast<const QChar*>(p), end - p);
+}
+
+static void appendNumber(QString &out, double val, int precision = 2) {
+    char16_t buf[FormatNumberMaxLen];
+    out.append(reinterpret_cast<const QChar*>(buf), formatNumber(val, precision, buf));
+}
+
+QString EventFormatter::format(const EventRecord &rec) {
+    QString s;
+    formatTo(s, rec);
+    return s;
+}
+
+QString EventFormatter::formatMessage(const EventRecord &rec) {
+    QString s;
+    formatMessageTo(s, rec);
+    return s;
+}
+
+void EventFormatter::formatTo(QString &out, const EventRecord &rec) {
+    out += timePrefix.get(rec.timeMs);
+    formatMessageTo(out, rec);
+}
+
+void EventFormatter::observe(const EventRecord &rec) {
+    if (rec.event == LogEvent::Connected && rec.uid != 0) {
+        QString name = rec.stringArg(0);
+        auto it = usernames.find(rec.uid);
+        if (it == usernames.end() || *it != name) {
+            usernames.insert(rec.uid, name);
+            userPrefixes.remove(rec.uid);
+        }
+    }
+}
+
+const QString& EventFormatter::userPrefix(const EventRecord &rec) {
+    auto it = userPrefixes.find(rec.uid);
+    if (it == userPrefixes.end() || it->warzone != rec.warzone) {
+        QString name = usernames.value(rec.uid);
+        if (name.isEmpty() && rec.uid != 0) {
+            name = QString::number(rec.uid);
+        }
+        it = userPrefixes.insert(rec.uid, {rec.warzone, u"[S%1/%2] "_s.arg(rec.warzone).arg(name)});
+    }
+    return it->text;
+}
+
+void EventFormatter::formatMessageTo(QString &out, const EventRecord &rec) {
+    switch (rec.event) {
+    case LogEvent::Text:
+    case LogEvent::WarningText:
+        if (auto p = rec.args.empty() ? nullptr : std::get_if<QString>(&rec.args[0])) {
+            out += *p;
+        } else {
+            out += rec.stringArg(0);
+        }
+        return;
+    case LogEvent::Dropped:
+        out += u"……（日志过多，丢弃 "_s;
+        appendInt(out, rec.intArg(0));
+        out += u" 条）"_s;
+        return;
+    case LogEvent::ConnectFailed:
+        out += u"连接失败"_s;
+        return;
+    case LogEvent::ServerClosed:
+        out += userPrefix(rec);
+        out += u"服务器关闭了连接"_s;
+        return;
+    case LogEvent::Disconnected:
+        out += userPrefix(rec);
+        out += u"断开连接"_s;
+        return;
+    case LogEvent::Connected:
+        observe(rec);
+        out += userPrefix(rec);
+        out += u"连接成功"_s;
+        return;
+    case LogEvent::ChangeServerNoAccount:
+        out += u"切换战区：用户在战区 S"_s;
+        appendInt(out, rec.intArg(0));
+        out += u"无账号"_s;
+        return;
+    case LogEvent::DonateScience:
+        out += userPrefix(rec);
+        out += u"捐献联盟科技「"_s;
+        out += AllianceScience::toString(rec.intArg(0));
+        out += u"」"_s;
+        appendInt(out, rec.intArg(1));
+        out += u"次"_s;
+        return;
+    case LogEvent::DonateSite:
+        out += userPrefix(rec);
+        out += u"捐献「遗迹-"_s;
+        out += WorldSite::kindToString(WorldSite::siteToKind(rec.intArg(0)));
+        out += u"」1次"_s;
+        return;
+    case LogEvent::CollectCoin:
+        out += userPrefix(rec);
+        out += u"收取金币收割机，获得 "_s;
+        appendNumber(out, rec.doubleArg(0));
+        out += u" 金币"_s;
+        return;
+    case LogEvent::AdReward:
+        out += userPrefix(rec);
+        out += u"获取广告奖励 "_s;
+        appendInt(out, rec.intArg(0));
+        out += u" 钻石（今日已获取"_s;
+        appendInt(out, rec.intArg(1));
+        out += u"/20）"_s;
+        return;
+    case LogEvent::MysteryReward: {
+        out += userPrefix(rec);
+        out += u"获取神秘奖励 "_s;
+        int64_t gold = rec.intArg(0);
+        if (gold != 0) {
+            appendInt(out, gold);
+            out += u" 钻石"_s;
+        } else {
+            appendNumber(out, rec.doubleArg(1));
+            out += u" 金币"_s;
+        }
+        out += u"（今日已获取"_s;
+        appendInt(out, rec.intArg(2));
+        out += u"/5）"_s;
+        return;
+    }
+    case LogEvent::ConsumeCoinBusy:
+        out += userPrefix(rec);
+        out += u"添加金币消耗任务失败：已在执行中"_s;
+        return;
+    case LogEvent::DeepSeaCollect:
+        out += userPrefix(rec);
+        out += u"深海寻宝：收取"_s;
+        appendInt(out, rec.intArg(0) + 1);
+        out += u"号位"_s;
+        return;
+    case LogEvent::DeepSeaStart:
+        out += userPrefix(rec);
+        out += u"深海寻宝："_s;
+        appendInt(out, rec.intArg(0) + 1);
+        out += u"号位开始探索"_s;
+        return;
+    case LogEvent::CurrentCoin:
+        out += userPrefix(rec);
+        out += u"当前金币："_s;
+        appendNumber(out, rec.doubleArg(0), 4);
+        return;
+    case LogEvent::TrainDone:
+        out += userPrefix(rec);
+        out += u"训练完成"_s;
+        return;
+    case LogEvent::WxShareReward:
+        out += userPrefix(rec);
+        out += u"获取微信分享奖励："_s;
+        out += getItemName(rec.intArg(0));
+        out += u'x';
+        appendInt(out, rec.intArg(1));
+        return;
+    case LogEvent::ShareBoxHelped:
+        out += userPrefix(rec);
+        out += u"天降宝箱帮助成功"_s;
+        return;
+    case LogEvent::ShareBoxOpened: {
+        out += userPrefix(rec);
+        out += u"打开"_s;
+        appendInt(out, rec.intArg(0));
+        out += u"星天降宝箱获得："_s;
+        int64_t gold = rec.intArg(1);
+        if (gold != 0) {
+            appendInt(out, gold);
+            out += u"钻石"_s;
+        } else {
+            out += getItemName(rec.intArg(2));
+            out += u'x';
+            appendInt(out, rec.intArg(3));
+        }
+        return;
+    }
+    case LogEvent::EventCount:
+        break;
+    }
+    out += u"<未知事件 "_s;
+    appendInt(out, static_cast<int>(rec.event));
+    out += u'>';
+}
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <QString>
+#include <QHash>
+#include <QtEndian>
+#include <QStringEncoder>
+#include <variant>
+#include <limits>
+#include "common.h"
+
+/**
+ * Binary structured log records.
+ *
+ * An event is recorded as its id, the account (uid, warzone) and typed
+ * arguments, without formatting anything. Text is made only when a record is
+ * shown in the UI or decoded by the TopwarLogDump tool, see EventFormatter.
+ *
+ * Record layout, little endian:
+ *   u32 size of the rest of the record
+ *   i64 time (ms since epoch), u16 event, u8 arg count, i64 uid, i32 warzone
+ *   per arg: u8 type, then i64 | f64 | (u32 length, UTF-8 bytes)
+ * Log files start with EventLogMagic, followed by records.
+ *
+ * Events are only appended, never renumbered, so that old files stay readable.
+ */
+enum class LogEvent: uint16_t {
+    Text = 0,           // (QString line)
+    Dropped,            // (count)
+    ConnectFailed,
+    ServerClosed,
+    Disconnected,
+    Connected,          // (username)
+    ChangeServerNoAccount, // (serverId)
+    DonateScience,      // (scienceId, times)
+    DonateSite,         // (siteId)
+    CollectCoin,        // (coin)
+    AdReward,           // (gold, timesToday)
+    MysteryReward,      // (gold, coin, timesToday)
+    ConsumeCoinBusy,
+    DeepSeaCollect,     // (slotIdx)
+    DeepSeaStart,       // (slotIdx)
+    CurrentCoin,        // (coin)
+    TrainDone,
+    WxShareReward,      // (itemId, count)
+    ShareBoxHelped,
+    ShareBoxOpened,     // (level, gold, itemId, count)
+    WarningText,        // (QString line)
+
+    EventCount
+};
+
+enum class LogSeverity {
+    Info,
+    Warning
+};
+
+constexpr QByteArrayView EventLogMagic{"TWEVLOG1"};
+
+namespace EventLog {
+
+enum ArgType: uint8_t {
+    IntArg = 1,
+    DoubleArg = 2,
+    StringArg = 3
+};
+
+const char* eventName(LogEvent event);
+optional<LogEvent> eventFromName(QStringView name);
+LogSeverity severityOf(LogEvent event);
+
+namespace detail {
+
+template <class T>
+inline void putRaw(QByteArray &buf, T val) {
+    val = qToLittleEndian(val);
+    buf.append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+inline void putArg(QByteArray &buf, std::integral auto val) {
+    buf.append(char(IntArg));
+    putRaw<int64_t>(buf, val);
+}
+
+inline void putArg(QByteArray &buf, std::floating_point auto val) {
+    buf.append(char(DoubleArg));
+    putRaw<double>(buf, val);
+}
+
+inline void putArg(QByteArray &buf, QStringView val) {
+    buf.append(char(StringArg));
+    qsizetype lenPos = buf.size();
+    putRaw<uint32_t>(buf, 0);
+    qsizetype start = buf.size();
+    // encoded in place, without a temporary QByteArray
+    QStringEncoder encoder{QStringEncoder::Utf8, QStringConverter::Flag::Stateless};
+    buf.resize(start + encoder.requiredSpace(val.size()));
+    char *end = encoder.appendToBuffer(buf.data() + start, val);
+    buf.resize(end - buf.constData());
+    qToLittleEndian<uint32_t>(buf.size() - start, buf.data() + lenPos);
+}
+
+} // END namespace detail
+
+/**
+ * Encodes a record into buf, replacing its content.
+ * Arguments are integers, floating point numbers and strings.
+ */
+template <class... Args>
+void encode(QByteArray &buf, int64_t timeMs, LogEvent event, int64_t uid, int warzone, const Args&... args) {
+    buf.resize(0);
+    detail::putRaw<uint32_t>(buf, 0);
+    detail::putRaw<int64_t>(buf, timeMs);
+    detail::putRaw<uint16_t>(buf, static_cast<uint16_t>(event));
+    detail::putRaw<uint8_t>(buf, sizeof...(Args));
+    detail::putRaw<int64_t>(buf, uid);
+    detail::putRaw<int32_t>(buf, warzone);
+    (detail::putArg(buf, args), ...);
+    qToLittleEndian<uint32_t>(buf.size() - 4, buf.data());
+}
+
+} // END namespace EventLog
+
+
+struct EventRecord {
+    using Arg = std::variant<int64_t, double, QString>;
+
+    int64_t timeMs{0};
+    LogEvent event{LogEvent::Text};
+    int64_t uid{0};
+    int warzone{0};
+    std::vector<Arg> args;
+
+    int64_t intArg(size_t i) const;
+    double doubleArg(size_t i) const;
+    QString stringArg(size_t i) const;
+
+    /**
+     * Decodes the record at the front of data and removes it from data.
+     * Returns nullopt if data is truncated or corrupt.
+     */
+    static optional<EventRecord> decode(QByteArrayView &data);
+};
+
+
+/**
+ * Makes the "[yyyy/MM/dd hh:mm:ss] " prefix of log lines. The text is made
+ * once per second, lines within the same second only copy it.
+ */
+class TimePrefix
+{
+public:
+    static constexpr qsizetype MaxLength = 32;
+
+    QStringView get(int64_t timeMs);
+
+private:
+    int64_t second{std::numeric_limits<int64_t>::min()};
+    char16_t text[MaxLength]{};
+    qsizetype length{0};
+};
+
+
+/**
+ * Formats records into log lines. Usernames are remembered from the
+ * Connected events, so records must be formatted in order.
+ *
+ * The *To() functions append to a buffer of the caller and allocate nothing
+ * once it has grown: the time and account prefixes are cached, numbers are
+ * written in place.
+ */
+class EventFormatter
+{
+public:
+    QString format(const EventRecord &rec);
+
+    // Returns the message without the time prefix
+    QString formatMessage(const EventRecord &rec);
+
+    void formatTo(QString &out, const EventRecord &rec);
+    void formatMessageTo(QString &out, const EventRecord &rec);
+
+    // Takes the state (usernames) from a record that is not formatted
+    void observe(const EventRecord &rec);
+
+private:
+    struct UserPrefix {
+        int warzone{0};
+        QString text;
+    };
+
+    const QString& userPrefix(const EventRecord &rec);
+
+    QHash<int64_t, QString> usernames;
+    // "[S<warzone>/<username>] " per uid, made again when the warzone or username changes
+    QHash<int64_t, UserPrefix> userPrefixes;
+    TimePrefix timePrefix;
+};
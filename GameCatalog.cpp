@@ -0,0 +1,177 @@
+#include <QtCore>
+#include "GameCatalog.h"
+
+constexpr qsizetype ItemSize = 12;
+constexpr qsizetype ScienceSize = 16;
+constexpr qsizetype SiteSize = 8;
+
+namespace {
+
+int32_t readI32(const uchar *p) {
+    return qFromLittleEndian<int32_t>(p);
+}
+
+uint32_t readU32(const uchar *p) {
+    return qFromLittleEndian<uint32_t>(p);
+}
+
+} // END anonymous namespace
+
+GameCatalog& GameCatalog::instance() {
+    static GameCatalog catalog;
+    return catalog;
+}
+
+GameCatalog::~GameCatalog() {
+    unload();
+}
+
+void GameCatalog::unload() {
+    if (data != nullptr) {
+        file.unmap(const_cast<uchar*>(data));
+        data = nullptr;
+    }
+    file.close();
+    items = {};
+    sciences = {};
+    sites = {};
+    strings = nullptr;
+    stringsSize = 0;
+}
+
+bool GameCatalog::load(const QString &filePath) {
+    unload();
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "no game catalog at" << filePath << ", using the built-in tables";
+        return false;
+    }
+    qint64 size = file.size();
+    const uchar *mapped = size >= GameCatalogHeaderSize ? file.map(0, size) : nullptr;
+    if (mapped == nullptr || !validate(mapped, size)) {
+        qDebug() << "invalid game catalog" << filePath << ", using the built-in tables";
+        if (mapped != nullptr) {
+            file.unmap(const_cast<uchar*>(mapped));
+        }
+        unload();
+        return false;
+    }
+    data = mapped;
+    qDebug() << "game catalog loaded:" << items.count << "items," << sciences.count << "sciences,"
+             << sites.count << "sites";
+    return true;
+}
+
+bool GameCatalog::validate(const uchar *mapped, qint64 size) {
+    // the strings are used in place as UTF-16 little endian
+    if (QSysInfo::ByteOrder != QSysInfo::LittleEndian) {
+        return false;
+    }
+    if (QByteArrayView{mapped, GameCatalogMagic.size()} != GameCatalogMagic
+        || readU32(mapped + 8) != GameCatalogVersion) {
+        return false;
+    }
+    auto table = [&](qint64 headerPos, qsizetype recordSize, Table &out) {
+        uint32_t count = readU32(mapped + headerPos);
+        uint32_t offset = readU32(mapped + headerPos + 4);
+        if (offset % 4 != 0 || offset < GameCatalogHeaderSize || offset + qint64(count) * recordSize > size) {
+            return false;
+        }
+        out = {mapped + offset, count};
+        return true;
+    };
+    if (!table(12, ItemSize, items) || !table(20, ScienceSize, sciences) || !table(28, SiteSize, sites)) {
+        return false;
+    }
+    uint32_t stringsOffset = readU32(mapped + 36);
+    stringsSize = readU32(mapped + 40);
+    if (stringsOffset % 4 != 0 || stringsOffset < GameCatalogHeaderSize || stringsOffset + qint64(stringsSize) * 2 > size) {
+        return false;
+    }
+    strings = reinterpret_cast<const char16_t*>(mapped + stringsOffset);
+
+    // sorted by id, names in the pool
+    auto check = [&](const Table &t, qsizetype recordSize, qsizetype nameRefPos) {
+        for (uint32_t i = 0; i < t.count; i++) {
+            const uchar *rec = t.begin + i * recordSize;
+            if (i > 0 && readI32(rec - recordSize) >= readI32(rec)) {
+                return false;
+            }
+            if (nameRefPos >= 0) {
+                uint32_t offset = readU32(rec + nameRefPos);
+                uint32_t len = readU32(rec + nameRefPos + 4);
+                if (offset > stringsSize || len > stringsSize - offset) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+    return check(items, ItemSize, 4) && check(sciences, ScienceSize, 8) && check(sites, SiteSize, -1);
+}
+
+const uchar* GameCatalog::find(const Table &table, qsizetype recordSize, int id) const {
+    uint32_t lo = 0;
+    uint32_t hi = table.count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        const uchar *rec = table.begin + mid * recordSize;
+        int32_t recId = readI32(rec);
+        if (recId == id) {
+            return rec;
+        }
+        if (recId < id) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return nullptr;
+}
+
+optional<int> GameCatalog::findByName(const Table &table, qsizetype recordSize, qsizetype nameRefPos,
+                                      QStringView name) const {
+    for (uint32_t i = 0; i < table.count; i++) {
+        const uchar *rec = table.begin + i * recordSize;
+        if (string(rec + nameRefPos) == name) {
+            return readI32(rec);
+        }
+    }
+    return {};
+}
+
+QStringView GameCatalog::string(const uchar *ref) const {
+    return QStringView{strings + readU32(ref), qsizetype(readU32(ref + 4))};
+}
+
+QStringView GameCatalog::itemName(int itemId) const {
+    const uchar *rec = find(items, ItemSize, itemId);
+    return rec != nullptr ? string(rec + 4) : QStringView{};
+}
+
+QStringView GameCatalog::scienceName(int scienceId) const {
+    const uchar *rec = find(sciences, ScienceSize, scienceId);
+    return rec != nullptr ? string(rec + 8) : QStringView{};
+}
+
+optional<int> GameCatalog::scienceMaxLevel(int scienceId) const {
+    if (const uchar *rec = find(sciences, ScienceSize, scienceId)) {
+        return readI32(rec + 4);
+    }
+    return {};
+}
+
+optional<int> GameCatalog::siteKind(int siteId) const {
+    if (const uchar *rec = find(sites, SiteSize, siteId)) {
+        return readI32(rec + 4);
+    }
+    return {};
+}
+
+optional<int> GameCatalog::itemIdFromName(QStringView name) const {
+    return findByName(items, ItemSize, 4, name);
+}
+
+optional<int> GameCatalog::scienceIdFromName(QStringView name) const {
+    return findByName(sciences, ScienceSize, 8, name);
+}
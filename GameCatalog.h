@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QFile>
+#include <QStringView>
+#include "common.h"
+
+constexpr QByteArrayView GameCatalogMagic{"TWCAT001"};
+constexpr uint32_t GameCatalogVersion = 1;
+constexpr qint64 GameCatalogHeaderSize = 44;
+
+/**
+ * Game data tables (items, alliance sciences, world sites), read from a
+ * binary file made by TopwarIdsGen. While it is not loaded, TopwarIds uses
+ * the tables built in from the same snapshot instead.
+ *
+ * File layout, little endian, each table starting at a multiple of 4:
+ *   header: GameCatalogMagic, u32 format version,
+ *           u32 count + u32 offset of the items, sciences and sites tables,
+ *           u32 offset + u32 size in characters of the string pool
+ *   item:    i32 id, u32 name offset, u32 name length
+ *   science: i32 id, i32 max level, u32 name offset, u32 name length
+ *   site:    i32 site id, i32 kind (WorldSite::种类)
+ *   string pool: UTF-16, each distinct string stored once; name offsets and
+ *                lengths are in characters
+ * The tables are sorted by id, a lookup is a binary search.
+ *
+ * The file is mapped read-only and never copied, so the whole game data costs
+ * no heap, and the pages are shared by every process mapping the same file.
+ * Names point into the mapping. load() checks every table and string range
+ * once, the lookups then trust the file.
+ *
+ * load() must be called once, before other threads use the catalog. The
+ * lookups are thread-safe, the names they return stay valid until exit.
+ */
+class GameCatalog
+{
+public:
+    static GameCatalog& instance();
+
+    ~GameCatalog();
+
+    // Returns false if the file is missing or invalid, the catalog is then empty
+    bool load(const QString &filePath);
+    bool isLoaded() const { return data != nullptr; }
+
+    // Empty when unknown
+    QStringView itemName(int itemId) const;
+    QStringView scienceName(int scienceId) const;
+    optional<int> scienceMaxLevel(int scienceId) const;
+    optional<int> siteKind(int siteId) const;
+    // The lowest id of that name. A scan of the table, not for hot paths
+    optional<int> itemIdFromName(QStringView name) const;
+    optional<int> scienceIdFromName(QStringView name) const;
+
+private:
+    struct Table {
+        const uchar *begin{nullptr};
+        uint32_t count{0};
+    };
+
+    GameCatalog() = default;
+    void unload();
+    bool validate(const uchar *mapped, qint64 size);
+    // The record with id in table, nullptr if none
+    const uchar* find(const Table &table, qsizetype recordSize, int id) const;
+    // The id of the first record named name
+    optional<int> findByName(const Table &table, qsizetype recordSize, qsizetype nameRefPos, QStringView name) const;
+    QStringView string(const uchar *ref) const;
+
+    QFile file;
+    const uchar *data{nullptr};
+    Table items;
+    Table sciences;
+    Table sites;
+    const char16_t *strings{nullptr};
+    uint32_t stringsSize{0};
+};
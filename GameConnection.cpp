@@ -1,10 +1,17 @@
 #include <QtEndian>
 #include <QJsonDocument>
+#include <QElapsedTimer>
+#include <QScopeGuard>
 #include <cmath>
 #include "GameConnection.h"
 #include "HttpRqst.h"
 #include "log.h"
 
+template <class... Args>
+void GameConnection::logEvent(LogEvent event, const Args&... args) const {
+    ::logEvent(event, gameUid, getWarzone(), args...);
+}
+
 constexpr int BinaryDataPackFormatJson = 0;
 constexpr int BinaryDataPackFormatProtobuf = 1;
 
@@ -73,23 +80,30 @@ std::optional<AppMessage> AppMessage::decode(QBuffer &buffer, int &bytesRequired
 GameConnection::GameConnection() {}
 
 GameConnection::GameConnection(const QString &gameVer, const GameSessionInfo &sessionInfo)
-    : gameVersion{gameVer}, sessionInfo{sessionInfo}, webSock{u"https://warh5.rivergame.net"_s}
+    : GameConnection{sessionInfo}
+{
+    setGameVersion(gameVer);
+}
+
+GameConnection::GameConnection(const GameSessionInfo &sessionInfo)
+    : sessionInfo{sessionInfo}, webSock{u"https://warh5.rivergame.net"_s}
 {
     connect(&webSock, &QWebSocket::connected, this, [this] {
         connected = true;
-        sendLogin();
+        trySendLogin();
         heartbeatTimer.start();
     });
 
     connect(&webSock, &QWebSocket::disconnected, this, [this] {
         if (!connected) {
-            log() << u"连接失败"_s;
+            logEvent(LogEvent::ConnectFailed);
         } else if (isClosedByServer) {
-            log() << userDesc() << u"服务器关闭了连接"_s;
+            logEvent(LogEvent::ServerClosed);
         } else if (getWarzone() != 0) {
-            log() << userDesc() << u"断开连接"_s;
+            logEvent(LogEvent::Disconnected);
         }
         connected = false;
+        loginSent = false;
 
         if (changeServerSession == nullptr) {
             emit connectionClosed();
@@ -135,6 +149,21 @@ GameConnection::GameConnection(const QString &gameVer, const GameSessionInfo &se
     heartbeatTimer.callOnTimeout(this, &GameConnection::sendHeartbeat);
 }
 
+void GameConnection::setGameVersion(const QString &gameVer) {
+    gameVersion = gameVer;
+    trySendLogin();
+}
+
+const QString& GameConnection::getGameVersion() const {
+    return gameVersion;
+}
+
+void GameConnection::relogin(const QString &gameVer) {
+    gameVersion = gameVer;
+    loginSent = false;
+    trySendLogin();
+}
+
 void GameConnection::reConnect(const QString &serverUrl) {
     callbackBySeq.clear();
     rqstCnt = 0;
@@ -174,8 +203,16 @@ int64_t GameConnection::getAllianceId() const {
     return userInfo[u"allianceInfo"_s][u"aid"_s].toInteger();
 }
 
-QString GameConnection::userDesc() const {
-    return u"[S%1/%2] "_s.arg(getWarzone()).arg(getUsername());
+int GameConnection::getAllianceDonateNum() const {
+    return allianceDonateNum;
+}
+
+int GameConnection::getAllianceWorldSiteDonateNum() const {
+    return allianceWorldSiteDonateNum;
+}
+
+nanoseconds GameConnection::getBusyTime() const {
+    return busyTime;
 }
 
 void GameConnection::sendRequest(int rqstId, const QJsonObject &rqstData,
@@ -204,6 +241,10 @@ void GameConnection::registerCallback(int rqstId, ResponseCallback callback) {
 }
 
 void GameConnection::processBinaryMessage(const QByteArray &data) {
+    QElapsedTimer elapsed;
+    elapsed.start();
+    auto guard = qScopeGuard([&]{ busyTime += nanoseconds{elapsed.nsecsElapsed()}; });
+
     recvBuffer.append(data);
     if (recvBuffer.size() < nextBytesRequired) {
         return;
@@ -230,6 +271,9 @@ void GameConnection::processBinaryMessage(const QByteArray &data) {
     if (msg->data[u"s"_s].toInt() == 3) {
         qDebug() << "wss recv error resp." << "seq:" << msg->seq
                  << "rqstId:" << rqstIdToString(msg->rqstId) << "content:" << respData;
+        if (msg->rqstId == TopwarRqstId::LOGIN) {
+            emit loginRejected();
+        }
         return; // currently error callback is not provided
     }
     if (msg->rqstId == -1) {
@@ -259,6 +303,15 @@ void GameConnection::sendHeartbeat() {
     sendRequest(TopwarRqstId::NO_QUEUE_HEART, {});
 }
 
+// The socket handshake and the version lookup run in parallel, LOGIN needs both
+void GameConnection::trySendLogin() {
+    if (!connected || loginSent || gameVersion.isEmpty()) {
+        return;
+    }
+    loginSent = true;
+    sendLogin();
+}
+
 void GameConnection::sendLogin() {
     int serverId = sessionInfo.serverId;
     if (userInfo[u"isCross"_s].toInt() == 1) {
@@ -292,6 +345,7 @@ void GameConnection::sendLogin() {
 
 void GameConnection::recvLoginResponse(const QJsonObject &resp) {
     userInfo = resp;
+    gameUid = resp[u"gameUid"_s].toInteger();
     if (userInfo[u"isCross"_s].toInt() == 1) {
         changeServerSession = make_unique<GameSessionInfo>(sessionInfo);
         changeServerSession->serverId = resp[u"sid"_s].toInt();
@@ -300,7 +354,7 @@ void GameConnection::recvLoginResponse(const QJsonObject &resp) {
         return;
     }
 
-    log() << userDesc() << u"连接成功"_s;
+    logEvent(LogEvent::Connected, getUsername());
 
     constexpr int AutoCollectBuildingId = 1801;
     for (const auto buildings = resp[u"buildings"_s].toArray(); const auto obj : buildings) {
@@ -349,6 +403,33 @@ void GameConnection::sendChangeServer(int serverId, int64_t uid, ResponseCallbac
     sendRequest(TopwarRqstId::CHANGE_SERVER, data, callback);
 }
 
+void GameConnection::refreshSessionToken(Callback<bool> onFinished) {
+    int serverId = sessionInfo.serverId;
+    sendGetUserServerList([this, serverId, onFinished](auto &&resp) {
+        int64_t uid = 0;
+        for (const auto &obj : resp[u"serverList"_s].toArray()) {
+            if (obj[u"serverId"_s].toInt() == serverId) {
+                uid = obj[u"uid"_s].toInteger();
+                break;
+            }
+        }
+        if (uid == 0) {
+            onFinished(false);
+            return;
+        }
+        sendChangeServer(serverId, uid, [this, onFinished](auto &&resp) {
+            QString token = resp[u"serverInfoToken"_s].toString();
+            if (token.isEmpty()) {
+                onFinished(false);
+                return;
+            }
+            sessionInfo.serverInfoToken = token;
+            sessionInfo.tokenTime = QDateTime::currentMSecsSinceEpoch();
+            onFinished(true);
+        });
+    });
+}
+
 void GameConnection::changeServer(int serverId) {
     sendGetUserServerList([this, serverId](auto &&resp) {
         int64_t uid = 0;
@@ -359,7 +440,7 @@ void GameConnection::changeServer(int serverId) {
             }
         }
         if (uid == 0) {
-            log() << u"切换战区：用户在战区 S"_s << serverId << u"无账号"_s;
+            logEvent(LogEvent::ChangeServerNoAccount, serverId);
             return;
         }
 
@@ -382,6 +463,7 @@ void GameConnection::changeServer(int serverId, int64_t uid, const QString &serv
     changeServerSession->tempId = sessionInfo.tempId;
     sendChangeServer(serverId, uid, [this](auto &&resp) {
         changeServerSession->serverInfoToken = resp[u"serverInfoToken"_s].toString();
+        changeServerSession->tokenTime = QDateTime::currentMSecsSinceEpoch();
         changeServerReConnect();
     });
 }
@@ -411,30 +493,31 @@ void GameConnection::sendGetAllianceScienceInfo(ResponseCallback callback) {
     sendRequest(TopwarRqstId::ALLIANCE_GET_SCIENCE, {}, std::move(callback));
 }
 
-void GameConnection::sendAllianceDonateScience(int scienceId, int times) {
+void GameConnection::sendAllianceDonateScience(int scienceId, int times, Callback<> onDonated) {
     QJsonObject data{
         {u"scienceId"_s, scienceId},
         {u"type"_s, 1},
         {u"num"_s, times}
     };
-    sendRequest(TopwarRqstId::ALLIANCE_DOANTE_SCIENCE, data, [this, scienceId, times](auto &&resp) {
-        log() << userDesc() << u"捐献联盟科技「"_s
-              << AllianceScience::toString(scienceId) << u"」"_s
-              << times << u"次"_s;
+    sendRequest(TopwarRqstId::ALLIANCE_DOANTE_SCIENCE, data, [scienceId, times, onDonated](auto &&resp) {
+        logEvent(LogEvent::DonateScience, scienceId, times);
+        if (onDonated) {
+            onDonated();
+        }
     });
 }
 
-void GameConnection::donateAllianceScience(int scienceId) {
+void GameConnection::donateAllianceScience(int scienceId, Callback<> onDonated) {
     if (scienceId == AllianceScience::快速作战) {
         for (int i = 0; i < allianceDonateGoldNum / 10 + 1; i++) {
-            QTimer::singleShot(100ms * i, this, [this, scienceId]{
-                sendAllianceDonateScience(scienceId, 10);
+            QTimer::singleShot(100ms * i, this, [this, scienceId, onDonated]{
+                sendAllianceDonateScience(scienceId, 10, onDonated);
             });
         }
     } else {
         for (int i = 0; i < allianceDonateNum; i++) {
-            QTimer::singleShot(100ms * i, this, [this, scienceId]{
-                sendAllianceDonateScience(scienceId, 1);
+            QTimer::singleShot(100ms * i, this, [this, scienceId, onDonated]{
+                sendAllianceDonateScience(scienceId, 1, onDonated);
             });
         }
     }
@@ -453,8 +536,7 @@ void GameConnection::donateWorldSite(int siteId) {
                 {u"type"_s, 1}
             };
             sendRequest(TopwarRqstId::WORLDSITE_DONATE, data, [this, siteId](auto &&resp) {
-                auto&& kindStr = WorldSite::kindToString(WorldSite::siteToKind(siteId));
-                log() << userDesc() << u"捐献「遗迹-"_s << kindStr << u"」1次"_s;
+                logEvent(LogEvent::DonateSite, siteId);
             });
         });
     }
@@ -465,9 +547,7 @@ void GameConnection::executeAutoCollectMachine() {
         return;
     }
     sendRequest(TopwarRqstId::GET_ORDER, {{u"id"_s, autoCollectMachineId}}, [this](auto &&resp) {
-        log() << userDesc() << u"收取金币收割机，获得 "_s
-              << formatNumber(resp[u"reward"_s][u"resource"_s][u"coin"_s].toDouble())
-              << u" 金币"_s;
+        logEvent(LogEvent::CollectCoin, resp[u"reward"_s][u"resource"_s][u"coin"_s].toDouble());
     });
 }
 
@@ -480,9 +560,7 @@ void GameConnection::obtainVideoReward() {
     sendRequest(TopwarRqstId::VideoRewardGet, data, [this](auto &&resp) {
         int obtainedTimesToday = resp[u"dayGoldVideoCount"_s].toInt();
         userInfo[u"dayGoldVideoCount"_s] = obtainedTimesToday;
-        log() << userDesc() << u"获取广告奖励 "_s
-              << resp[u"resource"_s][u"resource"_s][u"gold"_s].toInt() << u" 钻石"_s
-              << u"（今日已获取"_s << obtainedTimesToday << u"/20）"_s;
+        logEvent(LogEvent::AdReward, resp[u"resource"_s][u"resource"_s][u"gold"_s].toInt(), obtainedTimesToday);
     });
 }
 
@@ -492,15 +570,13 @@ void GameConnection::obtainSecretTreasure() {
         double coin = resp[u"reward"_s][u"resource"_s][u"coin"_s].toDouble();
         int obtainedTimesToday = resp[u"secretTreasure"_s].toInt();
         userInfo[u"secretTreasure"_s] = obtainedTimesToday;
-        log() << userDesc() << u"获取神秘奖励 "_s
-              << (gold != 0 ? (QString::number(gold) + u" 钻石"_s) : (formatNumber(coin) + u" 金币"_s))
-              << u"（今日已获取"_s << obtainedTimesToday << u"/5）"_s;
+        logEvent(LogEvent::MysteryReward, gold, coin, obtainedTimesToday);
     });
 }
 
 void GameConnection::consumeCoinByTrainArmy(QJsonObject bathBuildData, double coinToconsume) {
     if (consumeTarget != 0) {
-        log() << userDesc() << u"添加金币消耗任务失败：已在执行中"_s;
+        logEvent(LogEvent::ConsumeCoinBusy);
         return;
     }
     this->bathBuildData = bathBuildData;
@@ -514,7 +590,7 @@ void GameConnection::obtainAwardExploreSea(int activityId, int slotIdx, bool res
         {u"index"_s, slotIdx}
     };
     sendRequest(TopwarRqstId::AWARD_EXPLORE_SEA, data, [=, this](auto &&resp) {
-        log() << userDesc() << u"深海寻宝：收取"_s << slotIdx + 1 << u"号位"_s;
+        logEvent(LogEvent::DeepSeaCollect, slotIdx);
         if (restart) {
             startExploreSea(activityId, slotIdx);
         }
@@ -527,7 +603,7 @@ void GameConnection::startExploreSea(int activityId, int slotIdx) {
         {u"index"_s, slotIdx}
     };
     sendRequest(TopwarRqstId::START_EXPLORE_SEA, data, [this, slotIdx](auto &&resp) {
-        log() << userDesc() << u"深海寻宝："_s << slotIdx + 1 << u"号位开始探索"_s;
+        logEvent(LogEvent::DeepSeaStart, slotIdx);
     });
 }
 
@@ -551,12 +627,12 @@ void GameConnection::sendDeleteTrainingArmy() {
 
 void GameConnection::sendBatchBuild() {
     double coin = userInfo[u"resource"_s][u"coin"_s].toDouble();
-    log() << userDesc() << u"当前金币："_s << formatNumber(coin, 4);
+    logEvent(LogEvent::CurrentCoin, coin);
     if (coin > consumeTarget) {
         sendRequest(TopwarRqstId::BATCH_BUILD_ORDER, bathBuildData);
     } else {
         consumeTarget = 0;
-        log() << userDesc() << u"训练完成"_s;
+        logEvent(LogEvent::TrainDone);
     }
 }
 
@@ -577,13 +653,13 @@ void GameConnection::obtainWxShareReward() {
         auto rewardItem = resp[u"reward"_s][u"items"_s].toArray().first();
         int itemId = rewardItem["itemId"].toInt();
         int count = rewardItem["itemCount"].toInt();
-        log() << userDesc() << u"获取微信分享奖励："_s << getItemName(itemId) << "x" << count;
+        logEvent(LogEvent::WxShareReward, itemId, count);
     });
 }
 
 void GameConnection::sendClickShareBox(const QJsonObject &shareBox) {
     sendRequest(TopwarRqstId::ClickSharebox, shareBox, [this](const QJsonObject &resp) {
-        log() << userDesc() << u"天降宝箱帮助成功"_s;
+        logEvent(LogEvent::ShareBoxHelped);
     });
 }
 
@@ -595,15 +671,14 @@ void GameConnection::sendGetShareBoxReward(int level, int boxId) {
     };
     sendRequest(TopwarRqstId::GET_SHAREBOX_ACTIVITY_REWARD, data, [this,level](const QJsonObject &resp) {
         const auto reward = resp[u"reward"_s].toObject();
-        QString rewardStr;
-        if (int gold = reward[u"resource"_s][u"gold"_s].toInt(); gold != 0) {
-            rewardStr = u"%1钻石"_s.arg(gold);
-        } else {
+        int gold = reward[u"resource"_s][u"gold"_s].toInt();
+        int itemId = 0;
+        int count = 0;
+        if (gold == 0) {
             const auto item = reward[u"items"_s].toArray().first().toObject();
-            int itemId = item[u"itemId"_s].toInt();
-            int count = item[u"itemCount"_s].toInt();
-            rewardStr = u"%1x%2"_s.arg(getItemName(itemId)).arg(count);
+            itemId = item[u"itemId"_s].toInt();
+            count = item[u"itemCount"_s].toInt();
         }
-        log() << userDesc() << u"打开%1星天降宝箱获得："_s.arg(level) << rewardStr;
+        logEvent(LogEvent::ShareBoxOpened, level, gold, itemId, count);
     });
 }
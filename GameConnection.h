@@ -8,6 +8,8 @@
 #include "GameSessionRqst.h"
 #include "TopwarIds.h"
 
+enum class LogEvent: uint16_t;
+
 class AppMessage {
 public:
     int seq;
@@ -28,6 +30,15 @@ public:
     GameConnection();
     GameConnection(const QString &gameVer, const GameSessionInfo &sessionInfo);
 
+    // Opens the connection right away. LOGIN is sent once the game version is set.
+    explicit GameConnection(const GameSessionInfo &sessionInfo);
+
+    void setGameVersion(const QString &gameVer);
+    const QString& getGameVersion() const;
+
+    // Sends LOGIN again with another game version, e.g. after loginRejected
+    void relogin(const QString &gameVer);
+
     const GameSessionInfo& getSessionInfo() const;
     QWebSocket& getWebSocket();
     SteadyTimepoint getLastRqstTimepoint() const;
@@ -36,6 +47,9 @@ public:
     int getWarzone() const;
     QString getUsername() const;
     int64_t getAllianceId() const;
+    int getAllianceDonateNum() const;
+    int getAllianceWorldSiteDonateNum() const;
+    nanoseconds getBusyTime() const;
 
     using ResponseCallback = std::function<void(const QJsonObject &resp)>;
     void sendRequest(int rqstId, const QJsonObject &rqstData, ResponseCallback callback={});
@@ -44,16 +58,24 @@ public:
     void sendGetUserServerList(ResponseCallback callback);
     void sendChangeServer(int serverId, int64_t uid, ResponseCallback callback);
     void sendGetAllianceScienceInfo(ResponseCallback callback);
-    void sendAllianceDonateScience(int scienceId, int times);
+    void sendAllianceDonateScience(int scienceId, int times, Callback<> onDonated = {});
     void sendGetWorldSiteInfo(ResponseCallback callback);
     void sendGetActivityData(ResponseCallback callback);
     void sendNotifyWxShare(ResponseCallback callback);
     void sendClickShareBox(const QJsonObject &shareBox);
     void sendGetShareBoxReward(int level, int boxId);
 
+    /**
+     * Gets a new serverInfoToken for the current server without reconnecting,
+     * so that the next login uses a fresh one. onFinished is not called if the
+     * server does not respond.
+     */
+    void refreshSessionToken(Callback<bool> onFinished);
+
     void changeServer(int serverId);
     void changeServer(int serverId, int64_t uid, const QString &serverUrl);
-    void donateAllianceScience(int scienceId);
+    // onDonated is called for each donation the server accepts
+    void donateAllianceScience(int scienceId, Callback<> onDonated = {});
     void donateWorldSite(int siteId);
     void executeAutoCollectMachine();
     void obtainVideoReward();
@@ -65,12 +87,17 @@ public:
 
 signals:
     void loginSucceeded();
+    // The server responds LOGIN with an error, e.g. because the game version is outdated
+    void loginRejected();
     void connectionClosed();
 
 private:
-    QString userDesc() const;
+    // Records event of this account, see EventLog.h
+    template <class... Args>
+    void logEvent(LogEvent event, const Args&... args) const;
 
     void sendLogin();
+    void trySendLogin();
     void sendHeartbeat();
     void processBinaryMessage(const QByteArray &msg);
     void recvLoginResponse(const QJsonObject &resp);
@@ -90,16 +117,19 @@ private:
     milliseconds heartbeatInterval{10'000ms};
     QTimer heartbeatTimer;
     bool connected{false};
+    bool loginSent{false};
     bool isClosedByServer{false};
 
     int rqstCnt{0};
     int nextBytesRequired{0};
     SteadyTimepoint lastRqstTimepoint;
     milliseconds lastServerTime;
+    nanoseconds busyTime{0};
     std::map<int, ResponseCallback> callbackBySeq;
     std::map<int, ResponseCallback> callbackByRqstId;
 
     QJsonObject userInfo;
+    int64_t gameUid{0};
     unique_ptr<GameSessionInfo> changeServerSession;
 
     QString autoCollectMachineId;
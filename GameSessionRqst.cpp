@@ -10,6 +10,14 @@ static QNetworkRequest makeTwRqst(const QString &url) {
     return rqst;
 }
 
+// The name of a hashed asset changes with its content, so a cached copy is always valid.
+// Only for replies read to the end: the disk cache drops the entry of an aborted reply
+static QNetworkRequest makeTwAssetRqst(const QString &url) {
+    QNetworkRequest rqst = makeTwRqst(url);
+    rqst.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::PreferCache);
+    return rqst;
+}
+
 static QNetworkRequest makeTwRqst(const QString &baseUrl, const QUrlQuery &params) {
     QUrl url{baseUrl};
     url.setQuery(params);
@@ -17,11 +25,13 @@ static QNetworkRequest makeTwRqst(const QString &baseUrl, const QUrlQuery &param
     rqst.setRawHeader("Referer"_ba, "https://warh5.rivergame.net/webgame/index.html"_ba);
     rqst.setRawHeader("User-Agent"_ba, HttpRqst::GetUserAgentPC());
     rqst.setAttribute(QNetworkRequest::AutoDeleteReplyOnFinishAttribute, true);
+    // API responses, e.g. the serverInfoToken of the server list
+    disableCache(rqst);
     return rqst;
 }
 
 QString generateTempId() {
-    static QRandomGenerator random{(uint32_t)QDateTime::currentMSecsSinceEpoch()};
+    static thread_local QRandomGenerator random{QRandomGenerator::global()->generate()};
     static auto hex = u"0123456789abcdef";
     QString s = u"xxxxxxxx-xxxx-4xxx-yxxx-xxxxxxxxxxxx"_s;
     for (auto &ch : s) {
@@ -36,58 +46,159 @@ QString generateTempId() {
     return s;
 }
 
-RqstHandler<QString> getSettingsJsUrl() {
-    QString url = u"https://warh5.rivergame.net/webgame/index.html?t="_s
-                  + QString::number(QDateTime::currentSecsSinceEpoch() / 120);
-    auto r = getNamInst()->get(makeTwRqst(url));
-    return {r, [](QNetworkReply *r) -> Expected<QString> {
-        unique_ptr<RqstError> err = checkReplyError(r);
-        if (err != nullptr) {
-            return std::move(err);
+/**
+ * Finds the first match of a pattern in a reply body while it is being downloaded.
+ *
+ * The body is scanned as raw bytes for marker, the fixed beginning of the pattern,
+ * and only the bytes following a marker are matched against the regular expression.
+ * Once found, the reply is aborted so that the rest of it is not downloaded,
+ * unless keepDownloading is set (e.g. to let a small file get into the disk cache).
+ * The processFunc of the request must check result() before the reply error,
+ * since a reply aborted this way finishes with OperationCanceledError.
+ */
+class StreamingMatcher {
+    // a match must be complete within this many bytes after the marker
+    static constexpr qsizetype MaxMatchLen = 256;
+
+    const QByteArrayMatcher &marker;
+    const QRegularExpression &re;
+    QByteArray window;
+    optional<QString> found;
+
+public:
+    StreamingMatcher(const QByteArrayMatcher &marker, const QRegularExpression &re)
+        : marker{marker}, re{re} {}
+
+    static shared_ptr<StreamingMatcher> attach(QNetworkReply *r, const QByteArrayMatcher &marker,
+                                               const QRegularExpression &re, bool keepDownloading = false) {
+        auto matcher = make_shared<StreamingMatcher>(marker, re);
+        QObject::connect(r, &QNetworkReply::readyRead, r, [r, matcher, keepDownloading] {
+            if (matcher->found.has_value()) {
+                // discard the data arriving before the abort
+                r->skip(r->bytesAvailable());
+                return;
+            }
+            matcher->feed(r->readAll(), false);
+            if (matcher->found.has_value() && !keepDownloading) {
+                // aborting emits finished, which must not happen inside readyRead
+                QMetaObject::invokeMethod(r, &QNetworkReply::abort, Qt::QueuedConnection);
+            }
+        });
+        return matcher;
+    }
+
+    const optional<QString>& result() const {
+        return found;
+    }
+
+    void feed(const QByteArray &data, bool atEnd) {
+        window += data;
+        qsizetype from = 0;
+        while (!found.has_value()) {
+            qsizetype pos = marker.indexIn(window, from);
+            if (pos < 0) {
+                // keep a tail in case the marker is split between chunks
+                window = window.right(marker.pattern().size() - 1);
+                return;
+            }
+            QByteArrayView candidate = QByteArrayView{window}.sliced(pos);
+            bool complete = atEnd || candidate.size() >= MaxMatchLen;
+            candidate.truncate(MaxMatchLen);
+            auto m = re.match(QString::fromUtf8(candidate), 0, QRegularExpression::NormalMatch,
+                              QRegularExpression::AnchorAtOffsetMatchOption);
+            if (m.hasMatch()) {
+                found = m.captured(1);
+            } else if (!complete) {
+                // wait for more data
+                window = window.sliced(pos);
+                return;
+            } else {
+                from = pos + 1;
+            }
         }
-        QString content = QString::fromUtf8(r->readAll());
-        auto m = QRegExp{uR"#("src/(settings\.[0-9a-z]+\.js)")#"_s}.match(content);
-        if (!m.hasMatch()) {
-            return make_unique<RqstError>();
+        window.clear();
+    }
+};
+
+static Expected<QString> takeMatch(StreamingMatcher &matcher, QNetworkReply *r) {
+    if (matcher.result().has_value()) {
+        return QString{*matcher.result()};
+    }
+    unique_ptr<RqstError> err = checkReplyError(r);
+    if (err != nullptr) {
+        return std::move(err);
+    }
+    matcher.feed(r->readAll(), true);
+    if (!matcher.result().has_value()) {
+        return make_unique<RqstError>();
+    }
+    return QString{*matcher.result()};
+}
+
+// The version lookup is on the login path, so transient failures are retried
+// at once instead of waiting for the next login attempt.
+static const RqstPolicy IndexPagePolicy{
+    .timeout = 10s, .maxRetries = 2, .hedgePercentile = 0.9, .latencyKey = u"index.html"_s
+};
+static const RqstPolicy AssetPolicy{.timeout = 30s, .maxRetries = 2};
+// Neither hedged nor retried: the token is consumed by the server, and an attempt
+// that timed out may have been handled already. A new login gets a new token
+static const RqstPolicy ServerListPolicy{.timeout = 10s, .maxRetries = 0};
+
+static RqstHandler<QString> getSettingsJsUrlOnce() {
+    static const QByteArrayMatcher marker{"\"src/settings."_ba};
+    static const QRegExp re{uR"#("src/(settings\.[0-9a-z]+\.js)")#"_s};
+    // revalidated with the disk cache, mostly getting 304
+    auto r = getNamInst()->get(makeTwRqst(u"https://warh5.rivergame.net/webgame/index.html"_s));
+    auto matcher = StreamingMatcher::attach(r, marker, re, true);
+    return {r, [matcher](QNetworkReply *r) -> Expected<QString> {
+        Expected<QString> res = takeMatch(*matcher, r);
+        if (res.hasError()) {
+            return res;
         }
-        return u"https://warh5.rivergame.net/webgame/src/"_s + m.captured(1);
+        return u"https://warh5.rivergame.net/webgame/src/"_s + res.value();
     }};
 }
 
-RqstHandler<QString> rqstMainJsVersion(const QString &settingsJsurl) {
-    auto r = getNamInst()->get(makeTwRqst(settingsJsurl));
-    return {r, [](QNetworkReply *r) -> Expected<QString> {
-        unique_ptr<RqstError> err = checkReplyError(r);
-        if (err != nullptr) {
-            return std::move(err);
-        }
-        QString content = QString::fromUtf8(r->readAll());
-        auto m = QRegExp{uR"#(main"?\s*:\s*"([0-9a-z]+)")#"_s}.match(content);
-        if (!m.hasMatch()) {
-            return make_unique<RqstError>();
-        }
-        return m.captured(1);
+RqstHandler<QString> getSettingsJsUrl() {
+    return withPolicy(IndexPagePolicy, getSettingsJsUrlOnce);
+}
+
+static RqstHandler<QString> rqstMainJsVersionOnce(const QString &settingsJsurl) {
+    static const QByteArrayMatcher marker{"main"_ba};
+    static const QRegExp re{uR"#(main"?\s*:\s*"([0-9a-z]+)")#"_s};
+    // small, read to the end so that it gets into the disk cache
+    auto r = getNamInst()->get(makeTwAssetRqst(settingsJsurl));
+    auto matcher = StreamingMatcher::attach(r, marker, re, true);
+    return {r, [matcher](QNetworkReply *r) {
+        return takeMatch(*matcher, r);
     }};
 }
 
-RqstHandler<QString> rqstGameVersionFromJs(const QString &mainJsVersion) {
+RqstHandler<QString> rqstMainJsVersion(const QString &settingsJsurl) {
+    return withPolicy(AssetPolicy, [settingsJsurl] { return rqstMainJsVersionOnce(settingsJsurl); });
+}
+
+static RqstHandler<QString> rqstGameVersionFromJsOnce(const QString &mainJsVersion) {
+    static const QByteArrayMatcher marker{"app_version"_ba};
+    static const QRegExp re{uR"#(app_version"?\s*:\s*"([^"]+)")#"_s};
     QString url = u"https://warh5.rivergame.net/webgame/assets/main/index."_s
                   + mainJsVersion + u".js"_s;
-    auto r = getNamInst()->get(makeTwRqst(url));
-    return {r, [](QNetworkReply *r) -> Expected<QString> {
-        unique_ptr<RqstError> err = checkReplyError(r);
-        if (err != nullptr) {
-            return std::move(err);
-        }
-        QString content = QString::fromUtf8(r->readAll());
-        auto m = QRegExp{uR"#(app_version"?\s*:\s*"([^"]+)")#"_s}.match(content);
-        if (!m.hasMatch()) {
-            return make_unique<RqstError>();
-        }
-        return m.captured(1);
+    // Several MB, aborted once the version is found, so never cached here.
+    // GameVersionCache keeps the version per settings.js and skips this download
+    QNetworkRequest rqst = makeTwRqst(url);
+    disableCache(rqst);
+    auto r = getNamInst()->get(rqst);
+    auto matcher = StreamingMatcher::attach(r, marker, re);
+    return {r, [matcher](QNetworkReply *r) {
+        return takeMatch(*matcher, r);
     }};
 }
 
+RqstHandler<QString> rqstGameVersionFromJs(const QString &mainJsVersion) {
+    return withPolicy(AssetPolicy, [mainJsVersion] { return rqstGameVersionFromJsOnce(mainJsVersion); });
+}
+
 RqstHandler<QString> rqstGameVersion() {
     return getSettingsJsUrl()
         .thenRqst(rqstMainJsVersion)
@@ -95,7 +206,7 @@ RqstHandler<QString> rqstGameVersion() {
     ;
 }
 
-RqstHandler<unique_ptr<GameSessionInfo>> rqstSessionInfo(const QString &gameVer, const QString &token) {
+static RqstHandler<unique_ptr<GameSessionInfo>> rqstSessionInfoOnce(const QString &gameVer, const QString &token) {
     QString baseUrl = u"https://serverlist-knight.rivergame.net/appServerListServlet"_s;
     QUrlQuery params{
         {u"__ts__"_s, QString::number(QDateTime::currentMSecsSinceEpoch())},
@@ -127,6 +238,11 @@ RqstHandler<unique_ptr<GameSessionInfo>> rqstSessionInfo(const QString &gameVer,
         session->serverUrl = res[u"url"_s].toString();
         session->serverInfoToken = serverInfoToken;
         session->tempId = generateTempId();
+        session->tokenTime = QDateTime::currentMSecsSinceEpoch();
         return session;
     }};
 }
+
+RqstHandler<unique_ptr<GameSessionInfo>> rqstSessionInfo(const QString &gameVer, const QString &token) {
+    return withPolicy(ServerListPolicy, [gameVer, token] { return rqstSessionInfoOnce(gameVer, token); });
+}
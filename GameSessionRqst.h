@@ -7,20 +7,33 @@ struct GameSessionInfo {
     QString serverUrl;
     QString serverInfoToken;
     QString tempId;
+    int64_t tokenTime{0}; // epoch ms when serverInfoToken is issued, 0 if unknown
 };
 
 inline QDataStream& operator<< (QDataStream &out, const GameSessionInfo &session) {
     return out << session.serverId << session.serverUrl
-               << session.serverInfoToken << session.tempId;
+               << session.serverInfoToken << session.tempId
+               << static_cast<qint64>(session.tokenTime);
 }
 
 inline QDataStream& operator>> (QDataStream &in, GameSessionInfo &session) {
-    return in >> session.serverId >> session.serverUrl
-              >> session.serverInfoToken >> session.tempId;
+    in >> session.serverId >> session.serverUrl
+       >> session.serverInfoToken >> session.tempId;
+    // absent in the files saved by older versions
+    qint64 tokenTime = 0;
+    if (!in.atEnd()) {
+        in >> tokenTime;
+    }
+    session.tokenTime = tokenTime;
+    return in;
 }
 
 QString generateTempId();
 
+// Returns the url of settings.js, whose file name contains its hash
+HttpRqst::RqstHandler<QString> getSettingsJsUrl();
+HttpRqst::RqstHandler<QString> rqstMainJsVersion(const QString &settingsJsurl);
+HttpRqst::RqstHandler<QString> rqstGameVersionFromJs(const QString &mainJsVersion);
 HttpRqst::RqstHandler<QString> rqstGameVersion();
 
 HttpRqst::RqstHandler<unique_ptr<GameSessionInfo>> rqstSessionInfo(const QString &gameVer, const QString &token);
@@ -0,0 +1,142 @@
+#include <QtCore>
+#include "GameVersionCache.h"
+
+using namespace HttpRqst;
+
+constexpr int GameVersionCacheVersion = 1;
+constexpr auto FreshTime = std::chrono::minutes{30};
+constexpr auto MaxAge = std::chrono::hours{24};
+constexpr auto RecheckInterval = std::chrono::minutes{1};
+
+GameVersionCache::GameVersionCache(const QString &filePath, RqstExecutor &executor)
+    : filePath{filePath}, executor{executor} {}
+
+void GameVersionCache::load() {
+    QFile file{filePath};
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    const QJsonObject obj = QJsonDocument::fromJson(file.readAll()).object();
+    if (obj[u"version"_s].toInt() != GameVersionCacheVersion) {
+        return;
+    }
+    version = obj[u"gameVersion"_s].toString();
+    settingsJsUrl = obj[u"settingsJsUrl"_s].toString();
+    fetchTime = std::chrono::system_clock::time_point{milliseconds{obj[u"fetchTime"_s].toInteger()}};
+}
+
+void GameVersionCache::save() {
+    QJsonObject obj{
+        {u"version"_s, GameVersionCacheVersion},
+        {u"gameVersion"_s, version},
+        {u"settingsJsUrl"_s, settingsJsUrl},
+        {u"fetchTime"_s, DurationCast::round<milliseconds>(fetchTime.time_since_epoch()).count()},
+    };
+    QSaveFile file{filePath};
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "failed to open game version cache file";
+        return;
+    }
+    file.write(QJsonDocument{obj}.toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        qDebug() << "failed to save game version cache" << file.errorString();
+    }
+}
+
+bool GameVersionCache::isFresh() const {
+    auto age = std::chrono::system_clock::now() - fetchTime;
+    return !version.isEmpty() && age >= 0ms && age < FreshTime;
+}
+
+bool GameVersionCache::isUsable() const {
+    auto age = std::chrono::system_clock::now() - fetchTime;
+    return !version.isEmpty() && age >= 0ms && age < MaxAge;
+}
+
+void GameVersionCache::request(QObject *context, Callback<const QString&> callback) {
+    if (isUsable()) {
+        QMetaObject::invokeMethod(context, [callback=std::move(callback), version=version] { callback(version); });
+        if (!isFresh() && !fetching) {
+            // stale-while-revalidate
+            fetch();
+        }
+        return;
+    }
+    waiters.emplace_back(context, std::move(callback));
+    if (!fetching) {
+        fetch();
+    }
+}
+
+void GameVersionCache::cancel(QObject *context) {
+    std::erase_if(waiters, [=](const auto &waiter) {
+        return waiter.first == context;
+    });
+}
+
+void GameVersionCache::revalidate(const QString &version, QObject *context, Callback<const QString&> callback) {
+    auto age = std::chrono::system_clock::now() - fetchTime;
+    if (version != this->version || (age >= 0ms && age < RecheckInterval)) {
+        // already replaced by a newer one, or just checked
+        QString result = isUsable() ? this->version : QString{};
+        QMetaObject::invokeMethod(context, [callback=std::move(callback), result] { callback(result); });
+        return;
+    }
+    qDebug() << "game version rejected, checking it:" << version;
+    waiters.emplace_back(context, std::move(callback));
+    if (!fetching) {
+        fetch();
+    }
+}
+
+void GameVersionCache::fetch() {
+    fetching = true;
+    rqstAborter = executor.run(this, getSettingsJsUrl,
+        [this](QString url) {
+            if (url == settingsJsUrl && !version.isEmpty()) {
+                // settings.js (whose name contains its hash) is unchanged, so is the version
+                onFetched(QString{version}, url);
+                return;
+            }
+            fetchFromSettingsJs(url);
+        },
+        [this](const RqstError &err) { onFetchFailed(err); }
+    );
+}
+
+void GameVersionCache::fetchFromSettingsJs(const QString &settingsJsUrl) {
+    rqstAborter = executor.run(this,
+        [settingsJsUrl] {
+            return rqstMainJsVersion(settingsJsUrl).thenRqst(rqstGameVersionFromJs);
+        },
+        [this, settingsJsUrl](QString result) { onFetched(result, settingsJsUrl); },
+        [this](const RqstError &err) { onFetchFailed(err); }
+    );
+}
+
+void GameVersionCache::onFetched(const QString &version, const QString &settingsJsUrl) {
+    fetching = false;
+    if (version != this->version) {
+        qDebug() << "version:" << version;
+    }
+    this->version = version;
+    this->settingsJsUrl = settingsJsUrl;
+    fetchTime = std::chrono::system_clock::now();
+    save();
+    notifyWaiters();
+}
+
+void GameVersionCache::onFetchFailed(const RqstError &err) {
+    fetching = false;
+    qDebug() << "failed to get game version." << err.getDescription();
+    notifyWaiters();
+}
+
+void GameVersionCache::notifyWaiters() {
+    auto waiters = std::move(this->waiters);
+    this->waiters.clear();
+    QString result = isUsable() ? version : QString{};
+    for (const auto& [context, callback] : waiters) {
+        QMetaObject::invokeMethod(context, [callback, result] { callback(result); });
+    }
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QObject>
+#include "GameSessionRqst.h"
+#include "RqstExecutor.h"
+
+/**
+ * Game version shared by all accounts, persisted to disk.
+ *
+ * The version is saved together with the settings.js url it was found from
+ * (the url contains the content hash of settings.js). Within FreshTime the
+ * cached version is used as is. Until MaxAge it is still returned immediately,
+ * while being revalidated in background: if index.html still refers to the same
+ * settings.js, the main js bundle is not downloaded again.
+ *
+ * There is at most one request in flight. Every caller arriving meanwhile
+ * waits for the same request. Requests run in the threads of executor.
+ *
+ * Not thread-safe, use it in the thread it lives in.
+ */
+class GameVersionCache: public QObject
+{
+    Q_OBJECT
+
+public:
+    GameVersionCache(const QString &filePath, RqstExecutor &executor);
+
+    void load();
+
+    /**
+     * Calls callback in the thread of context with the game version.
+     * An empty version is passed on failure.
+     */
+    void request(QObject *context, Callback<const QString&> callback);
+
+    // Drops the pending callbacks of context. Must be called before context is deleted.
+    void cancel(QObject *context);
+
+    /**
+     * After the game server rejected LOGIN with version: checks whether the
+     * game site still serves it, and calls callback with the current version.
+     * The same version means the rejection has another cause (e.g. an expired
+     * session token). Only index.html is fetched unless settings.js changed,
+     * and a version checked within RecheckInterval is not checked again, so
+     * that many accounts with bad tokens do not cause a refetch each.
+     */
+    void revalidate(const QString &version, QObject *context, Callback<const QString&> callback);
+
+private:
+    bool isFresh() const;
+    bool isUsable() const;
+    void fetch();
+    void fetchFromSettingsJs(const QString &settingsJsUrl);
+    void onFetched(const QString &version, const QString &settingsJsUrl);
+    void onFetchFailed(const HttpRqst::RqstError &err);
+    void notifyWaiters();
+    void save();
+
+    QString filePath;
+    QString version;
+    QString settingsJsUrl;
+    std::chrono::system_clock::time_point fetchTime;
+
+    RqstExecutor &executor;
+    bool fetching{false};
+    AsyncAbortHandler rqstAborter;
+    std::vector<pair<QObject*, Callback<const QString&>>> waiters;
+};
@@ -1,6 +1,71 @@
+#include <deque>
 #include "HttpRqst.h"
 
-static QThreadStorage<QNetworkAccessManager> perThreadNam;
+constexpr auto HttpCacheRelPath = "cache/http";
+constexpr int64_t HttpCacheSizePerThread = 16_MiB;
+
+// QNetworkDiskCache can not be shared, so each thread gets its own directory
+static QNetworkDiskCache* makeDiskCache() {
+    static std::atomic<int> cacheCnt{0};
+    QString path = QDir{QCoreApplication::applicationDirPath()}.filePath(
+        QString{HttpCacheRelPath} + u'/' + QString::number(cacheCnt++));
+    auto cache = new QNetworkDiskCache;
+    cache->setCacheDirectory(path);
+    cache->setMaximumCacheSize(HttpCacheSizePerThread);
+    return cache;
+}
+
+// TLS session tickets by host, shared by the NAMs of all threads,
+// so that a connection opened by any thread can resume the session.
+static QMutex sessionTicketMutex;
+static QHash<QString, QByteArray> sessionTickets;
+static std::atomic<int64_t> handshakeCnt{0};
+
+static QSslConfiguration makeSslConfig(const QString &host) {
+    QSslConfiguration conf = QSslConfiguration::defaultConfiguration();
+    conf.setAllowedNextProtocols({QSslConfiguration::ALPNProtocolHTTP2,
+                                  QSslConfiguration::NextProtocolHttp1_1});
+    conf.setSslOption(QSsl::SslOptionDisableSessionPersistence, false);
+    QMutexLocker locker{&sessionTicketMutex};
+    if (auto it = sessionTickets.constFind(host); it != sessionTickets.constEnd()) {
+        conf.setSessionTicket(it.value());
+    }
+    return conf;
+}
+
+/**
+ * The QNetworkAccessManager of a thread. It has a disk cache, allows HTTP/2,
+ * and resumes TLS sessions with the tickets shared between threads.
+ */
+class ThreadNam: public QNetworkAccessManager {
+public:
+    ThreadNam() {
+        // takes the ownership
+        setCache(makeDiskCache());
+        connect(this, &QNetworkAccessManager::encrypted, this, [](QNetworkReply *r) {
+            handshakeCnt++;
+            QByteArray ticket = r->sslConfiguration().sessionTicket();
+            if (!ticket.isEmpty()) {
+                QMutexLocker locker{&sessionTicketMutex};
+                sessionTickets.insert(r->url().host(), ticket);
+            }
+        });
+    }
+
+protected:
+    QNetworkReply* createRequest(Operation op, const QNetworkRequest &originalRqst,
+                                 QIODevice *outgoingData) override {
+        if (originalRqst.url().scheme() != u"https"_s) {
+            return QNetworkAccessManager::createRequest(op, originalRqst, outgoingData);
+        }
+        QNetworkRequest rqst = originalRqst;
+        rqst.setSslConfiguration(makeSslConfig(rqst.url().host()));
+        rqst.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+        return QNetworkAccessManager::createRequest(op, rqst, outgoingData);
+    }
+};
+
+static QThreadStorage<ThreadNam> perThreadNam;
 
 namespace HttpRqst {
 
@@ -20,6 +85,16 @@ QNetworkAccessManager* getNamInst() {
     return &perThreadNam.localData();
 }
 
+void prewarm(const QStringList &hosts) {
+    for (const auto &host : hosts) {
+        getNamInst()->connectToHostEncrypted(host, 443, makeSslConfig(host));
+    }
+}
+
+int64_t takeHandshakeCount() {
+    return handshakeCnt.exchange(0);
+}
+
 QNetworkReply* postUrlEncoded(QNetworkRequest rqst, const QByteArray &data) {
     rqst.setRawHeader("content-type"_ba, "application/x-www-form-urlencoded;charset=UTF-8"_ba);
     return getNamInst()->post(rqst, data);
@@ -94,6 +169,166 @@ unique_ptr<RqstError> checkReplyError(QNetworkReply *reply) {
 
 
 
+CancelScope::CancelScope() {
+    deadlineTimer.setSingleShot(true);
+    deadlineTimer.callOnTimeout([this] { cancel(); });
+}
+
+CancelScope::CancelScope(CancelScope *parent, milliseconds timeout)
+    : CancelScope{}
+{
+    this->parent = parent;
+    if (parent != nullptr) {
+        parent->children.push_back(this);
+        canceled = parent->canceled;
+    }
+    if (timeout > 0ms) {
+        setTimeout(timeout);
+    }
+}
+
+CancelScope::~CancelScope() {
+    cancel();
+    for (auto child : children) {
+        child->parent = nullptr;
+    }
+    if (parent != nullptr) {
+        std::erase(parent->children, this);
+    }
+}
+
+void CancelScope::cancel() {
+    canceled = true;
+    deadlineTimer.stop();
+    // move out first, aborting may lead to binding of new requests
+    auto aborting = std::move(rqsts);
+    rqsts.clear();
+    for (auto &rqst : aborting) {
+        rqst.abort();
+    }
+    for (auto child : children) {
+        child->cancel();
+    }
+}
+
+bool CancelScope::isCanceled() const {
+    return canceled;
+}
+
+void CancelScope::setTimeout(milliseconds timeout) {
+    if (!canceled) {
+        deadlineTimer.start(max(timeout, 0ms));
+    }
+}
+
+optional<SteadyTimepoint> CancelScope::getDeadline() const {
+    optional<SteadyTimepoint> ret;
+    if (deadlineTimer.isActive()) {
+        ret = SteadyClockNow() + deadlineTimer.remainingTimeAsDuration();
+    }
+    if (parent != nullptr) {
+        optional<SteadyTimepoint> inherited = parent->getDeadline();
+        if (inherited.has_value() && (!ret.has_value() || *inherited < *ret)) {
+            ret = inherited;
+        }
+    }
+    return ret;
+}
+
+void CancelScope::bind(AbortHandler &&rqst) {
+    if (canceled) {
+        rqst.abort();
+        return;
+    }
+    std::erase_if(rqsts, [](AbortHandler &h) { return !h.isValid(); });
+    rqsts.push_back(std::move(rqst));
+}
+
+
+
+ReplyGroup::ReplyGroup(QObject *parent)
+    : QNetworkReply{parent}
+{
+    connect(this, &QNetworkReply::finished, this, &QObject::deleteLater);
+}
+
+size_t ReplyGroup::addChild(AbortHandler &&child) {
+    children.push_back(std::move(child));
+    return children.size() - 1;
+}
+
+bool ReplyGroup::isChildRunning(size_t i) {
+    return !done && children[i].isValid();
+}
+
+void ReplyGroup::abortChild(size_t i) {
+    children[i].abort();
+}
+
+bool ReplyGroup::isDone() const {
+    return done;
+}
+
+void ReplyGroup::finishGroup() {
+    if (done) {
+        return;
+    }
+    done = true;
+    for (auto &child : children) {
+        child.abort();
+    }
+    // queued, so that the RqstHandler of the group is connected even if it finishes at once
+    QMetaObject::invokeMethod(this, [this] {
+        setFinished(true);
+        emit finished();
+    }, Qt::QueuedConnection);
+}
+
+void ReplyGroup::abort() {
+    if (done) {
+        return;
+    }
+    done = true;
+    for (auto &child : children) {
+        child.abort();
+    }
+    setError(OperationCanceledError, u"Operation canceled"_s);
+    setFinished(true);
+    emit finished();
+}
+
+qint64 ReplyGroup::readData(char *, qint64) {
+    return -1;
+}
+
+
+
+constexpr size_t LatencySamples = 64;
+constexpr size_t MinLatencySamples = 8;
+
+static thread_local std::map<QString, std::deque<milliseconds>> latencies;
+
+void recordLatency(const QString &key, milliseconds latency) {
+    auto &samples = latencies[key];
+    samples.push_back(latency);
+    if (samples.size() > LatencySamples) {
+        samples.pop_front();
+    }
+}
+
+optional<milliseconds> latencyPercentile(const QString &key, double percentile) {
+    auto it = latencies.find(key);
+    if (it == latencies.end() || it->second.size() < MinLatencySamples) {
+        return {};
+    }
+    std::vector<milliseconds> sorted{it->second.begin(), it->second.end()};
+    auto n = static_cast<size_t>(std::clamp(percentile, 0.0, 1.0) * static_cast<double>(sorted.size() - 1));
+    std::ranges::nth_element(sorted, sorted.begin() + n);
+    return sorted[n];
+}
+
+
+
 
 
 } // END namespace HttpRqst
@@ -15,9 +15,32 @@ QByteArray GetUserAgentPC();
 
 /**
  * Returns the thread-local QNetworkAccessManager instance of current thread.
+ * It has a size-capped disk cache: cached responses are revalidated with
+ * ETag / Last-Modified, and the least recently stored entries are evicted.
+ * HTTPS requests allow HTTP/2, and TLS session tickets are shared by the
+ * instances of all threads.
  */
 QNetworkAccessManager* getNamInst();
 
+// Keeps the response of rqst out of the disk cache and always asks the network,
+// for responses that carry tokens or login codes
+inline void disableCache(QNetworkRequest &rqst) {
+    rqst.setAttribute(QNetworkRequest::CacheSaveControlAttribute, false);
+    rqst.setAttribute(QNetworkRequest::CacheLoadControlAttribute, QNetworkRequest::AlwaysNetwork);
+}
+
+/**
+ * Opens TLS connections to hosts in advance with the NAM of current thread,
+ * so that the following requests of this thread skip the handshake.
+ */
+void prewarm(const QStringList &hosts);
+
+// Returns the number of encrypted replies of all threads since last call, as
+// an estimate of the TLS handshakes. It is counted per reply, so replies sharing
+// an HTTP/2 connection may each count, and a resumed session counts as well.
+// The connections opened by prewarm() have no reply and are not counted
+int64_t takeHandshakeCount();
+
 /// Post data with content-type set to application/x-www-form-urlencoded.
 /// The QNetworkAccessManager instance used is from getNamInst().
 QNetworkReply* postUrlEncoded(QNetworkRequest rqst, const QByteArray &data);
@@ -417,4 +440,341 @@ public:
     }
 };
 
+
+
+/**
+ * A node in a tree of cancellation scopes, e.g. one for an account and a
+ * child of it for a login attempt.
+ *
+ * Requests bound to a scope are aborted when the scope is canceled, which
+ * happens on cancel(), on destruction, when its deadline passes, or when
+ * its parent is canceled. Hence a child never outlives the deadline of its
+ * parent. An aborted chain calls none of its remaining continuations.
+ *
+ * Not thread-safe. A scope, its children and the bound requests must all
+ * belong to one thread.
+ */
+class CancelScope {
+    CancelScope *parent{nullptr};
+    std::vector<CancelScope*> children;
+    std::vector<AbortHandler> rqsts;
+    QTimer deadlineTimer;
+    bool canceled{false};
+
+public:
+    CancelScope();
+
+    // timeout of 0 means no deadline of its own
+    explicit CancelScope(CancelScope *parent, milliseconds timeout = 0ms);
+    ~CancelScope();
+
+    CancelScope(const CancelScope &) = delete;
+    CancelScope& operator= (const CancelScope &) = delete;
+
+    void cancel();
+    bool isCanceled() const;
+
+    // Sets the deadline to now + timeout
+    void setTimeout(milliseconds timeout);
+
+    // Returns the earliest deadline of this scope and its ancestors, if any
+    optional<SteadyTimepoint> getDeadline() const;
+
+    void bind(AbortHandler &&rqst);
+
+    template <class T>
+    void bind(const RqstHandler<T> &h) {
+        bind(AbortHandler{h});
+    }
+};
+
+
+
+/**
+ * A QNetworkReply standing for a group of requests running in parallel,
+ * so that a combined request works with RqstHandler and AbortHandler like
+ * a single one. Aborting the group aborts every outstanding request in it.
+ *
+ * It is finished by the combinator (whenAll, whenAny, race) through
+ * finishGroup(), and deletes itself after finished.
+ */
+class ReplyGroup: public QNetworkReply {
+    Q_OBJECT
+
+    std::vector<AbortHandler> children;
+    bool done{false};
+
+public:
+    explicit ReplyGroup(QObject *parent = nullptr);
+
+
+    size_t addChild(AbortHandler &&child);
+    bool isChildRunning(size_t i);
+    void abortChild(size_t i);
+
+    // Whether the group is finished or aborted
+    bool isDone() const;
+
+    // Aborts the outstanding requests, and emits finished in next event loop iteration
+    void finishGroup();
+
+    void abort() override;
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override;
+};
+
+/**
+ * Runs handlers in parallel. Succeeds with all the results in the same order
+ * when every request succeeds, or fails with the first error.
+ */
+template <class T>
+RqstHandler<std::vector<T>> whenAll(std::vector<RqstHandler<T>> handlers) {
+    struct State {
+        std::vector<optional<T>> results;
+        size_t remaining;
+        unique_ptr<RqstError> err;
+    };
+    auto group = new ReplyGroup;
+    auto state = make_shared<State>();
+    state->results.resize(handlers.size());
+    state->remaining = handlers.size();
+    for (size_t i = 0; i < handlers.size(); i++) {
+        group->addChild(AbortHandler{handlers[i]});
+        handlers[i].whenFinished([group, state, i](Expected<T> res) {
+            if (res.hasError()) {
+                state->err = res.takeError();
+                group->finishGroup();
+                return;
+            }
+            state->results[i] = res.takeValue();
+            if (--state->remaining == 0) {
+                group->finishGroup();
+            }
+        });
+    }
+    if (handlers.empty()) {
+        group->finishGroup();
+    }
+    return {group, [state](QNetworkReply *) -> Expected<std::vector<T>> {
+        if (state->err != nullptr) {
+            return std::move(state->err);
+        }
+        std::vector<T> ret;
+        ret.reserve(state->results.size());
+        for (auto &result : state->results) {
+            ret.push_back(std::move(*result));
+        }
+        return ret;
+    }};
+}
+
+namespace detail {
+
+// Finishes the group with the first result that stopWhen accepts,
+// or with the last result if none is accepted.
+template <class T, class Predicate>
+RqstHandler<T> whenFirst(std::vector<RqstHandler<T>> handlers, Predicate stopWhen) {
+    struct State {
+        optional<Expected<T>> result;
+        size_t remaining;
+    };
+    auto group = new ReplyGroup;
+    auto state = make_shared<State>();
+    state->remaining = handlers.size();
+    for (auto &handler : handlers) {
+        group->addChild(AbortHandler{handler});
+        handler.whenFinished([group, state, stopWhen](Expected<T> res) {
+            bool stop = stopWhen(res);
+            state->result.emplace(std::move(res));
+            if (stop || --state->remaining == 0) {
+                group->finishGroup();
+            }
+        });
+    }
+    if (handlers.empty()) {
+        group->finishGroup();
+    }
+    return {group, [state](QNetworkReply *) -> Expected<T> {
+        if (!state->result.has_value()) {
+            return make_unique<RqstError>();
+        }
+        return std::move(*state->result);
+    }};
+}
+
+} // END namespace detail
+
+/**
+ * Runs handlers in parallel. Succeeds with the first successful result,
+ * or fails with the last error when every request fails.
+ */
+template <class T>
+RqstHandler<T> whenAny(std::vector<RqstHandler<T>> handlers) {
+    return detail::whenFirst(std::move(handlers), [](const Expected<T> &res) {
+        return res.hasValue();
+    });
+}
+
+/**
+ * Runs handlers in parallel. Finishes with whichever request finishes first,
+ * no matter whether it succeeds.
+ */
+template <class T>
+RqstHandler<T> race(std::vector<RqstHandler<T>> handlers) {
+    return detail::whenFirst(std::move(handlers), [](const Expected<T> &) {
+        return true;
+    });
+}
+
+
+
+
+/**
+ * Declarative handling of transient failures, see withPolicy().
+ */
+struct RqstPolicy {
+    // Per attempt. An attempt not finished in time fails with NetworkError. 0 means no timeout.
+    milliseconds timeout{0};
+
+    // Failed attempts whose reason is in retryOn are retried at most maxRetries times,
+    // after a randomized exponential backoff starting from backoff.
+    int maxRetries{0};
+    milliseconds backoff{500ms};
+    milliseconds maxBackoff{8s};
+    std::vector<RqstError::Reason> retryOn{RqstError::NetworkError};
+
+    // If set, a second attempt is sent when the first one takes longer than
+    // the given percentile (e.g. 0.9) of the recent latencies of requests with
+    // the same latencyKey, and whichever succeeds first is used.
+    // Only for idempotent requests.
+    double hedgePercentile{0};
+    QString latencyKey;
+};
+
+// Latencies of successful requests, per thread
+void recordLatency(const QString &key, milliseconds latency);
+optional<milliseconds> latencyPercentile(const QString &key, double percentile);
+
+namespace detail {
+
+template <class Handler>
+struct RqstResult;
+
+template <class T>
+struct RqstResult<RqstHandler<T>> {
+    using type = T;
+};
+
+template <class T, class Factory>
+class PolicyRunner: public std::enable_shared_from_this<PolicyRunner<T, Factory>> {
+public:
+    RqstPolicy policy;
+    Factory factory;
+    ReplyGroup *group{new ReplyGroup};
+    optional<Expected<T>> result;
+    int retries{0};
+    int running{0};
+
+    PolicyRunner(const RqstPolicy &policy, Factory &&factory)
+        : policy{policy}, factory{std::move(factory)} {}
+
+    void launch(bool isHedge) {
+        if (group->isDone()) {
+            return;
+        }
+        auto self = this->shared_from_this();
+        auto startTime = SteadyClockNow();
+        RqstHandler<T> handler = factory();
+        size_t i = group->addChild(AbortHandler{handler});
+        running++;
+        handler.whenFinished([self, startTime](Expected<T> res) {
+            if (res.hasValue() && !self->policy.latencyKey.isEmpty()) {
+                recordLatency(self->policy.latencyKey, DurationCast::round<milliseconds>(SteadyClockNow() - startTime));
+            }
+            self->onAttemptFinished(std::move(res));
+        });
+        if (policy.timeout > 0ms) {
+            QTimer::singleShot(policy.timeout, group, [self, i] {
+                if (!self->group->isChildRunning(i)) {
+                    return;
+                }
+                self->group->abortChild(i);
+                self->onAttemptFinished(makeNetworkError(u"请求超时"_s));
+            });
+        }
+        if (!isHedge && retries == 0 && policy.hedgePercentile > 0) {
+            optional<milliseconds> hedgeDelay = latencyPercentile(policy.latencyKey, policy.hedgePercentile);
+            if (hedgeDelay.has_value()) {
+                QTimer::singleShot(*hedgeDelay, group, [self, i] {
+                    if (self->group->isChildRunning(i)) {
+                        self->launch(true);
+                    }
+                });
+            }
+        }
+    }
+
+    void onAttemptFinished(Expected<T> res) {
+        running--;
+        if (group->isDone()) {
+            return;
+        }
+        if (res.hasValue()) {
+            result.emplace(std::move(res));
+            group->finishGroup();
+            return;
+        }
+        if (running > 0) {
+            // the hedged sibling may still succeed
+            result.emplace(std::move(res));
+            return;
+        }
+        bool retryable = std::ranges::find(policy.retryOn, res.error()->reason) != policy.retryOn.end();
+        if (retryable && retries < policy.maxRetries) {
+            qDebug() << "request failed, retry." << res.error()->getDescription();
+            retries++;
+            result.emplace(std::move(res));
+            QTimer::singleShot(backoffDelay(), group, [self=this->shared_from_this()] {
+                self->launch(false);
+            });
+            return;
+        }
+        result.emplace(std::move(res));
+        group->finishGroup();
+    }
+
+    milliseconds backoffDelay() const {
+        milliseconds delay = policy.backoff;
+        for (int i = 1; i < retries && delay < policy.maxBackoff; i++) {
+            delay *= 2;
+        }
+        delay = min(delay, policy.maxBackoff);
+        // jitter in [delay / 2, delay]
+        auto half = delay.count() / 2;
+        return milliseconds{half + QRandomGenerator::global()->bounded(static_cast<qint64>(half) + 1)};
+    }
+};
+
+} // END namespace detail
+
+/**
+ * Makes a request with factory (() -> RqstHandler<T>) under policy. Can be
+ * used for any stage of a chain, e.g.
+ * `rqstA().thenRqst([](auto a) { return withPolicy(policy, [a] { return rqstB(a); }); })`
+ * Aborting the returned handler aborts every attempt in flight.
+ */
+template <class Factory>
+auto withPolicy(const RqstPolicy &policy, Factory factory) {
+    using T = typename detail::RqstResult<std::invoke_result_t<Factory>>::type;
+    auto runner = make_shared<detail::PolicyRunner<T, Factory>>(policy, std::move(factory));
+    runner->launch(false);
+    return RqstHandler<T>{runner->group, [runner](QNetworkReply *) -> Expected<T> {
+        if (!runner->result.has_value()) {
+            return make_unique<RqstError>();
+        }
+        return std::move(*runner->result);
+    }};
+}
+
 } // END namespace HttpRqst
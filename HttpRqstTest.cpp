@@ -0,0 +1,209 @@
+// TopwarHttpRqstTest: checks the request combinators of HttpRqst (whenAll, whenAny,
+// race) with fake replies: which result wins, and that aborting or finishing a
+// group aborts every request still running in it. Exits with 1 on a failure.
+
+#include <QCoreApplication>
+#include <QEventLoop>
+#include <QTimer>
+#include "HttpRqst.h"
+
+using namespace HttpRqst;
+
+namespace {
+
+int failures = 0;
+
+void check(bool ok, const char *what) {
+    if (!ok) {
+        qDebug() << "FAILED:" << what;
+        failures++;
+    }
+}
+
+// Finishes with body, or with an error when body is empty, after delay
+class FakeReply: public QNetworkReply {
+public:
+    FakeReply(milliseconds delay, QByteArray body)
+        : body{std::move(body)}
+    {
+        open(QIODevice::ReadOnly);
+        timer.setSingleShot(true);
+        timer.callOnTimeout(this, [this] {
+            if (this->body.isEmpty()) {
+                setError(ContentNotFoundError, u"fake error"_s);
+            }
+            setFinished(true);
+            emit finished();
+        });
+        timer.start(delay);
+    }
+
+    bool aborted{false};
+
+    void abort() override {
+        if (isFinished()) {
+            return;
+        }
+        aborted = true;
+        timer.stop();
+        setError(OperationCanceledError, u"Operation canceled"_s);
+        setFinished(true);
+        emit finished();
+    }
+
+    qint64 bytesAvailable() const override {
+        return body.size() - pos + QNetworkReply::bytesAvailable();
+    }
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override {
+        qint64 n = min(maxSize, body.size() - pos);
+        memcpy(data, body.constData() + pos, n);
+        pos += n;
+        return n;
+    }
+
+private:
+    QByteArray body;
+    qint64 pos{0};
+    QTimer timer;
+};
+
+// The replies are kept alive by the test, so that their aborted flag can be checked
+struct Fakes {
+    std::vector<unique_ptr<FakeReply>> replies;
+
+    RqstHandler<QString> add(milliseconds delay, const QByteArray &body) {
+        replies.push_back(make_unique<FakeReply>(delay, body));
+        return {replies.back().get(), [](QNetworkReply *r) -> Expected<QString> {
+            if (r->error() != QNetworkReply::NoError) {
+                return makeNetworkError(r->errorString());
+            }
+            return QString::fromUtf8(r->readAll());
+        }};
+    }
+
+    bool aborted(size_t i) const {
+        return replies[i]->aborted;
+    }
+};
+
+// Runs the event loop until the handler finishes, or for at most timeout
+template <class T>
+optional<Expected<T>> wait(RqstHandler<T> &handler, milliseconds timeout = 1s) {
+    optional<Expected<T>> result;
+    QEventLoop loop;
+    handler.whenFinished([&](Expected<T> res) {
+        result.emplace(std::move(res));
+        loop.quit();
+    });
+    QTimer::singleShot(timeout, &loop, &QEventLoop::quit);
+    loop.exec();
+    return result;
+}
+
+void runFor(milliseconds duration) {
+    QEventLoop loop;
+    QTimer::singleShot(duration, &loop, &QEventLoop::quit);
+    loop.exec();
+}
+
+void testRaceFirstWins() {
+    Fakes fakes;
+    auto handler = race(std::vector{fakes.add(50ms, "slow"), fakes.add(10ms, "fast")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasValue() && res->value() == u"fast"_s, "race: the first to finish wins");
+    check(fakes.aborted(0), "race: the loser is aborted");
+    check(!fakes.aborted(1), "race: the winner is not aborted");
+}
+
+void testRaceFirstErrorWins() {
+    Fakes fakes;
+    auto handler = race(std::vector{fakes.add(10ms, ""), fakes.add(50ms, "slow")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasError(), "race: an error finishing first wins");
+    check(fakes.aborted(1), "race: the loser of an error is aborted");
+}
+
+void testWhenAnySkipsErrors() {
+    Fakes fakes;
+    auto handler = whenAny(std::vector{fakes.add(10ms, ""), fakes.add(30ms, "second"), fakes.add(200ms, "third")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasValue() && res->value() == u"second"_s, "whenAny: the first success wins");
+    check(fakes.aborted(2), "whenAny: the requests still running are aborted");
+}
+
+void testWhenAnyAllFail() {
+    Fakes fakes;
+    auto handler = whenAny(std::vector{fakes.add(10ms, ""), fakes.add(20ms, "")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasError(), "whenAny: fails when every request fails");
+}
+
+void testWhenAllInOrder() {
+    Fakes fakes;
+    auto handler = whenAll(std::vector{fakes.add(30ms, "a"), fakes.add(10ms, "b"), fakes.add(20ms, "c")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasValue() && res->value() == std::vector{u"a"_s, u"b"_s, u"c"_s},
+          "whenAll: every result, in the order of the requests");
+}
+
+void testWhenAllFirstError() {
+    Fakes fakes;
+    auto handler = whenAll(std::vector{fakes.add(200ms, "a"), fakes.add(10ms, ""), fakes.add(200ms, "c")});
+    auto res = wait(handler);
+    check(res.has_value() && res->hasError(), "whenAll: fails with the first error");
+    check(fakes.aborted(0) && fakes.aborted(2), "whenAll: an error aborts the other requests");
+}
+
+void testAbortPropagates() {
+    Fakes fakes;
+    auto handler = whenAll(std::vector{fakes.add(50ms, "a"), fakes.add(50ms, "b"), fakes.add(50ms, "c")});
+    bool called = false;
+    handler.whenFinished([&](Expected<std::vector<QString>>) { called = true; });
+    AbortHandler{handler}.abort();
+    runFor(100ms);
+    check(fakes.aborted(0) && fakes.aborted(1) && fakes.aborted(2), "abort: one abort cancels every request");
+    check(!called, "abort: no callback after abort");
+}
+
+void testAbortChain() {
+    // a group as one stage of a chain: aborting the chain reaches the group's requests
+    Fakes fakes;
+    auto first = fakes.add(10ms, "first");
+    auto handler = first.thenRqst([&fakes](QString) {
+        return race(std::vector{fakes.add(100ms, "x"), fakes.add(100ms, "y")});
+    });
+    bool called = false;
+    handler.whenFinished([&](Expected<QString>) { called = true; });
+    AbortHandler aborter{handler};
+    runFor(30ms);
+    aborter.abort();
+    runFor(150ms);
+    check(fakes.replies.size() == 3, "chain: the group is started after the first request");
+    check(fakes.replies.size() == 3 && fakes.aborted(1) && fakes.aborted(2),
+          "chain: aborting the chain aborts the group's requests");
+    check(!called, "chain: no callback after abort");
+}
+
+} // END anonymous namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+
+    testRaceFirstWins();
+    testRaceFirstErrorWins();
+    testWhenAnySkipsErrors();
+    testWhenAnyAllFail();
+    testWhenAllInOrder();
+    testWhenAllFirstError();
+    testAbortPropagates();
+    testAbortChain();
+
+    if (failures > 0) {
+        qDebug() << failures << "checks failed";
+        return 1;
+    }
+    qDebug() << "all checks passed";
+    return 0;
+}
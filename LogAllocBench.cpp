@@ -0,0 +1,141 @@
+// TopwarLogAllocBench: counts the heap allocations per log() and logEvent() line,
+// on the logging thread and in the whole process (the log writer included).
+// Exits with 1 if a line allocates on the logging thread once its buffers have grown.
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QThread>
+#include <cstdlib>
+#include <new>
+#include "log.h"
+#include "LogSink.h"
+
+namespace {
+
+std::atomic<int64_t> processAllocs{0};
+// trivial, so that counting from malloc never allocates itself
+thread_local int64_t threadAllocs = 0;
+
+void countAlloc() {
+    processAllocs.fetch_add(1, std::memory_order_relaxed);
+    threadAllocs++;
+}
+
+} // END anonymous namespace
+
+#if defined(__GLIBC__)
+// Qt containers allocate with malloc rather than operator new, so malloc itself is counted
+extern "C" {
+void* __libc_malloc(size_t size);
+void* __libc_calloc(size_t n, size_t size);
+void* __libc_realloc(void *p, size_t size);
+
+void* malloc(size_t size) noexcept {
+    countAlloc();
+    return __libc_malloc(size);
+}
+
+void* calloc(size_t n, size_t size) noexcept {
+    countAlloc();
+    return __libc_calloc(n, size);
+}
+
+void* realloc(void *p, size_t size) noexcept {
+    countAlloc();
+    return __libc_realloc(p, size);
+}
+}
+#else
+// only the C++ allocations are seen here, not those of Qt containers
+void* operator new(size_t size) {
+    countAlloc();
+    if (void *p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    std::free(p);
+}
+#endif
+
+namespace {
+
+// Less than the nodes a pool keeps, and the lines are written between two chunks,
+// so that the logging thread stays in its steady state
+constexpr int ChunkLines = 1000;
+constexpr int WarmupChunks = 5;
+constexpr int MeasuredChunks = 20;
+// longer than one round of the log writer
+constexpr auto WriterRound = 300ms;
+
+template <class Func>
+bool measure(const char *name, Func logLine) {
+    auto runChunk = [&](int chunk) {
+        for (int i = 0; i < ChunkLines; i++) {
+            // numbers of the same width, so that every line has the same size
+            logLine(100000 + chunk * ChunkLines + i);
+        }
+    };
+    for (int chunk = 0; chunk < WarmupChunks; chunk++) {
+        runChunk(chunk);
+        QThread::msleep(WriterRound.count());
+    }
+
+    int64_t threadCnt = 0;
+    int64_t processBefore = processAllocs.load();
+    int64_t elapsedNs = 0;
+    for (int chunk = 0; chunk < MeasuredChunks; chunk++) {
+        int64_t threadBefore = threadAllocs;
+        QElapsedTimer timer;
+        timer.start();
+        runChunk(chunk);
+        elapsedNs += timer.nsecsElapsed();
+        threadCnt += threadAllocs - threadBefore;
+        QThread::msleep(WriterRound.count());
+    }
+    int64_t processCnt = processAllocs.load() - processBefore;
+
+    constexpr double lines = double(ChunkLines) * MeasuredChunks;
+    qDebug().noquote() << QString::asprintf(
+        "%s: %.3f allocations per line on the logging thread, %.3f in the process, %.0f ns per line",
+        name, threadCnt / lines, processCnt / lines, elapsedNs / lines);
+    return threadCnt == 0;
+}
+
+} // END anonymous namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+#if !defined(__GLIBC__)
+    qDebug() << "only operator new is counted on this platform";
+#endif
+
+    QTemporaryDir dir;
+    LogSink::instance().start(dir.path());
+
+    const QString username = u"指挥官"_s;
+    bool ok = true;
+    ok &= measure("log()", [](int n) {
+        log() << u"收集金币 "_s << n << u" 个"_s;
+    });
+    ok &= measure("logEvent(int)", [](int n) {
+        logEvent(LogEvent::CollectCoin, 123456789, 42, n);
+    });
+    ok &= measure("logEvent(QString)", [&](int) {
+        logEvent(LogEvent::Connected, 123456789, 42, username);
+    });
+
+    LogSink::instance().stop();
+    if (!ok) {
+        qDebug() << "FAILED: a log line allocates on the logging thread";
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,170 @@
+// TopwarLogDump: decodes and filters the binary log files (logs/*.evlog)
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+#include <QSet>
+#include "EventLog.h"
+#include "GameCatalog.h"
+
+struct Filter {
+    QSet<int> events;
+    optional<int64_t> uid;
+    optional<int> warzone;
+    optional<int64_t> sinceMs;
+    optional<int64_t> untilMs;
+    QString text;
+
+    bool acceptsRecord(const EventRecord &rec) const {
+        return (events.isEmpty() || events.contains(static_cast<int>(rec.event)))
+               && (!uid.has_value() || rec.uid == *uid)
+               && (!warzone.has_value() || rec.warzone == *warzone)
+               && (!sinceMs.has_value() || rec.timeMs >= *sinceMs)
+               && (!untilMs.has_value() || rec.timeMs < *untilMs);
+    }
+};
+
+static optional<int64_t> parseTime(const QString &s) {
+    QDateTime t = QDateTime::fromString(s, Qt::ISODate);
+    if (!t.isValid()) {
+        t = QDate::fromString(s, Qt::ISODate).startOfDay();
+    }
+    if (!t.isValid()) {
+        return {};
+    }
+    return t.toMSecsSinceEpoch();
+}
+
+static QString formatRaw(const EventRecord &rec) {
+    QString s = u"%1 %2 uid=%3 warzone=%4"_s
+        .arg(rec.timeMs).arg(QLatin1StringView{EventLog::eventName(rec.event)})
+        .arg(rec.uid).arg(rec.warzone);
+    for (const auto &arg : rec.args) {
+        s += u' ';
+        std::visit([&s](const auto &v) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(v)>, QString>) {
+                s += u'"' + v + u'"';
+            } else {
+                s += QString::number(v);
+            }
+        }, arg);
+    }
+    return s;
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(u"TopwarLogDump"_s);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(u"Decodes and filters TopwarHelper binary log files."_s);
+    parser.addHelpOption();
+    parser.addPositionalArgument(u"files"_s, u"Log files, decoded in the given order."_s, u"files..."_s);
+    QCommandLineOption eventOpt{{u"e"_s, u"event"_s}, u"Only records of this event (repeatable)."_s, u"name"_s};
+    QCommandLineOption uidOpt{u"uid"_s, u"Only records of this game uid."_s, u"uid"_s};
+    QCommandLineOption warzoneOpt{{u"w"_s, u"warzone"_s}, u"Only records in this warzone."_s, u"warzone"_s};
+    QCommandLineOption sinceOpt{u"since"_s, u"Only records at or after this ISO date/time."_s, u"time"_s};
+    QCommandLineOption untilOpt{u"until"_s, u"Only records before this ISO date/time."_s, u"time"_s};
+    QCommandLineOption grepOpt{{u"g"_s, u"grep"_s}, u"Only lines containing this text."_s, u"text"_s};
+    QCommandLineOption rawOpt{u"raw"_s, u"Print event names and arguments instead of text."_s};
+    QCommandLineOption listOpt{u"list-events"_s, u"List the event names and exit."_s};
+    parser.addOptions({eventOpt, uidOpt, warzoneOpt, sinceOpt, untilOpt, grepOpt, rawOpt, listOpt});
+    parser.process(app);
+
+    QTextStream out{stdout};
+    QTextStream err{stderr};
+
+    if (parser.isSet(listOpt)) {
+        for (int i = 0; i < static_cast<int>(LogEvent::EventCount); i++) {
+            out << EventLog::eventName(static_cast<LogEvent>(i)) << Qt::endl;
+        }
+        return 0;
+    }
+
+    Filter filter;
+    for (const QString &name : parser.values(eventOpt)) {
+        auto event = EventLog::eventFromName(name);
+        if (!event.has_value()) {
+            err << "unknown event: " << name << Qt::endl;
+            return 2;
+        }
+        filter.events.insert(static_cast<int>(*event));
+    }
+    if (parser.isSet(uidOpt)) {
+        filter.uid = parser.value(uidOpt).toLongLong();
+    }
+    if (parser.isSet(warzoneOpt)) {
+        filter.warzone = parser.value(warzoneOpt).toInt();
+    }
+    if (parser.isSet(sinceOpt)) {
+        filter.sinceMs = parseTime(parser.value(sinceOpt));
+        if (!filter.sinceMs.has_value()) {
+            err << "invalid time: " << parser.value(sinceOpt) << Qt::endl;
+            return 2;
+        }
+    }
+    if (parser.isSet(untilOpt)) {
+        filter.untilMs = parseTime(parser.value(untilOpt));
+        if (!filter.untilMs.has_value()) {
+            err << "invalid time: " << parser.value(untilOpt) << Qt::endl;
+            return 2;
+        }
+    }
+    filter.text = parser.value(grepOpt);
+    bool raw = parser.isSet(rawOpt);
+    // item and site names, as the app shows them
+    GameCatalog::instance().load(QDir{QCoreApplication::applicationDirPath()}.filePath(u"gamedata.cat"_s));
+
+    const QStringList files = parser.positionalArguments();
+    if (files.isEmpty()) {
+        parser.showHelp(2);
+    }
+
+    // shared over the files, so that usernames carry over
+    EventFormatter formatter;
+    QString line;
+    int ret = 0;
+    for (const QString &filePath : files) {
+        QFile file{filePath};
+        if (!file.open(QIODevice::ReadOnly)) {
+            err << filePath << ": " << file.errorString() << Qt::endl;
+            ret = 1;
+            continue;
+        }
+        const QByteArray content = file.readAll();
+        QByteArrayView data{content};
+        if (!data.startsWith(EventLogMagic)) {
+            err << filePath << ": not a log file" << Qt::endl;
+            ret = 1;
+            continue;
+        }
+        data = data.sliced(EventLogMagic.size());
+        while (!data.isEmpty()) {
+            auto rec = EventRecord::decode(data);
+            if (!rec.has_value()) {
+                // the tail of a file being written, or a torn write
+                err << filePath << ": " << data.size() << " bytes of incomplete record skipped" << Qt::endl;
+                break;
+            }
+            if (!filter.acceptsRecord(*rec)) {
+                // still needed for the usernames
+                formatter.observe(*rec);
+                continue;
+            }
+            if (raw) {
+                line = formatRaw(*rec);
+            } else {
+                line.resize(0);
+                formatter.formatTo(line, *rec);
+            }
+            if (!filter.text.isEmpty() && !line.contains(filter.text)) {
+                continue;
+            }
+            out << line << '\n';
+        }
+    }
+    out.flush();
+    return ret;
+}
@@ -0,0 +1,242 @@
+#include <QtCore>
+#include <QColor>
+#include "LogModel.h"
+
+LogModel::LogModel(int capacity, QObject *parent)
+    : QAbstractListModel{parent}, ring(max(capacity, 1))
+{
+}
+
+int LogModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : static_cast<int>(count);
+}
+
+QVariant LogModel::data(const QModelIndex &index, int role) const {
+    if (!index.isValid() || index.row() >= static_cast<int>(count)) {
+        return {};
+    }
+    const Entry &e = entry(index.row());
+    switch (role) {
+    case Qt::DisplayRole: {
+        // the rows painted together are mostly in the same second
+        QStringView prefix = timePrefix.get(e.timeMs);
+        QString s;
+        s.reserve(prefix.size() + e.message.size());
+        s += prefix;
+        s += e.message;
+        return s;
+    }
+    case Qt::ForegroundRole:
+        if (e.severity == LogSeverity::Warning) {
+            return QColor{Qt::darkRed};
+        }
+        return {};
+    case UidRole:
+        return QVariant::fromValue<qint64>(e.uid);
+    case WarzoneRole:
+        return e.warzone;
+    case SeverityRole:
+        return static_cast<int>(e.severity);
+    case TimeRole:
+        return QVariant::fromValue<qint64>(e.timeMs);
+    default:
+        return {};
+    }
+}
+
+LogModel::Entry LogModel::makeEntry(const EventRecord &rec, EventFormatter &formatter) {
+    return Entry{rec.timeMs, rec.uid, rec.warzone, EventLog::severityOf(rec.event), formatter.formatMessage(rec)};
+}
+
+void LogModel::noteAccount(const EventRecord &rec) {
+    if (rec.event != LogEvent::Connected || rec.uid == 0) {
+        return;
+    }
+    QString name = rec.stringArg(0);
+    auto it = accounts.constFind(rec.uid);
+    if (it != accounts.cend() && *it == name) {
+        return;
+    }
+    accounts.insert(rec.uid, name);
+    emit accountSeen(rec.uid, name);
+}
+
+void LogModel::append(const std::vector<EventRecord> &records) {
+    const size_t cap = ring.size();
+    // records that would be removed right away are only formatted for the usernames
+    size_t skip = records.size() > cap ? records.size() - cap : 0;
+    for (size_t i = 0; i < skip; i++) {
+        noteAccount(records[i]);
+        formatter.observe(records[i]);
+    }
+    size_t n = records.size() - skip;
+    if (n == 0) {
+        return;
+    }
+
+    if (count + n > cap) {
+        size_t removeCnt = count + n - cap;
+        beginRemoveRows({}, 0, static_cast<int>(removeCnt) - 1);
+        head = (head + removeCnt) % cap;
+        count -= removeCnt;
+        endRemoveRows();
+        historyStale = true;
+    }
+    beginInsertRows({}, static_cast<int>(count), static_cast<int>(count + n) - 1);
+    for (size_t i = 0; i < n; i++) {
+        const EventRecord &rec = records[skip + i];
+        noteAccount(rec);
+        ring[(head + count + i) % cap] = makeEntry(rec, formatter);
+    }
+    count += n;
+    endInsertRows();
+}
+
+void LogModel::prepend(std::vector<Entry> entries) {
+    const size_t cap = ring.size();
+    if (entries.size() > cap) {
+        // the newest of them are next to the current entries
+        entries.erase(entries.begin(), entries.end() - cap);
+    }
+    size_t n = entries.size();
+    if (n == 0) {
+        return;
+    }
+
+    if (count + n > cap) {
+        size_t removeCnt = count + n - cap;
+        beginRemoveRows({}, static_cast<int>(count - removeCnt), static_cast<int>(count) - 1);
+        count -= removeCnt;
+        endRemoveRows();
+    }
+    beginInsertRows({}, 0, static_cast<int>(n) - 1);
+    head = (head + cap - n) % cap;
+    for (size_t i = 0; i < n; i++) {
+        ring[(head + i) % cap] = std::move(entries[i]);
+    }
+    count += n;
+    endInsertRows();
+}
+
+void LogModel::setHistoryDir(const QString &dir) {
+    historyDir = dir;
+    historyStale = true;
+}
+
+void LogModel::listHistoryFiles() {
+    QFileInfoList infos = QDir{historyDir}.entryInfoList({u"*.evlog"_s}, QDir::Files);
+    // yyyy-MM-dd.evlog, then yyyy-MM-dd.1.evlog, ... on the same day
+    auto sortKey = [](const QFileInfo &info) {
+        QString base = info.completeBaseName();
+        return pair{base.left(10), base.mid(11).toInt()};
+    };
+    std::sort(infos.begin(), infos.end(), [&sortKey](const QFileInfo &a, const QFileInfo &b) {
+        return sortKey(a) > sortKey(b);
+    });
+    historyFiles.clear();
+    for (const QFileInfo &info : std::as_const(infos)) {
+        historyFiles.append(info.filePath());
+    }
+    nextHistoryFile = 0;
+    historyData.clear();
+    historyRefs.clear();
+    // the names of the accounts which connected in newer files
+    historyFormatter = formatter;
+}
+
+void LogModel::readHistoryFile(const QString &path, int64_t before) {
+    historyData.clear();
+    historyRefs.clear();
+    QFile file{path};
+    if (!file.open(QIODevice::ReadOnly)) {
+        qDebug() << "failed to open log file" << path << file.errorString();
+        return;
+    }
+    historyData = file.readAll();
+    QByteArrayView data{historyData};
+    if (!data.startsWith(EventLogMagic)) {
+        historyData.clear();
+        return;
+    }
+    data = data.sliced(EventLogMagic.size());
+    while (!data.isEmpty()) {
+        qsizetype offset = historyData.size() - data.size();
+        auto rec = EventRecord::decode(data);
+        if (!rec.has_value()) {
+            // the tail of the file being written
+            break;
+        }
+        // in file order, so that the usernames are known when the records are formatted
+        historyFormatter.observe(*rec);
+        if (rec->timeMs < before) {
+            historyRefs.push_back({rec->timeMs, offset});
+        }
+    }
+}
+
+int LogModel::loadOlder(int n) {
+    if (historyDir.isEmpty() || n <= 0) {
+        return 0;
+    }
+    if (historyStale) {
+        historyStale = false;
+        listHistoryFiles();
+    }
+    // the records from this time on are in the model already
+    int64_t before = count > 0 ? entry(0).timeMs : std::numeric_limits<int64_t>::max();
+
+    std::vector<Entry> entries;
+    while (entries.size() < static_cast<size_t>(n)) {
+        while (!historyRefs.empty() && historyRefs.back().timeMs >= before) {
+            historyRefs.pop_back();
+        }
+        if (historyRefs.empty()) {
+            if (nextHistoryFile >= historyFiles.size()) {
+                break;
+            }
+            readHistoryFile(historyFiles[nextHistoryFile++], before);
+            continue;
+        }
+        QByteArrayView data = QByteArrayView{historyData}.sliced(historyRefs.back().offset);
+        historyRefs.pop_back();
+        if (auto rec = EventRecord::decode(data)) {
+            if (!accounts.contains(rec->uid)) {
+                // an older name does not replace the current one
+                noteAccount(*rec);
+            }
+            entries.push_back(makeEntry(*rec, historyFormatter));
+        }
+    }
+    if (historyRefs.empty()) {
+        historyData.clear();
+    }
+    std::reverse(entries.begin(), entries.end());
+    int ret = static_cast<int>(entries.size());
+    prepend(std::move(entries));
+    return ret;
+}
+
+
+void LogFilterModel::setUid(int64_t uid) {
+    this->uid = uid;
+    invalidateFilter();
+}
+
+void LogFilterModel::setWarzone(int warzone) {
+    this->warzone = warzone;
+    invalidateFilter();
+}
+
+void LogFilterModel::setMinSeverity(LogSeverity severity) {
+    minSeverity = severity;
+    invalidateFilter();
+}
+
+bool LogFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const {
+    auto model = static_cast<const LogModel*>(sourceModel());
+    const LogModel::Entry &e = model->entry(sourceRow);
+    bool unattributedWarning = e.uid == 0 && e.severity == LogSeverity::Warning;
+    return (uid == 0 || e.uid == uid || unattributedWarning)
+           && (warzone == 0 || e.warzone == warzone || unattributedWarning)
+           && e.severity >= minSeverity;
+}
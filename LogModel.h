@@ -0,0 +1,117 @@
+#pragma once
+
+#include <QAbstractListModel>
+#include <QSortFilterProxyModel>
+#include "EventLog.h"
+
+/**
+ * The log lines shown in the main window.
+ *
+ * Keeps at most capacity entries in a ring buffer, so that a long run takes
+ * constant memory and appending never moves the older entries. Each entry is
+ * formatted once when added, without the time, which is only made for the
+ * rows a view paints. Older entries are paged in from the log files on demand
+ * (see loadOlder), taking the place of the newest ones when full.
+ */
+class LogModel: public QAbstractListModel
+{
+    Q_OBJECT
+
+public:
+    enum Role {
+        UidRole = Qt::UserRole + 1,
+        WarzoneRole,
+        SeverityRole,
+        TimeRole
+    };
+
+    struct Entry {
+        int64_t timeMs{0};
+        int64_t uid{0};
+        int warzone{0};
+        LogSeverity severity{LogSeverity::Info};
+        QString message;
+    };
+
+    explicit LogModel(int capacity, QObject *parent = nullptr);
+
+    int rowCount(const QModelIndex &parent = {}) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+    const Entry& entry(int row) const {
+        return ring[(head + row) % ring.size()];
+    }
+
+    // Appends records in order, removing the oldest entries over the capacity
+    void append(const std::vector<EventRecord> &records);
+
+    // Directory of the *.evlog files that loadOlder() reads
+    void setHistoryDir(const QString &dir);
+
+    /**
+     * Inserts up to n entries from the log files before the oldest entry,
+     * removing the newest entries over the capacity.
+     * Returns the number of entries inserted, 0 when there are no older ones.
+     */
+    int loadOlder(int n);
+
+signals:
+    // An account is seen for the first time, or under a new name
+    void accountSeen(int64_t uid, const QString &name);
+
+private:
+    struct HistoryRef {
+        int64_t timeMs;
+        qsizetype offset;
+    };
+
+    void prepend(std::vector<Entry> entries);
+    void noteAccount(const EventRecord &rec);
+    void listHistoryFiles();
+    void readHistoryFile(const QString &path, int64_t before);
+    static Entry makeEntry(const EventRecord &rec, EventFormatter &formatter);
+
+    std::vector<Entry> ring;
+    size_t head{0};
+    size_t count{0};
+    EventFormatter formatter;
+    mutable TimePrefix timePrefix;
+    QHash<int64_t, QString> accounts;
+
+    QString historyDir;
+    // newest first
+    QStringList historyFiles;
+    qsizetype nextHistoryFile{0};
+    // set when the oldest entries are removed, the files are then read again from the newest
+    bool historyStale{true};
+    // the file being paged through, with the records still to take, oldest first
+    QByteArray historyData;
+    std::vector<HistoryRef> historyRefs;
+    EventFormatter historyFormatter;
+};
+
+
+/**
+ * Filters the rows of a LogModel by account, warzone and severity.
+ */
+class LogFilterModel: public QSortFilterProxyModel
+{
+    Q_OBJECT
+
+public:
+    using QSortFilterProxyModel::QSortFilterProxyModel;
+
+    // 0 for all accounts. Warnings of no account are kept, they may be about any
+    void setUid(int64_t uid);
+    // 0 for all warzones
+    void setWarzone(int warzone);
+    void setMinSeverity(LogSeverity severity);
+
+protected:
+    bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+    int64_t uid{0};
+    int warzone{0};
+    LogSeverity minSeverity{LogSeverity::Info};
+};
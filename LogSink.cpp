@@ -0,0 +1,313 @@
+#include <QtCore>
+#include "LogSink.h"
+
+constexpr size_t MaxQueuedRecords = 65536;
+// a pool keeps about what a busy thread has in flight between two writer rounds
+constexpr int64_t MaxKeptPoolRecords = 1024;
+constexpr qsizetype MaxKeptRecordCapacity = 4_KiB;
+constexpr size_t MaxBatchRecords = 1024;
+constexpr auto FileFlushInterval = 250ms;
+// how long a gap in the record numbers holds back the records after it
+constexpr auto MaxReorderWait = 1s;
+constexpr int64_t MaxLogFileSize = 8_MiB;
+constexpr auto MaxLogFileAge = std::chrono::hours{24 * 14};
+
+// the view keeps more than this, but a burst is skipped over rather than shown
+constexpr size_t MaxUiQueuedRecords = 2000;
+constexpr auto UiFlushInterval = 250ms;
+
+LogSink& LogSink::instance() {
+    static LogSink sink;
+    return sink;
+}
+
+LogSink::LogSink()
+    : reorderRing(MaxQueuedRecords, nullptr) {}
+
+LogSink::~LogSink() {
+    stop();
+}
+
+void LogSink::start(const QString &dir) {
+    QMutexLocker locker{&writerMutex};
+    if (writerThread != nullptr) {
+        return;
+    }
+    this->dir = dir;
+    QDir{}.mkpath(dir);
+    stopping = false;
+    writerThread = QThread::create([this] { runWriter(); });
+    writerThread->setObjectName(u"log-writer"_s);
+    writerThread->start(QThread::LowPriority);
+}
+
+void LogSink::stop() {
+    {
+        QMutexLocker locker{&uiMutex};
+        uiContext = nullptr;
+        uiCallback = {};
+    }
+    QThread *thread;
+    {
+        QMutexLocker locker{&writerMutex};
+        thread = std::exchange(writerThread, nullptr);
+        stopping = true;
+        wakeWriter.wakeAll();
+    }
+    if (thread != nullptr) {
+        thread->wait();
+        delete thread;
+        file.close();
+    }
+}
+
+void LogSink::setUiCallback(QObject *context, Callback<const std::vector<EventRecord>&> callback) {
+    QMutexLocker locker{&uiMutex};
+    uiContext = context;
+    uiCallback = std::move(callback);
+}
+
+void LogSink::push(QByteArrayView record) {
+    int64_t n = queuedCnt.fetch_add(1, std::memory_order_relaxed);
+    if (n >= int64_t(MaxQueuedRecords)) {
+        queuedCnt.fetch_sub(1, std::memory_order_relaxed);
+        droppedCnt.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    Record *rec = takeRecord();
+    // the buffer is never shared, so it keeps its capacity
+    rec->data.resize(0);
+    rec->data.append(record);
+    // numbered right before linking, so that a gap in the numbers closes soon
+    rec->seq = nextSeq.fetch_add(1, std::memory_order_relaxed);
+    queue.push(rec);
+    if (n + 1 == int64_t(MaxBatchRecords)) {
+        // otherwise the writer finds the records on its next round
+        wakeWriter.wakeOne();
+    }
+}
+
+LogSink::RecordPool* LogSink::threadPool() {
+    struct FreePools {
+        QMutex mutex;
+        std::vector<RecordPool*> pools;
+    };
+    // never destroyed, a thread may exit after the sink
+    static auto *freePools = new FreePools;
+
+    struct Handle {
+        RecordPool *pool;
+
+        Handle() {
+            QMutexLocker locker{&freePools->mutex};
+            if (freePools->pools.empty()) {
+                pool = new RecordPool;
+            } else {
+                pool = freePools->pools.back();
+                freePools->pools.pop_back();
+            }
+        }
+
+        ~Handle() {
+            QMutexLocker locker{&freePools->mutex};
+            freePools->pools.push_back(pool);
+        }
+    };
+    static thread_local Handle handle;
+    return handle.pool;
+}
+
+LogSink::Record* LogSink::takeRecord() {
+    RecordPool *pool = threadPool();
+    Record *rec = pool->returned.tryPop();
+    if (rec != nullptr && pool->size > MaxKeptPoolRecords) {
+        // shrinks back after a burst, one node per push
+        delete rec;
+        pool->size--;
+        rec = pool->returned.tryPop();
+    }
+    if (rec == nullptr) {
+        rec = new Record;
+        rec->pool = pool;
+        pool->size++;
+    }
+    return rec;
+}
+
+void LogSink::releaseRecords(const std::vector<Record*> &records) {
+    for (Record *rec : records) {
+        if (rec->data.capacity() > MaxKeptRecordCapacity) {
+            // a rare long record does not pin its buffer
+            rec->data = QByteArray{};
+        }
+        rec->pool->returned.push(rec);
+    }
+    queuedCnt.fetch_sub(int64_t(records.size()), std::memory_order_relaxed);
+}
+
+void LogSink::pushToUi(const std::vector<Record*> &records) {
+    QMutexLocker locker{&uiMutex};
+    if (uiContext == nullptr || records.empty()) {
+        return;
+    }
+    for (const Record *rec : records) {
+        // the newest lines matter most on screen
+        if (uiQueue.size() >= MaxUiQueuedRecords) {
+            uiQueue.pop_front();
+            uiDroppedCnt++;
+        }
+        // a deep copy, as the node is reused once written
+        uiQueue.emplace_back(rec->data.constData(), rec->data.size());
+    }
+    if (!uiFlushPending) {
+        uiFlushPending = true;
+        QMetaObject::invokeMethod(uiContext, [this, context=uiContext] {
+            QTimer::singleShot(UiFlushInterval, context, [this] { flushUi(); });
+        }, Qt::QueuedConnection);
+    }
+}
+
+void LogSink::flushUi() {
+    std::deque<QByteArray> records;
+    int64_t droppedCnt;
+    Callback<const std::vector<EventRecord>&> callback;
+    {
+        QMutexLocker locker{&uiMutex};
+        uiFlushPending = false;
+        records.swap(uiQueue);
+        droppedCnt = std::exchange(uiDroppedCnt, 0);
+        callback = uiCallback;
+    }
+    std::vector<EventRecord> decoded;
+    decoded.reserve(records.size() + 1);
+    if (droppedCnt > 0) {
+        EventRecord rec;
+        rec.timeMs = QDateTime::currentMSecsSinceEpoch();
+        rec.event = LogEvent::Dropped;
+        rec.args.emplace_back(droppedCnt);
+        decoded.push_back(std::move(rec));
+    }
+    for (const QByteArray &record : records) {
+        QByteArrayView data{record};
+        if (auto rec = EventRecord::decode(data)) {
+            decoded.push_back(std::move(*rec));
+        }
+    }
+    if (!decoded.empty() && callback) {
+        callback(decoded);
+    }
+}
+
+void LogSink::runWriter() {
+    while (true) {
+        // read before draining, so that every record pushed before stop() is written
+        bool done = stopping;
+        takeOrdered(done, batch);
+        writeBatch(batch, droppedCnt.exchange(0, std::memory_order_relaxed));
+        pushToUi(batch);
+        releaseRecords(batch);
+        if (done) {
+            break;
+        }
+        QMutexLocker locker{&writerMutex};
+        if (!stopping) {
+            wakeWriter.wait(&writerMutex, QDeadlineTimer{FileFlushInterval});
+        }
+    }
+}
+
+void LogSink::takeOrdered(bool all, std::vector<Record*> &out) {
+    out.clear();
+    const uint64_t ringSize = reorderRing.size();
+    while (Record *rec = queue.tryPop()) {
+        if (rec->seq < expectedSeq) {
+            // its gap was skipped before, goes out right away
+            out.push_back(rec);
+            continue;
+        }
+        Q_ASSERT(reorderRing[rec->seq % ringSize] == nullptr);
+        reorderRing[rec->seq % ringSize] = rec;
+        endSeq = max(endSeq, rec->seq + 1);
+    }
+
+    auto now = SteadyClockNow();
+    if (expectedSeq < endSeq && reorderRing[expectedSeq % ringSize] == nullptr) {
+        // a thread took a number but has not linked its record yet
+        if (gapSince == SteadyTimepoint{}) {
+            gapSince = now;
+        }
+        if (!all && now - gapSince > MaxReorderWait) {
+            while (reorderRing[expectedSeq % ringSize] == nullptr) {
+                expectedSeq++;
+            }
+        }
+    }
+    while (expectedSeq < endSeq) {
+        Record *&slot = reorderRing[expectedSeq % ringSize];
+        if (slot != nullptr) {
+            out.push_back(std::exchange(slot, nullptr));
+        } else if (!all) {
+            break;
+        }
+        expectedSeq++;
+    }
+    if (!out.empty() || expectedSeq == endSeq) {
+        gapSince = {};
+    }
+}
+
+void LogSink::writeBatch(const std::vector<Record*> &records, int64_t droppedCnt) {
+    if (records.empty() && droppedCnt == 0) {
+        return;
+    }
+    QDate today = QDate::currentDate();
+    if (!file.isOpen() || today != fileDate || file.size() >= MaxLogFileSize) {
+        openFile(today);
+    }
+    if (!file.isOpen()) {
+        return;
+    }
+    // the file buffers the records, they are not joined first
+    if (file.size() == 0) {
+        file.write(EventLogMagic.data(), EventLogMagic.size());
+    }
+    if (droppedCnt > 0) {
+        QByteArray record;
+        EventLog::encode(record, QDateTime::currentMSecsSinceEpoch(), LogEvent::Dropped, 0, 0, droppedCnt);
+        file.write(record);
+    }
+    for (const Record *rec : records) {
+        file.write(rec->data);
+    }
+    file.flush();
+}
+
+void LogSink::openFile(QDate date) {
+    file.close();
+    if (date != fileDate) {
+        fileDate = date;
+        removeOldFiles();
+    }
+    QDir logDir{dir};
+    QString baseName = date.toString(u"yyyy-MM-dd"_s);
+    for (int i = 0; ; i++) {
+        QString name = i == 0 ? baseName + u".evlog"_s : u"%1.%2.evlog"_s.arg(baseName).arg(i);
+        file.setFileName(logDir.filePath(name));
+        if (!file.exists() || file.size() < MaxLogFileSize) {
+            break;
+        }
+    }
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Append)) {
+        qDebug() << "failed to open log file" << file.fileName() << file.errorString();
+    }
+}
+
+void LogSink::removeOldFiles() {
+    QDateTime expireTime = QDateTime::currentDateTime().addSecs(-DurationCast::floor<seconds>(MaxLogFileAge).count());
+    const auto entries = QDir{dir}.entryInfoList({u"*.evlog"_s, u"*.log"_s}, QDir::Files);
+    for (const QFileInfo &info : entries) {
+        if (info.lastModified() < expireTime) {
+            QFile::remove(info.filePath());
+        }
+    }
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+#include <QFile>
+#include <QDate>
+#include <deque>
+#include "EventLog.h"
+#include "MpscQueue.h"
+
+/**
+ * Receives the records of log() and logEvent() from all threads.
+ *
+ * push() takes no lock: each thread encodes its records in its own buffer
+ * (see logEvent()), then push() copies the record into a queue node of the
+ * thread, numbers it and links it into a lock-free MPSC queue. A background
+ * thread drains the queue, puts the records back in the order of their
+ * numbers, writes them (see EventLog.h) to files in batches, and hands them
+ * to the UI, which gets them decoded in one piece at most every
+ * UiFlushInterval. Records are flushed strictly in push order over all
+ * threads. When too many records are queued, new ones are dropped and
+ * counted, so that a burst of logs never blocks a thread.
+ *
+ * Written nodes go back to the thread that pushed them, with the capacity
+ * their buffer grew to, so a thread logging steadily allocates nothing per
+ * record. The writer keeps its buffers as well; only the copies handed to the
+ * UI are allocated per record. A thread makes new nodes only while the records
+ * it has in flight grow, and frees the ones beyond MaxKeptPoolRecords as they
+ * come back after a burst.
+ *
+ * Log files are named logs/yyyy-MM-dd.evlog, starting a new one each day and
+ * whenever one grows over MaxLogFileSize (yyyy-MM-dd.1.evlog, ...). Files older
+ * than MaxLogFileAge are removed. Use TopwarLogDump to read them.
+ *
+ * This class is thread-safe.
+ */
+class LogSink
+{
+public:
+    static LogSink& instance();
+
+    // Starts writing to files in dir, including the records pushed before
+    void start(const QString &dir);
+
+    // Writes the remaining records and stops the writer thread. The UI gets no more lines
+    void stop();
+
+    // callback is called in the thread of context with the records in order
+    void setUiCallback(QObject *context, Callback<const std::vector<EventRecord>&> callback);
+
+    // record is encoded by EventLog::encode(), and copied. Lock-free
+    void push(QByteArrayView record);
+
+private:
+    // drives push() and takeOrdered() from many threads, see LogStress.cpp
+    friend class LogSinkStress;
+
+    struct RecordPool;
+
+    // A queue node. Nodes go back to the pool of the thread that pushed them once written
+    struct Record {
+        std::atomic<Record*> next{nullptr};
+        uint64_t seq{0};
+        QByteArray data;
+        RecordPool *pool{nullptr};
+    };
+
+    // The nodes of one thread. A pool is kept when its thread exits, as some
+    // of its nodes may still be queued, and is taken over by the next thread
+    struct RecordPool {
+        MpscQueue<Record> returned; // pushed by the writer, popped by the owner thread
+        int64_t size{0};            // nodes made, used by the owner thread only
+    };
+
+    LogSink();
+    ~LogSink();
+
+    RecordPool* threadPool();
+    Record* takeRecord();
+    void releaseRecords(const std::vector<Record*> &records);
+
+    void runWriter();
+    // Replaces out with the records that can go out, in the order of their numbers
+    void takeOrdered(bool all, std::vector<Record*> &out);
+    void writeBatch(const std::vector<Record*> &records, int64_t droppedCnt);
+    void openFile(QDate date);
+    void removeOldFiles();
+    void pushToUi(const std::vector<Record*> &records);
+    void flushUi();
+
+    MpscQueue<Record> queue;
+    std::atomic<uint64_t> nextSeq{0};
+    // records pushed and not yet written
+    std::atomic<int64_t> queuedCnt{0};
+    std::atomic<int64_t> droppedCnt{0};
+    std::atomic<bool> stopping{false};
+
+    QMutex writerMutex;
+    QWaitCondition wakeWriter;
+    QThread *writerThread{nullptr};
+
+    // used in the writer thread only
+    QString dir;
+    QFile file;
+    QDate fileDate;
+    std::vector<Record*> batch;
+    // the records held back by a gap, at their number modulo the size. The numbers
+    // not yet written never span more than MaxQueuedRecords, so they never collide
+    std::vector<Record*> reorderRing;
+    uint64_t expectedSeq{0};
+    uint64_t endSeq{0}; // one past the highest number in reorderRing
+    SteadyTimepoint gapSince;
+
+    QMutex uiMutex;
+    std::deque<QByteArray> uiQueue;
+    int64_t uiDroppedCnt{0};
+    bool uiFlushPending{false};
+    QObject *uiContext{nullptr};
+    Callback<const std::vector<EventRecord>&> uiCallback;
+};
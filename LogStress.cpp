@@ -0,0 +1,124 @@
+// TopwarLogStress: runs producer threads through LogSink::push() and drains the
+// queue the way the writer does. Checks that every record arrives exactly once,
+// in the order of its producer, and after LogSink::takeOrdered() in the order of
+// its number over all threads. Exits with 1 on a failure.
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QThread>
+#include "LogSink.h"
+
+constexpr int RecordsPerProducer = 200000;
+constexpr int MaxReportedFailures = 10;
+
+class LogSinkStress
+{
+public:
+    explicit LogSinkStress(int producerCnt)
+        : producerCnt{producerCnt}, nextIndex(producerCnt, 0) {}
+
+    bool run() {
+        const int64_t total = int64_t(producerCnt) * RecordsPerProducer;
+        // stays under the queue bound, so that nothing is dropped
+        const int64_t maxQueued = int64_t(sink.reorderRing.size()) / 2;
+        std::atomic<int> running{producerCnt};
+        std::vector<QThread*> producers;
+        for (int p = 0; p < producerCnt; p++) {
+            producers.push_back(QThread::create([this, p, maxQueued, &running] {
+                QByteArray buf;
+                for (int i = 0; i < RecordsPerProducer; i++) {
+                    while (sink.queuedCnt.load(std::memory_order_relaxed) > maxQueued) {
+                        QThread::yieldCurrentThread();
+                    }
+                    EventLog::encode(buf, 0, LogEvent::CollectCoin, p, 0, i);
+                    sink.push(buf);
+                }
+                running--;
+            }));
+        }
+
+        QElapsedTimer timer;
+        timer.start();
+        for (QThread *thread : producers) {
+            thread->start();
+        }
+        std::vector<LogSink::Record*> batch;
+        while (running > 0) {
+            sink.takeOrdered(false, batch);
+            if (batch.empty()) {
+                QThread::yieldCurrentThread();
+            }
+            verify(batch);
+            sink.releaseRecords(batch);
+        }
+        // every record is linked once its producer is done
+        sink.takeOrdered(true, batch);
+        verify(batch);
+        sink.releaseRecords(batch);
+        int64_t elapsedMs = timer.elapsed();
+        for (QThread *thread : producers) {
+            thread->wait();
+            delete thread;
+        }
+
+        expect(received == total, "records lost or duplicated");
+        expect(nextSeq == uint64_t(total), "record numbers lost");
+        expect(sink.droppedCnt.load() == 0, "records dropped under the queue bound");
+        for (int p = 0; p < producerCnt; p++) {
+            expect(nextIndex[p] == RecordsPerProducer, "records of a producer lost");
+        }
+        qDebug().noquote() << QString::asprintf("%d producers, %lld records in %lld ms, %.1f M records/s",
+            producerCnt, static_cast<long long>(received), static_cast<long long>(elapsedMs),
+            elapsedMs == 0 ? 0.0 : received / 1000.0 / elapsedMs);
+        return failures == 0;
+    }
+
+private:
+    void verify(const std::vector<LogSink::Record*> &records) {
+        for (const LogSink::Record *rec : records) {
+            // the numbers are dense, in order they come out one after another
+            expect(rec->seq == nextSeq, "out of the global order");
+            nextSeq = rec->seq + 1;
+
+            QByteArrayView data{rec->data};
+            auto decoded = EventRecord::decode(data);
+            if (!expect(decoded.has_value() && decoded->uid >= 0 && decoded->uid < producerCnt, "corrupt record")) {
+                continue;
+            }
+            int64_t &expected = nextIndex[decoded->uid];
+            int64_t index = decoded->intArg(0);
+            expect(index == expected, "out of the order of its producer");
+            expected = index + 1;
+            received++;
+        }
+    }
+
+    bool expect(bool ok, const char *what) {
+        if (!ok && failures++ < MaxReportedFailures) {
+            qDebug() << "FAILED:" << what;
+        }
+        return ok;
+    }
+
+    LogSink sink;
+    int producerCnt;
+    std::vector<int64_t> nextIndex;
+    uint64_t nextSeq{0};
+    int64_t received{0};
+    int failures{0};
+};
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    int producerCnt = max(QThread::idealThreadCount(), 4);
+    if (argc > 1) {
+        producerCnt = max(QByteArray{argv[1]}.toInt(), 1);
+    }
+
+    LogSinkStress stress{producerCnt};
+    if (!stress.run()) {
+        return 1;
+    }
+    qDebug() << "all checks passed";
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <QtCore>
+#include "LoginAdmission.h"
+
+constexpr auto LoginSlotTimeout = 60s;
+
+LoginAdmission::LoginAdmission(int maxConcurrent)
+    : maxConcurrent{max(maxConcurrent, 1)}
+{
+    reclaimTimer.setSingleShot(true);
+    QObject::connect(&reclaimTimer, &QTimer::timeout, [this] {
+        QMutexLocker locker{&mutex};
+        reclaimAt.reset();
+        admitNext();
+    });
+}
+
+milliseconds LoginAdmission::phaseOf(const QString &key, milliseconds window) {
+    if (window <= 0ms) {
+        return 0ms;
+    }
+    return milliseconds{stableHash(key.toUtf8()) % window.count()};
+}
+
+void LoginAdmission::setMaxConcurrent(int n) {
+    QMutexLocker locker{&mutex};
+    maxConcurrent = max(n, 1);
+    admitNext();
+}
+
+void LoginAdmission::acquire(QObject *context, Callback<> onAdmitted) {
+    QMutexLocker locker{&mutex};
+    if (active.contains(context)) {
+        // already holding a slot, e.g. retrying a login
+        QMetaObject::invokeMethod(context, std::move(onAdmitted), Qt::QueuedConnection);
+        return;
+    }
+    auto queued = std::find_if(queue.begin(), queue.end(), [=](const Waiter &w) { return w.context == context; });
+    if (queued != queue.end()) {
+        // already waiting, keeps its place in the queue. Only the latest callback is called
+        queued->onAdmitted = std::move(onAdmitted);
+        return;
+    }
+    queue.push_back(Waiter{context, std::move(onAdmitted), SteadyClockNow()});
+    admitNext();
+}
+
+void LoginAdmission::release(QObject *context) {
+    QMutexLocker locker{&mutex};
+    if (active.erase(context) > 0) {
+        admitNext();
+    }
+}
+
+void LoginAdmission::cancel(QObject *context) {
+    QMutexLocker locker{&mutex};
+    std::erase_if(queue, [=](const Waiter &w) { return w.context == context; });
+    active.erase(context);
+    admitNext();
+}
+
+LoginAdmission::Stats LoginAdmission::takeStats() {
+    QMutexLocker locker{&mutex};
+    Stats ret;
+    ret.queueDepth = static_cast<int>(queue.size());
+    ret.active = static_cast<int>(active.size());
+    ret.admitted = admittedCnt;
+    ret.avgWait = admittedCnt == 0 ? 0ms : totalWait / admittedCnt;
+    ret.maxWait = maxWait;
+    admittedCnt = 0;
+    totalWait = 0ms;
+    maxWait = 0ms;
+    return ret;
+}
+
+// mutex must be locked by caller.
+// Callbacks are posted with the mutex held, so that once cancel() returns,
+// nothing is posted to the canceled context any more.
+void LoginAdmission::admitNext() {
+    auto now = SteadyClockNow();
+    std::erase_if(active, [=](const auto &slot) {
+        return slot.second + LoginSlotTimeout < now;
+    });
+
+    while (!queue.empty() && static_cast<int>(active.size()) < maxConcurrent) {
+        Waiter w = std::move(queue.front());
+        queue.pop_front();
+        auto wait = DurationCast::round<milliseconds>(now - w.enqueueTime);
+        admittedCnt++;
+        totalWait += wait;
+        maxWait = max(maxWait, wait);
+        active[w.context] = now;
+        QMetaObject::invokeMethod(w.context, std::move(w.onAdmitted), Qt::QueuedConnection);
+    }
+    armReclaimTimer();
+}
+
+// mutex must be locked by caller.
+// Waiters must not depend on another account calling acquire() or release()
+// to get the slot of a login that never finishes.
+void LoginAdmission::armReclaimTimer() {
+    if (active.empty()) {
+        return;
+    }
+    auto oldest = std::min_element(active.begin(), active.end(), [](const auto &a, const auto &b) {
+        return a.second < b.second;
+    });
+    SteadyTimepoint deadline = oldest->second + LoginSlotTimeout;
+    if (reclaimAt.has_value() && *reclaimAt <= deadline) {
+        // fires earlier, and arms again for the next deadline then
+        return;
+    }
+    reclaimAt = deadline;
+    auto delay = DurationCast::ceil<milliseconds>(deadline - SteadyClockNow()) + 1ms;
+    // started in the thread of the timer, admitNext() may run in any thread
+    QMetaObject::invokeMethod(&reclaimTimer, [this, delay] {
+        reclaimTimer.start(max(delay, 0ms));
+    });
+}
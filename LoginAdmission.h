@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QObject>
+#include <QMutex>
+#include <QTimer>
+#include <deque>
+#include "common.h"
+
+/**
+ * Caps the number of concurrent logins over all accounts.
+ *
+ * A login (version fetch, socket open, TLS handshake, LOGIN parse) holds a
+ * slot from acquire() until release(). Requests beyond the cap wait in FIFO
+ * order. A slot that is not released within LoginSlotTimeout is reclaimed by
+ * a timer, so a stuck login can not block the queue forever.
+ *
+ * This class is thread-safe. Callbacks are called in the thread of their context.
+ * The reclaim timer runs in the thread the admission is created in, which must
+ * have an event loop.
+ */
+class LoginAdmission
+{
+public:
+    struct Stats {
+        int queueDepth{0};
+        int active{0};
+        int64_t admitted{0};
+        milliseconds avgWait{0};
+        milliseconds maxWait{0};
+    };
+
+    explicit LoginAdmission(int maxConcurrent);
+
+    /**
+     * Returns a deterministic offset in [0, window) for key,
+     * which spreads the schedule of accounts evenly over the window.
+     */
+    static milliseconds phaseOf(const QString &key, milliseconds window);
+
+    void setMaxConcurrent(int n);
+    // A context already waiting keeps its place, onAdmitted replaces its callback
+    void acquire(QObject *context, Callback<> onAdmitted);
+    void release(QObject *context);
+
+    // Removes context from the queue and releases its slot.
+    // Must be called before context is deleted.
+    void cancel(QObject *context);
+
+    // Returns the stats since last call
+    Stats takeStats();
+
+private:
+    struct Waiter {
+        QObject *context;
+        Callback<> onAdmitted;
+        SteadyTimepoint enqueueTime;
+    };
+
+    void admitNext();
+    void armReclaimTimer();
+
+    mutable QMutex mutex;
+    int maxConcurrent;
+    std::map<QObject*, SteadyTimepoint> active;
+    std::deque<Waiter> queue;
+    // when the oldest slot times out, empty if the timer is not armed
+    optional<SteadyTimepoint> reclaimAt;
+    QTimer reclaimTimer;
+
+    int64_t admittedCnt{0};
+    milliseconds totalWait{0};
+    milliseconds maxWait{0};
+};
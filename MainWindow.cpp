@@ -3,28 +3,51 @@
 #include "MainWindow.h"
 #include "./ui_mainwindow.h"
 #include "WeixinLoginDialog.h"
+#include "BatchLoginDialog.h"
 #include "GameSessionRqst.h"
 #include "TopwarIds.h"
 #include "Config.h"
+#include "log.h"
+#include "LogSink.h"
+#include "LogModel.h"
+#include "GameCatalog.h"
 
 static MainWindow *mainwindow;
 
+// older lines are removed from the view, they are still in the log files
+constexpr int MaxLogLines = 10000;
+constexpr int LogPageSize = 500;
+
 MainWindow* getMainWindow() {
     return mainwindow;
 }
 
-MainWindow::~MainWindow() {}
+MainWindow::~MainWindow() {
+    // accounts may log while being destroyed
+    accountManager.reset();
+    Config::flush();
+    LogSink::instance().stop();
+}
 
 MainWindow::MainWindow(QWidget *parent)
     : QMainWindow(parent), ui(new Ui::MainWindow)
 {
     mainwindow = this;
+    // before the account threads start
+    bool catalogLoaded = GameCatalog::instance().load(
+        QDir{QCoreApplication::applicationDirPath()}.filePath(u"gamedata.cat"_s));
     ui->setupUi(this);
+    setupLogView();
+    LogSink::instance().setUiCallback(this, [this](const std::vector<EventRecord> &records) { appendToLog(records); });
+    LogSink::instance().start(QDir{QCoreApplication::applicationDirPath()}.filePath(u"logs"_s));
+    if (!catalogLoaded) {
+        logWarn() << u"游戏数据文件 gamedata.cat 缺失或损坏，使用内置数据，可能不是最新的"_s;
+    }
     Config::init();
-    const QJsonObject &currentConfig = Config::get();
+    const auto currentConfig = Config::snapshot();
 
     {
-        int currentVal = currentConfig[Config::KeyRunInterval].toInt();
+        int currentVal = currentConfig->get(Config::RunInterval);
         pair<seconds, QString> runIntervalOptions[] = {
             {60s*30, u"30分钟"_s},
             {60s*60, u"60分钟"_s},
@@ -39,49 +62,49 @@ MainWindow::MainWindow(QWidget *parent)
         connect(ui->runIntervalComboBox, &QComboBox::currentIndexChanged, this, [this](int idx) {
             int val = ui->runIntervalComboBox->currentData().toInt();
             val = std::max(val, 120);
-            Config::set(Config::KeyRunInterval, val);
+            Config::set(Config::RunInterval, val);
         });
     }
 
     {
-        int currentVal = currentConfig[Config::KeyScienceDonatePrefer].toInt();
+        int currentVal = currentConfig->get(Config::ScienceDonatePrefer);
         for (const auto& [scienceId, text] : AllianceScience::getValues()) {
             if (scienceId == AllianceScience::快速作战) {
                 continue;
             }
-            ui->allianceScienceFirstPreferComboBox->addItem(scienceId == 0 ? u"联盟推荐"_s : text, scienceId);
+            ui->allianceScienceFirstPreferComboBox->addItem(scienceId == 0 ? u"联盟推荐"_s : text.toString(), scienceId);
             if (scienceId == currentVal) {
                 ui->allianceScienceFirstPreferComboBox->setCurrentIndex(ui->allianceScienceFirstPreferComboBox->count() - 1);
             }
         }
         connect(ui->allianceScienceFirstPreferComboBox, &QComboBox::currentIndexChanged, this, [this](int idx) {
             int val = ui->allianceScienceFirstPreferComboBox->currentData().toInt();
-            Config::set(Config::KeyScienceDonatePrefer, val);
+            Config::set(Config::ScienceDonatePrefer, val);
         });
     }
 
     {
         ui->donateCoinConsumeComboBox->addItem(u"关闭"_s, false);
         ui->donateCoinConsumeComboBox->addItem(u"开启"_s, true);
-        bool currentVal = currentConfig[Config::KeyDonateCoinConsume].toBool();
+        bool currentVal = currentConfig->get(Config::DonateCoinConsume);
         ui->donateCoinConsumeComboBox->setCurrentIndex(currentVal ? 1 : 0);
         connect(ui->donateCoinConsumeComboBox, &QComboBox::currentIndexChanged, this, [this](int idx) {
             bool val = ui->donateCoinConsumeComboBox->currentData().toBool();
-            Config::set(Config::KeyDonateCoinConsume, val);
+            Config::set(Config::DonateCoinConsume, val);
         });
     }
 
     {
-        int currentVal = currentConfig[Config::KeyWorldSiteDonatePrefer].toInt();
+        int currentVal = currentConfig->get(Config::WorldSiteDonatePrefer);
         for (const auto& [val, text] : WorldSite::getKinds()) {
-            ui->worldSitePreferComboBox->addItem(val == 0 ? u"自动选择"_s : text, val);
+            ui->worldSitePreferComboBox->addItem(val == 0 ? u"自动选择"_s : text.toString(), val);
             if (val == currentVal) {
                 ui->worldSitePreferComboBox->setCurrentIndex(ui->worldSitePreferComboBox->count() - 1);
             }
         }
         connect(ui->worldSitePreferComboBox, &QComboBox::currentIndexChanged, this, [this](int idx) {
             int val = ui->worldSitePreferComboBox->currentData().toInt();
-            Config::set(Config::KeyWorldSiteDonatePrefer, val);
+            Config::set(Config::WorldSiteDonatePrefer, val);
         });
     }
 
@@ -90,35 +113,164 @@ MainWindow::MainWindow(QWidget *parent)
     connect(ui->consumeCoinButton, &QPushButton::clicked, this, &MainWindow::openConsumeCoinDialog);
     ui->consumeCoinButton->hide();
 
-    topwarHelper = make_unique<TopwarHelper>();
-    unique_ptr<GameSessionInfo> session = topwarHelper->readSavedSession();
+    auto addAccountButton = new QPushButton{u"添加账号"_s};
+    ui->userInfoLayout->insertWidget(ui->userInfoLayout->indexOf(ui->changeServerButton) + 1, addAccountButton);
+    connect(addAccountButton, &QPushButton::clicked, this, [this] {
+        openWeixinLoginDialog([this](const QString &code) {
+            TopwarHelper *account = accountManager->addAccount();
+            QMetaObject::invokeMethod(account, [account, code] { account->loginByToken(code); });
+        });
+    });
 
-    if (session != nullptr) {
-        topwarHelper->loginBySession(std::move(session));
-    } else {
-        auto dlg = new WeixinLoginDialog{
-            u"wxa3a080af3ee8278d"_s,
-            u"https://warh5.rivergame.net/webgame/platform/wxlogin_redirect.html"_s,
-            generateTempId(),
-            this
-        };
-        dlg->setAppName(u"口袋奇兵H5"_s);
-        connect(dlg, &QDialog::finished, this, [this, dlg](int result) {
-            dlg->deleteLater();
-            if (result != QDialog::Accepted) {
+    auto batchAddAccountButton = new QPushButton{u"批量添加"_s};
+    ui->userInfoLayout->insertWidget(ui->userInfoLayout->indexOf(addAccountButton) + 1, batchAddAccountButton);
+    connect(batchAddAccountButton, &QPushButton::clicked, this, &MainWindow::openBatchLoginDialog);
+
+    startAccounts();
+}
+
+void MainWindow::startAccounts() {
+    accountManager = make_unique<AccountManager>();
+    accountManager->load();
+
+    QString primaryId = accountManager->primary()->getAccountId();
+    connect(accountManager->primary(), &TopwarHelper::userInfoChanged, this, &MainWindow::showUserInfo);
+    connect(accountManager.get(), &AccountManager::accountMoved, this, [this, primaryId](const QString &id, TopwarHelper *helper) {
+        if (id == primaryId) {
+            connect(helper, &TopwarHelper::userInfoChanged, this, &MainWindow::showUserInfo);
+        }
+    });
+
+    accountManager->startAll([this, primaryId](TopwarHelper *account) {
+        if (account->getAccountId() != primaryId) {
+            log() << u"账号 "_s << account->getAccountId() << u" 无登录信息"_s;
+            return;
+        }
+        openWeixinLoginDialog(
+            [this](const QString &code) {
+                TopwarHelper *primary = accountManager->primary();
+                QMetaObject::invokeMethod(primary, [primary, code] { primary->loginByToken(code); });
+            },
+            [this] {
                 isForcedClose = true;
                 QTimer::singleShot(0, this, &QMainWindow::close);
-                return;
             }
-            qDebug() << "wx login success." << dlg->getCode();
-            topwarHelper->loginByToken(dlg->getCode());
-        });
-        dlg->open();
+        );
+    });
+}
+
+void MainWindow::openWeixinLoginDialog(Callback<const QString&> onAccepted, Callback<> onRejected) {
+    auto dlg = new WeixinLoginDialog{
+        u"wxa3a080af3ee8278d"_s,
+        u"https://warh5.rivergame.net/webgame/platform/wxlogin_redirect.html"_s,
+        generateTempId(),
+        this
+    };
+    dlg->setAppName(u"口袋奇兵H5"_s);
+    connect(dlg, &QDialog::finished, this, [dlg, onAccepted, onRejected](int result) {
+        dlg->deleteLater();
+        if (result != QDialog::Accepted) {
+            if (onRejected) {
+                onRejected();
+            }
+            return;
+        }
+        qDebug() << "wx login success." << dlg->getCode();
+        onAccepted(dlg->getCode());
+    });
+    dlg->open();
+}
+
+void MainWindow::openBatchLoginDialog() {
+    bool ok = false;
+    int count = QInputDialog::getInt(this, u"批量添加账号"_s, u"账号数量："_s, 10, 1, 200, 1, &ok);
+    if (!ok) {
+        return;
+    }
+    auto dlg = new BatchLoginDialog{
+        u"wxa3a080af3ee8278d"_s,
+        u"https://warh5.rivergame.net/webgame/platform/wxlogin_redirect.html"_s,
+        accountManager->getRqstExecutor(),
+        count,
+        this
+    };
+    dlg->setAttribute(Qt::WA_DeleteOnClose);
+    // each account exchanges its code in its own shard, in parallel with the others
+    connect(dlg, &BatchLoginDialog::codeReceived, this, [this](const QString &code) {
+        TopwarHelper *account = accountManager->addAccount();
+        QMetaObject::invokeMethod(account, [account, code] { account->loginByToken(code); });
+    });
+    dlg->open();
+}
+
+void MainWindow::setupLogView() {
+    logModel = new LogModel{MaxLogLines, this};
+    logModel->setHistoryDir(QDir{QCoreApplication::applicationDirPath()}.filePath(u"logs"_s));
+    logFilter = new LogFilterModel{this};
+    logFilter->setSourceModel(logModel);
+    ui->logListView->setModel(logFilter);
+
+    QComboBox *accountBox = ui->logAccountComboBox;
+    accountBox->addItem(u"全部"_s, QVariant::fromValue<qint64>(0));
+    connect(logModel, &LogModel::accountSeen, this, [accountBox](int64_t uid, const QString &name) {
+        int idx = accountBox->findData(QVariant::fromValue<qint64>(uid));
+        if (idx >= 0) {
+            accountBox->setItemText(idx, name);
+        } else {
+            accountBox->addItem(name, QVariant::fromValue<qint64>(uid));
+        }
+    });
+    connect(accountBox, &QComboBox::currentIndexChanged, this, [this, accountBox] {
+        logFilter->setUid(accountBox->currentData().toLongLong());
+        ui->logListView->scrollToBottom();
+    });
+
+    connect(ui->logWarzoneSpinBox, &QSpinBox::valueChanged, this, [this](int warzone) {
+        logFilter->setWarzone(warzone);
+        ui->logListView->scrollToBottom();
+    });
+
+    QComboBox *severityBox = ui->logSeverityComboBox;
+    severityBox->addItem(u"全部"_s, static_cast<int>(LogSeverity::Info));
+    severityBox->addItem(u"仅警告"_s, static_cast<int>(LogSeverity::Warning));
+    connect(severityBox, &QComboBox::currentIndexChanged, this, [this, severityBox] {
+        logFilter->setMinSeverity(static_cast<LogSeverity>(severityBox->currentData().toInt()));
+        ui->logListView->scrollToBottom();
+    });
+
+    connect(ui->logLoadOlderButton, &QPushButton::clicked, this, &MainWindow::loadOlderLogs);
+    // scrolling to the top pages in the older lines
+    QScrollBar *scrollBar = ui->logListView->verticalScrollBar();
+    connect(scrollBar, &QScrollBar::actionTriggered, this, [this, scrollBar] {
+        if (scrollBar->maximum() > 0 && scrollBar->sliderPosition() == scrollBar->minimum()) {
+            // after the action is applied
+            QMetaObject::invokeMethod(this, &MainWindow::loadOlderLogs, Qt::QueuedConnection);
+        }
+    });
+}
+
+void MainWindow::loadOlderLogs() {
+    QListView *view = ui->logListView;
+    // keeps the lines on screen in place
+    QModelIndex top = logFilter->mapToSource(view->indexAt(QPoint{0, 0}));
+    int added = logModel->loadOlder(LogPageSize);
+    if (added == 0) {
+        statusBar()->showMessage(u"没有更早的日志了"_s, 3000);
+        return;
+    }
+    if (top.isValid()) {
+        QModelIndex index = logFilter->mapFromSource(logModel->index(top.row() + added));
+        view->scrollTo(index, QAbstractItemView::PositionAtTop);
     }
 }
 
-void MainWindow::appendToLog(const QString &s) {
-    ui->logTextBrowser->append(s);
+void MainWindow::appendToLog(const std::vector<EventRecord> &records) {
+    QScrollBar *scrollBar = ui->logListView->verticalScrollBar();
+    bool atBottom = scrollBar->value() == scrollBar->maximum();
+    logModel->append(records);
+    if (atBottom) {
+        ui->logListView->scrollToBottom();
+    }
 }
 
 void MainWindow::openChangeServerDialog() {
@@ -150,8 +302,9 @@ void MainWindow::openChangeServerDialog() {
             return;
         }
         int warzone = inputLineEdit->text().toInt();
-        Config::set(Config::KeyWarzone, warzone);
-        topwarHelper->onWantedWarzoneChanged(warzone);
+        TopwarHelper *primary = accountManager->primary();
+        // the account changes its server when it gets the new config
+        accountManager->setAccountConfig(primary->getAccountId(), Config::Warzone, warzone);
     });
     dlg->open();
 }
@@ -191,7 +344,10 @@ void MainWindow::openConsumeCoinDialog() {
         }
         QByteArray batchBuildData = batchBuildDataTextEdit->toPlainText().toUtf8();
         double coin = coinLineEdit->text().toDouble() * 1.0_hh;
-        topwarHelper->consumeCoin(batchBuildData, coin);
+        TopwarHelper *primary = accountManager->primary();
+        QMetaObject::invokeMethod(primary, [primary, batchBuildData, coin] {
+            primary->consumeCoin(batchBuildData, coin);
+        });
     });
     dlg->open();
 }
@@ -1,7 +1,11 @@
 #pragma once
 
 #include <QMainWindow>
-#include "TopwarHelper.h"
+#include "AccountManager.h"
+
+struct EventRecord;
+class LogModel;
+class LogFilterModel;
 
 QT_BEGIN_NAMESPACE
 namespace Ui {
@@ -17,7 +21,7 @@ public:
     MainWindow(QWidget *parent = nullptr);
     ~MainWindow();
 
-    void appendToLog(const QString &s);
+    void appendToLog(const std::vector<EventRecord> &records);
     void showUserInfo(int warzone, const QString &username);
 
 protected:
@@ -26,10 +30,17 @@ protected:
 private:
     void openChangeServerDialog();
     void openConsumeCoinDialog();
+    void openWeixinLoginDialog(Callback<const QString&> onAccepted, Callback<> onRejected = {});
+    void openBatchLoginDialog();
+    void startAccounts();
+    void setupLogView();
+    void loadOlderLogs();
 
     Ui::MainWindow *ui;
     bool isForcedClose{false};
-    unique_ptr<TopwarHelper> topwarHelper;
+    unique_ptr<AccountManager> accountManager;
+    LogModel *logModel{nullptr};
+    LogFilterModel *logFilter{nullptr};
 };
 
 extern MainWindow* getMainWindow();
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <atomic>
+#include "common.h"
+
+/**
+ * Unbounded lock-free multi-producer, single-consumer queue of nodes owned by
+ * the caller (the intrusive MPSC queue of Dmitry Vyukov).
+ *
+ * Node must be default constructible and have a member std::atomic<Node*> next.
+ * The queue allocates nothing: push() links a node of the caller, and tryPop()
+ * hands it back, to be reused or freed by the caller. Nodes still queued when
+ * the queue is destroyed stay with the caller.
+ *
+ * push() may be called from any thread and is wait-free: one atomic exchange.
+ * tryPop() must only be called from one consumer thread at a time. A push that
+ * is in progress (exchanged but not yet linked) is not visible to tryPop() yet,
+ * so tryPop() may return nothing while a later push is already linked; nodes of
+ * one producer always come out in its order.
+ */
+template <class Node>
+class MpscQueue
+{
+public:
+    MpscQueue()
+        : head{&stub}, tail{&stub} {}
+
+    MpscQueue(const MpscQueue &) = delete;
+    MpscQueue& operator= (const MpscQueue &) = delete;
+
+    void push(Node *node) {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        Node *prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    // Returns nullptr if no node is linked
+    Node* tryPop() {
+        Node *t = tail;
+        Node *next = t->next.load(std::memory_order_acquire);
+        if (t == &stub) {
+            if (next == nullptr) {
+                return nullptr;
+            }
+            tail = next;
+            t = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if (next == nullptr) {
+            if (t != head.load(std::memory_order_acquire)) {
+                // a producer is between its exchange and its link
+                return nullptr;
+            }
+            // t is the last node. Put the stub behind it, so that t can be taken
+            push(&stub);
+            next = t->next.load(std::memory_order_acquire);
+            if (next == nullptr) {
+                return nullptr;
+            }
+        }
+        tail = next;
+        return t;
+    }
+
+private:
+    Node stub;
+    std::atomic<Node*> head;
+    Node *tail; // used by the consumer only
+};
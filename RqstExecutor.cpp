@@ -0,0 +1,64 @@
+#include <QtCore>
+#include "RqstExecutor.h"
+
+// well within the time the NAM keeps an idle connection (2 minutes)
+constexpr auto PrewarmInterval = 60s;
+
+void AsyncAbortHandler::abort() {
+    if (state == nullptr) {
+        return;
+    }
+    {
+        QMutexLocker locker{&state->mutex};
+        if (state->canceled) {
+            return;
+        }
+        state->canceled = true;
+    }
+    QMetaObject::invokeMethod(state->worker, [state=state] {
+        state->aborter.abort();
+    });
+}
+
+
+RqstExecutor::RqstExecutor(int threadCount) {
+    threadCount = max(threadCount, 1);
+    for (int i = 0; i < threadCount; i++) {
+        auto thread = new QThread;
+        thread->setObjectName(u"http-%1"_s.arg(i));
+        auto context = new QObject;
+        context->moveToThread(thread);
+        thread->start();
+        threads.push_back(thread);
+        contexts.push_back(context);
+    }
+}
+
+RqstExecutor::~RqstExecutor() {
+    for (size_t i = 0; i < threads.size(); i++) {
+        // runs the aborts queued before, while the replies still exist
+        QMetaObject::invokeMethod(contexts[i], [] {}, Qt::BlockingQueuedConnection);
+        threads[i]->quit();
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i]->wait();
+        delete contexts[i];
+        delete threads[i];
+    }
+}
+
+void RqstExecutor::prewarm(const QStringList &hosts) {
+    auto now = SteadyClockNow();
+    auto last = lastPrewarm.load();
+    if (now < last + PrewarmInterval || !lastPrewarm.compare_exchange_strong(last, now)) {
+        // recently done, or being done by another caller
+        return;
+    }
+    for (QObject *context : contexts) {
+        QMetaObject::invokeMethod(context, [hosts] { HttpRqst::prewarm(hosts); });
+    }
+}
+
+QObject* RqstExecutor::nextWorker() {
+    return contexts[nextIdx++ % contexts.size()];
+}
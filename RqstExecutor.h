@@ -0,0 +1,115 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+#include <QMutex>
+#include "HttpRqst.h"
+
+/**
+ * Aborts a request running in a RqstExecutor, from the thread that started it.
+ * Once abort() returns, no callback of the request is posted any more.
+ * This class is move only. The request is aborted on destruction and on
+ * being assigned another request.
+ */
+class AsyncAbortHandler {
+public:
+    struct State {
+        QMutex mutex;
+        bool canceled{false};
+        QObject *worker{nullptr};
+        HttpRqst::AbortHandler aborter; // used in the worker thread only
+
+        bool isCanceled() {
+            QMutexLocker locker{&mutex};
+            return canceled;
+        }
+
+        template <class Function>
+        void post(QObject *context, Function &&func) {
+            QMutexLocker locker{&mutex};
+            if (!canceled) {
+                QMetaObject::invokeMethod(context, std::forward<Function>(func), Qt::QueuedConnection);
+            }
+        }
+    };
+
+    AsyncAbortHandler() = default;
+    explicit AsyncAbortHandler(shared_ptr<State> state)
+        : state{std::move(state)} {}
+    ~AsyncAbortHandler() { abort(); }
+
+    AsyncAbortHandler(const AsyncAbortHandler &) = delete;
+    AsyncAbortHandler(AsyncAbortHandler &&) = default;
+
+    AsyncAbortHandler& operator= (AsyncAbortHandler &&other) {
+        if (this != &other) {
+            abort();
+            state = std::move(other.state);
+        }
+        return *this;
+    }
+
+    void abort();
+
+private:
+    shared_ptr<State> state;
+};
+
+/**
+ * A small pool of threads running HTTP requests (RqstHandler chains),
+ * so that transfers and the parsing in processFuncs never block the thread
+ * of the caller. Each thread uses its own HttpRqst::getNamInst().
+ *
+ * Handlers returned by run() must be destroyed before the executor.
+ */
+class RqstExecutor
+{
+public:
+    explicit RqstExecutor(int threadCount);
+    ~RqstExecutor();
+
+    /**
+     * Calls factory (() -> RqstHandler<T>) in a worker thread, and then
+     * succCb (T) or failCb (const RqstError&) in the thread of context.
+     * context must not be deleted before the returned handler is aborted.
+     */
+    template <class Factory, class SuccCb, class FailCb>
+    [[nodiscard]] AsyncAbortHandler run(QObject *context, Factory factory, SuccCb succCb, FailCb failCb) {
+        using T = typename HttpRqst::detail::RqstResult<std::invoke_result_t<Factory>>::type;
+        auto state = make_shared<AsyncAbortHandler::State>();
+        state->worker = nextWorker();
+        QMetaObject::invokeMethod(state->worker, [=] {
+            if (state->isCanceled()) {
+                return;
+            }
+            auto handler = factory();
+            state->aborter = HttpRqst::AbortHandler{handler};
+            handler.whenFinished(
+                [state, context, succCb](T result) {
+                    // shared, so that the posted functor is copyable even if T is not
+                    auto pResult = make_shared<T>(std::move(result));
+                    state->post(context, [succCb, pResult] { succCb(std::move(*pResult)); });
+                },
+                [state, context, failCb](const HttpRqst::RqstError &err) {
+                    HttpRqst::RqstError errCopy{err.reason, err.detail};
+                    state->post(context, [failCb, errCopy] { failCb(errCopy); });
+                }
+            );
+        });
+        return AsyncAbortHandler{std::move(state)};
+    }
+
+    /**
+     * Opens connections to hosts in every worker thread (see HttpRqst::prewarm()),
+     * at most once per PrewarmInterval however many callers ask. Thread-safe.
+     */
+    void prewarm(const QStringList &hosts);
+
+private:
+    QObject* nextWorker();
+
+    std::vector<QThread*> threads;
+    std::vector<QObject*> contexts;
+    std::atomic<size_t> nextIdx{0};
+    std::atomic<SteadyTimepoint> lastPrewarm{SteadyClockMin};
+};
@@ -0,0 +1,117 @@
+#include <QtCore>
+#include "Scheduler.h"
+
+static QThreadStorage<Scheduler*> perThreadScheduler;
+
+Scheduler::Scheduler() {
+    timer.setSingleShot(true);
+    timer.setTimerType(Qt::PreciseTimer);
+    timer.callOnTimeout(this, &Scheduler::fire);
+}
+
+Scheduler::~Scheduler() {
+    for (auto& [t, scheduledTimer] : queue) {
+        scheduledTimer->pos.reset();
+    }
+}
+
+Scheduler* Scheduler::instance() {
+    if (!perThreadScheduler.hasLocalData()) {
+        // deleted by QThreadStorage when the thread exits
+        perThreadScheduler.setLocalData(new Scheduler);
+    }
+    return perThreadScheduler.localData();
+}
+
+size_t Scheduler::pendingCount() const {
+    return queue.size();
+}
+
+Scheduler::Queue::iterator Scheduler::add(SteadyTimepoint t, ScheduledTimer *scheduledTimer) {
+    auto it = queue.emplace(t, scheduledTimer);
+    if (it == queue.begin()) {
+        rearm();
+    }
+    return it;
+}
+
+void Scheduler::remove(Queue::iterator it) {
+    bool isFirst = (it == queue.begin());
+    queue.erase(it);
+    if (isFirst) {
+        rearm();
+    }
+}
+
+void Scheduler::rearm() {
+    if (queue.empty()) {
+        timer.stop();
+        return;
+    }
+    auto t = queue.begin()->first - SteadyClockNow();
+    timer.start(std::max(DurationCast::ceil<milliseconds>(t), 0ms));
+}
+
+void Scheduler::fire() {
+    auto now = SteadyClockNow();
+    while (!queue.empty() && queue.begin()->first <= now) {
+        ScheduledTimer *scheduledTimer = queue.begin()->second;
+        queue.erase(queue.begin());
+        scheduledTimer->pos.reset();
+
+        // the callback may restart, stop or even delete the timer.
+        // see ScheduledTimer::~ScheduledTimer()
+        firing = scheduledTimer;
+        auto callback = scheduledTimer->callback;
+        QElapsedTimer elapsed;
+        elapsed.start();
+        if (callback) {
+            callback();
+        }
+        if (firing != nullptr) {
+            firing->busyTime += nanoseconds{elapsed.nsecsElapsed()};
+        }
+        firing = nullptr;
+    }
+    rearm();
+}
+
+
+
+ScheduledTimer::ScheduledTimer(Scheduler *scheduler)
+    : scheduler{scheduler} {}
+
+ScheduledTimer::~ScheduledTimer() {
+    stop();
+    if (scheduler->firing == this) {
+        scheduler->firing = nullptr;
+    }
+}
+
+void ScheduledTimer::start(milliseconds t) {
+    stop();
+    pos = scheduler->add(SteadyClockNow() + t, this);
+}
+
+void ScheduledTimer::stop() {
+    if (pos.has_value()) {
+        scheduler->remove(*pos);
+        pos.reset();
+    }
+}
+
+bool ScheduledTimer::isActive() const {
+    return pos.has_value();
+}
+
+milliseconds ScheduledTimer::remainingTimeAsDuration() const {
+    if (!pos.has_value()) {
+        return -1ms;
+    }
+    auto t = (*pos)->first - SteadyClockNow();
+    return std::max(DurationCast::round<milliseconds>(t), 0ms);
+}
+
+nanoseconds ScheduledTimer::getBusyTime() const {
+    return busyTime;
+}
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QPointer>
+#include <map>
+#include "common.h"
+
+class ScheduledTimer;
+
+/**
+ * A single QTimer driving every ScheduledTimer of the thread.
+ *
+ * With hundreds of accounts in one process, each account's login, run-task
+ * and logout timers are entries of one ordered queue instead of separate
+ * QTimers. Time spent in timer callbacks is accounted per timer, so the
+ * owner can report its CPU overhead.
+ */
+class Scheduler: public QObject
+{
+    Q_OBJECT
+
+public:
+    Scheduler();
+    ~Scheduler() override;
+
+    /**
+     * Returns the scheduler instance of current thread.
+     */
+    static Scheduler* instance();
+
+    size_t pendingCount() const;
+
+private:
+    friend class ScheduledTimer;
+    using Queue = std::multimap<SteadyTimepoint, ScheduledTimer*>;
+
+    Queue::iterator add(SteadyTimepoint t, ScheduledTimer *timer);
+    void remove(Queue::iterator it);
+    void rearm();
+    void fire();
+
+    Queue queue;
+    QTimer timer;
+    ScheduledTimer *firing{nullptr};
+};
+
+
+// Single shot timer with the subset of QTimer interfaces used by TopwarHelper.
+// This class is neither copyable nor movable, as the scheduler refers to it.
+class ScheduledTimer {
+public:
+    explicit ScheduledTimer(Scheduler *scheduler = Scheduler::instance());
+    ~ScheduledTimer();
+
+    ScheduledTimer(const ScheduledTimer &) = delete;
+    ScheduledTimer& operator= (const ScheduledTimer &) = delete;
+
+    // The callback is not invoked if context is destroyed
+    template <class Function>
+    void callOnTimeout(const QObject *context, Function &&func) {
+        callback = [context=QPointer<const QObject>{context}, func=std::forward<Function>(func)] {
+            if (context != nullptr) {
+                std::invoke(func);
+            }
+        };
+    }
+
+    template <class Obj, class Ret>
+    void callOnTimeout(Obj *context, Ret (Obj::*memberFunc)()) {
+        callOnTimeout(context, [context, memberFunc]{ (context->*memberFunc)(); });
+    }
+
+    void start(milliseconds t);
+    void stop();
+    bool isActive() const;
+    milliseconds remainingTimeAsDuration() const;
+
+    // Total time spent in the callback of this timer
+    nanoseconds getBusyTime() const;
+
+private:
+    friend class Scheduler;
+
+    Scheduler *scheduler;
+    std::function<void()> callback;
+    optional<Scheduler::Queue::iterator> pos;
+    nanoseconds busyTime{0};
+};
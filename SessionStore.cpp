@@ -0,0 +1,333 @@
+#include <QtCore>
+#include <QSaveFile>
+#include "SessionStore.h"
+
+constexpr QByteArrayView SessionStoreMagic{"TWSESS01"};
+constexpr uint32_t SessionStoreVersion = 1;
+constexpr qint64 HeaderSize = 12;
+constexpr qint64 RecordHeaderSize = 8;
+// compacted when superseded records take more than half of a file over this size
+constexpr qint64 MinCompactSize = 64_KiB;
+
+namespace {
+
+constexpr std::array<uint32_t, 256> makeCrcTable() {
+    std::array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < 256; i++) {
+        uint32_t c = i;
+        for (int k = 0; k < 8; k++) {
+            c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        }
+        table[i] = c;
+    }
+    return table;
+}
+
+constexpr auto CrcTable = makeCrcTable();
+
+uint32_t crc32(QByteArrayView data) {
+    uint32_t c = 0xFFFFFFFFu;
+    for (char ch : data) {
+        c = CrcTable[(c ^ static_cast<uint8_t>(ch)) & 0xFF] ^ (c >> 8);
+    }
+    return c ^ 0xFFFFFFFFu;
+}
+
+template <class T>
+void putRaw(QByteArray &buf, T val) {
+    val = qToLittleEndian(val);
+    buf.append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+void putString(QByteArray &buf, const QString &s) {
+    QByteArray utf8 = s.toUtf8();
+    putRaw<uint32_t>(buf, utf8.size());
+    buf.append(utf8);
+}
+
+class Reader {
+public:
+    explicit Reader(QByteArrayView data)
+        : data{data} {}
+
+    template <class T>
+    bool read(T &out) {
+        if (pos + qsizetype(sizeof(T)) > data.size()) {
+            return false;
+        }
+        out = qFromLittleEndian<T>(data.data() + pos);
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool readString(QString &out) {
+        uint32_t len;
+        if (!read(len) || qsizetype(len) > data.size() - pos) {
+            return false;
+        }
+        out = QString::fromUtf8(data.sliced(pos, len));
+        pos += len;
+        return true;
+    }
+
+private:
+    QByteArrayView data;
+    qsizetype pos{0};
+};
+
+} // END anonymous namespace
+
+SessionStore::SessionStore(const QString &filePath)
+    : filePath{filePath}
+{
+}
+
+SessionStore::~SessionStore() {
+    unmapLocked();
+}
+
+QByteArray SessionStore::encodeRecord(RecordKind kind, const QString &key, const GameSessionInfo *session) {
+    QByteArray payload;
+    putRaw<uint8_t>(payload, kind);
+    putString(payload, key);
+    if (session != nullptr) {
+        putRaw<int32_t>(payload, session->serverId);
+        putString(payload, session->serverUrl);
+        putString(payload, session->serverInfoToken);
+        putString(payload, session->tempId);
+        putRaw<int64_t>(payload, session->tokenTime);
+    }
+    QByteArray record;
+    record.reserve(RecordHeaderSize + payload.size());
+    putRaw<uint32_t>(record, payload.size());
+    putRaw<uint32_t>(record, crc32(payload));
+    record.append(payload);
+    return record;
+}
+
+bool SessionStore::openLocked() {
+    file.setFileName(filePath);
+    if (!file.open(QIODevice::ReadWrite)) {
+        qDebug() << "failed to open session store" << filePath << file.errorString();
+        return false;
+    }
+    fileSize = file.size();
+    if (fileSize >= HeaderSize) {
+        QByteArray header = file.read(HeaderSize);
+        if (header.startsWith(SessionStoreMagic)
+            && qFromLittleEndian<uint32_t>(header.constData() + SessionStoreMagic.size()) == SessionStoreVersion) {
+            return true;
+        }
+        // kept for inspection, never overwritten
+        qDebug() << "unknown session store format, starting a new one";
+        file.close();
+        QFile::remove(filePath + u".bad"_s);
+        QFile::rename(filePath, filePath + u".bad"_s);
+        if (!file.open(QIODevice::ReadWrite)) {
+            return false;
+        }
+    }
+    // new, or cut short while writing the header
+    QByteArray header{SessionStoreMagic.toByteArray()};
+    putRaw<uint32_t>(header, SessionStoreVersion);
+    file.resize(0);
+    file.seek(0);
+    if (file.write(header) != HeaderSize || !file.flush()) {
+        file.close();
+        return false;
+    }
+    fileSize = HeaderSize;
+    return true;
+}
+
+bool SessionStore::mapLocked() {
+    unmapLocked();
+    mapped = file.map(0, fileSize);
+    if (mapped == nullptr) {
+        qDebug() << "failed to map session store" << file.errorString();
+        return false;
+    }
+    mappedSize = fileSize;
+    return true;
+}
+
+void SessionStore::unmapLocked() {
+    if (mapped != nullptr) {
+        file.unmap(mapped);
+        mapped = nullptr;
+        mappedSize = 0;
+    }
+}
+
+void SessionStore::load() {
+    QMutexLocker locker{&mutex};
+    index.clear();
+    liveSize = 0;
+    if (!openLocked() || !mapLocked()) {
+        return;
+    }
+
+    QByteArrayView data{reinterpret_cast<const char*>(mapped), mappedSize};
+    qint64 pos = HeaderSize;
+    while (pos + RecordHeaderSize <= mappedSize) {
+        uint32_t payloadSize = qFromLittleEndian<uint32_t>(data.data() + pos);
+        uint32_t crc = qFromLittleEndian<uint32_t>(data.data() + pos + 4);
+        if (payloadSize > mappedSize - pos - RecordHeaderSize) {
+            break;
+        }
+        QByteArrayView payload = data.sliced(pos + RecordHeaderSize, payloadSize);
+        if (crc32(payload) != crc) {
+            break;
+        }
+        Reader r{payload};
+        uint8_t kind;
+        QString key;
+        if (!r.read(kind) || !r.readString(key)) {
+            break;
+        }
+        qint64 size = RecordHeaderSize + payloadSize;
+        if (auto it = index.constFind(key); it != index.cend()) {
+            liveSize -= it->size;
+        }
+        if (kind == PutRecord) {
+            index.insert(key, {pos, size});
+            liveSize += size;
+        } else {
+            index.remove(key);
+        }
+        pos += size;
+    }
+
+    if (pos < fileSize) {
+        // the record being written when the last run stopped
+        qDebug() << "session store: dropped" << (fileSize - pos) << "bytes of incomplete record";
+        unmapLocked();
+        file.resize(pos);
+        fileSize = pos;
+        mapLocked();
+    }
+    compactIfNeededLocked();
+}
+
+QByteArrayView SessionStore::recordAt(const IndexEntry &entry) {
+    // records appended after the mapping was made
+    if (entry.offset + entry.size > mappedSize && !mapLocked()) {
+        return {};
+    }
+    return QByteArrayView{reinterpret_cast<const char*>(mapped) + entry.offset, entry.size};
+}
+
+unique_ptr<GameSessionInfo> SessionStore::get(const QString &key) {
+    QMutexLocker locker{&mutex};
+    auto it = index.constFind(key);
+    if (it == index.cend()) {
+        return {};
+    }
+    QByteArrayView record = recordAt(*it);
+    if (record.isEmpty()) {
+        return {};
+    }
+    Reader r{record.sliced(RecordHeaderSize)};
+    uint8_t kind;
+    QString storedKey;
+    int32_t serverId;
+    auto session = make_unique<GameSessionInfo>();
+    if (!r.read(kind) || !r.readString(storedKey) || !r.read(serverId)
+        || !r.readString(session->serverUrl) || !r.readString(session->serverInfoToken)
+        || !r.readString(session->tempId) || !r.read(session->tokenTime)) {
+        return {};
+    }
+    session->serverId = serverId;
+    return session;
+}
+
+bool SessionStore::put(const QString &key, const GameSessionInfo &session) {
+    QByteArray record = encodeRecord(PutRecord, key, &session);
+    QMutexLocker locker{&mutex};
+    if (auto it = index.constFind(key); it != index.cend() && recordAt(*it) == record) {
+        return true;
+    }
+    return appendLocked(key, record);
+}
+
+void SessionStore::remove(const QString &key) {
+    QMutexLocker locker{&mutex};
+    if (index.contains(key)) {
+        appendLocked(key, encodeRecord(RemoveRecord, key, nullptr));
+    }
+}
+
+bool SessionStore::appendLocked(const QString &key, const QByteArray &record) {
+    if (!file.isOpen()) {
+        return false;
+    }
+    file.seek(fileSize);
+    if (file.write(record) != record.size() || !file.flush()) {
+        qDebug() << "failed to write session store" << file.errorString();
+        // nothing after the last complete record
+        file.resize(fileSize);
+        return false;
+    }
+    if (auto it = index.constFind(key); it != index.cend()) {
+        liveSize -= it->size;
+    }
+    auto kind = static_cast<uint8_t>(record.at(RecordHeaderSize));
+    if (kind == PutRecord) {
+        index.insert(key, {fileSize, record.size()});
+        liveSize += record.size();
+    } else {
+        index.remove(key);
+    }
+    fileSize += record.size();
+    compactIfNeededLocked();
+    return true;
+}
+
+void SessionStore::compactIfNeededLocked() {
+    if (fileSize >= MinCompactSize && liveSize * 2 < fileSize - HeaderSize) {
+        compactLocked();
+    }
+}
+
+void SessionStore::compact() {
+    QMutexLocker locker{&mutex};
+    compactLocked();
+}
+
+void SessionStore::compactLocked() {
+    if (!file.isOpen() || (fileSize > mappedSize && !mapLocked())) {
+        return;
+    }
+    QByteArray content;
+    content.reserve(HeaderSize + liveSize);
+    content.append(reinterpret_cast<const char*>(mapped), HeaderSize);
+    QHash<QString, IndexEntry> newIndex;
+    newIndex.reserve(index.size());
+    for (auto it = index.cbegin(); it != index.cend(); it++) {
+        newIndex.insert(it.key(), {content.size(), it->size});
+        content.append(reinterpret_cast<const char*>(mapped) + it->offset, it->size);
+    }
+
+    QSaveFile saveFile{filePath};
+    if (!saveFile.open(QIODevice::WriteOnly) || saveFile.write(content) != content.size()) {
+        qDebug() << "failed to compact session store" << saveFile.errorString();
+        return;
+    }
+    // the file can not be replaced while it is open on some systems
+    unmapLocked();
+    file.close();
+    bool committed = saveFile.commit();
+    if (!committed) {
+        qDebug() << "failed to compact session store" << saveFile.errorString();
+    }
+    if (!file.open(QIODevice::ReadWrite)) {
+        qDebug() << "failed to open session store" << filePath << file.errorString();
+        return;
+    }
+    if (committed) {
+        index = std::move(newIndex);
+        fileSize = content.size();
+        liveSize = fileSize - HeaderSize;
+    }
+    mapLocked();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QFile>
+#include <QHash>
+#include <QMutex>
+#include "GameSessionRqst.h"
+
+/**
+ * The saved game sessions of all accounts, in one append-only file.
+ * Keyed by account id: an account logs in to one server at a time, and
+ * changing the server replaces its session, so there is one session to keep.
+ *
+ * File layout, little endian: SessionStoreMagic, u32 format version, then
+ * records of
+ *   u32 payload size, u32 CRC-32 of the payload,
+ *   payload: u8 kind (put / remove), string key, and for put: i32 serverId,
+ *            string serverUrl, serverInfoToken, tempId, i64 tokenTime
+ * where a string is u32 length + UTF-8 bytes.
+ *
+ * A write appends one record, and only when the session differs from the
+ * stored one. On load the file is mapped into memory and scanned once to
+ * build the index (key -> offset of the latest record); get() decodes from
+ * the mapping. A record with a bad checksum or cut short by a crash ends the
+ * scan and the file is truncated there, so a torn write loses at most that
+ * record, never the ones before it. The file is compacted (rewritten through
+ * QSaveFile with only the latest records) when mostly superseded records.
+ *
+ * This class is thread-safe.
+ */
+class SessionStore
+{
+public:
+    explicit SessionStore(const QString &filePath);
+    ~SessionStore();
+
+    void load();
+
+    unique_ptr<GameSessionInfo> get(const QString &key);
+
+    // Returns false if it fails to write. Nothing is written if the session is unchanged
+    bool put(const QString &key, const GameSessionInfo &session);
+    void remove(const QString &key);
+
+    // Rewrites the file with only the latest record of each key
+    void compact();
+
+private:
+    enum RecordKind: uint8_t {
+        PutRecord = 1,
+        RemoveRecord = 2
+    };
+
+    struct IndexEntry {
+        qint64 offset;  // of the record header
+        qint64 size;    // of the whole record
+    };
+
+    bool openLocked();
+    bool mapLocked();
+    void unmapLocked();
+    bool appendLocked(const QString &key, const QByteArray &record);
+    void compactIfNeededLocked();
+    void compactLocked();
+    QByteArrayView recordAt(const IndexEntry &entry);
+
+    static QByteArray encodeRecord(RecordKind kind, const QString &key, const GameSessionInfo *session);
+
+    QMutex mutex;
+    QString filePath;
+    QFile file;
+    uchar *mapped{nullptr};
+    qint64 mappedSize{0};
+    qint64 fileSize{0};
+    QHash<QString, IndexEntry> index;
+    // total size of the records in index, the rest of the file is superseded
+    qint64 liveSize{0};
+};
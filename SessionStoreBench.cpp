@@ -0,0 +1,77 @@
+// TopwarSessionStoreBench: times SessionStore::load() and get() of every session
+// with as many accounts as a large setup has, so that a slow startup shows up.
+// Exits with 1 if a session is lost or the load takes longer than MaxLoadTime.
+
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include "SessionStore.h"
+
+namespace {
+
+constexpr int AccountCnt = 10000;
+// every account has refreshed its token this many times since the last compaction
+constexpr int UpdatesPerAccount = 1;
+// generous, so that a slow machine does not fail it. The load is expected well below
+constexpr auto MaxLoadTime = 1000ms;
+
+QString accountKey(int i) {
+    return u"wx_%1"_s.arg(i, 8, 10, QChar{u'0'});
+}
+
+GameSessionInfo makeSession(int i, int version) {
+    // about the size of the real tokens
+    QString token = u"%1-%2-"_s.arg(i).arg(version) + QString(180, u't');
+    return GameSessionInfo{1000 + i % 500, u"wss://server-%1.rivergame.net/ws"_s.arg(i % 500), token,
+                           u"0f8fad5b-d9cb-469f-a165-70867728950e"_s, 1700000000000 + i};
+}
+
+} // END anonymous namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QTemporaryDir dir;
+    const QString path = dir.filePath(u"sessions.db"_s);
+
+    {
+        SessionStore store{path};
+        store.load();
+        for (int version = 0; version <= UpdatesPerAccount; version++) {
+            for (int i = 0; i < AccountCnt; i++) {
+                store.put(accountKey(i), makeSession(i, version));
+            }
+        }
+    }
+    qint64 fileSize = QFileInfo{path}.size();
+
+    QElapsedTimer timer;
+    timer.start();
+    SessionStore store{path};
+    store.load();
+    int64_t loadNs = timer.nsecsElapsed();
+
+    timer.restart();
+    int found = 0;
+    for (int i = 0; i < AccountCnt; i++) {
+        auto session = store.get(accountKey(i));
+        if (session != nullptr && session->serverInfoToken == makeSession(i, UpdatesPerAccount).serverInfoToken) {
+            found++;
+        }
+    }
+    int64_t getNs = timer.nsecsElapsed();
+
+    qDebug().noquote() << QString::asprintf("%d sessions, %lld KiB file: load %.1f ms, get %.2f us per session",
+        AccountCnt, static_cast<long long>(fileSize / 1024), loadNs / 1e6, getNs / 1e3 / AccountCnt);
+
+    bool ok = true;
+    if (found != AccountCnt) {
+        qDebug() << "FAILED:" << AccountCnt - found << "sessions lost or outdated";
+        ok = false;
+    }
+    if (nanoseconds{loadNs} > MaxLoadTime) {
+        qDebug() << "FAILED: load takes longer than" << MaxLoadTime.count() << "ms";
+        ok = false;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// TopwarSessionStoreTest: checks that SessionStore::load() recovers from the files
+// a crash or a bad disk leaves behind: a record cut short, a bad checksum, a
+// corrupt size field, a broken header. Every complete record before the damage
+// is kept, nothing after it is returned, and the store takes new writes.
+// Exits with 1 on a failure.
+
+#include <QCoreApplication>
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include "SessionStore.h"
+
+namespace {
+
+// Layout of SessionStore, see SessionStore.h
+constexpr qint64 HeaderSize = 12;
+constexpr qint64 RecordHeaderSize = 8;
+
+int failures = 0;
+
+void check(bool ok, const char *what) {
+    if (!ok) {
+        qDebug() << "FAILED:" << what;
+        failures++;
+    }
+}
+
+GameSessionInfo makeSession(int serverId, const QString &token) {
+    return GameSessionInfo{serverId, u"wss://server-%1.rivergame.net"_s.arg(serverId), token,
+                           u"temp-id"_s, 1700000000000};
+}
+
+bool sameSession(const unique_ptr<GameSessionInfo> &s, const GameSessionInfo &expected) {
+    return s != nullptr && s->serverId == expected.serverId && s->serverUrl == expected.serverUrl
+           && s->serverInfoToken == expected.serverInfoToken && s->tempId == expected.tempId
+           && s->tokenTime == expected.tokenTime;
+}
+
+qint64 fileSize(const QString &path) {
+    return QFileInfo{path}.size();
+}
+
+void truncateFile(const QString &path, qint64 size) {
+    QFile file{path};
+    file.open(QIODevice::ReadWrite);
+    file.resize(size);
+}
+
+void patchFile(const QString &path, qint64 pos, QByteArrayView bytes) {
+    QFile file{path};
+    file.open(QIODevice::ReadWrite);
+    file.seek(pos);
+    file.write(bytes.data(), bytes.size());
+}
+
+void flipByte(const QString &path, qint64 pos) {
+    QFile file{path};
+    file.open(QIODevice::ReadWrite);
+    file.seek(pos);
+    char c = 0;
+    file.getChar(&c);
+    file.seek(pos);
+    file.putChar(static_cast<char>(c ^ 0x5A));
+}
+
+const GameSessionInfo SessionA = makeSession(101, u"token-a"_s);
+const GameSessionInfo SessionB = makeSession(202, u"token-b"_s);
+const GameSessionInfo SessionC = makeSession(303, u"token-c"_s);
+
+// Writes A then B, and returns the file size after A and after B
+pair<qint64, qint64> writeTwo(const QString &path) {
+    QFile::remove(path);
+    SessionStore store{path};
+    store.load();
+    store.put(u"a"_s, SessionA);
+    qint64 afterA = fileSize(path);
+    store.put(u"b"_s, SessionB);
+    return {afterA, fileSize(path)};
+}
+
+// B is damaged: A is kept, the file ends after A, and new records are kept on reload
+void expectOnlyA(const QString &path, qint64 afterA, const char *what) {
+    {
+        SessionStore store{path};
+        store.load();
+        check(sameSession(store.get(u"a"_s), SessionA), what);
+        check(store.get(u"b"_s) == nullptr, what);
+        check(fileSize(path) == afterA, what);
+        check(store.put(u"c"_s, SessionC), what);
+    }
+    SessionStore store{path};
+    store.load();
+    check(sameSession(store.get(u"a"_s), SessionA) && sameSession(store.get(u"c"_s), SessionC)
+          && store.get(u"b"_s) == nullptr, what);
+}
+
+void testRoundTrip(const QString &path) {
+    writeTwo(path);
+    {
+        SessionStore store{path};
+        store.load();
+        check(sameSession(store.get(u"a"_s), SessionA) && sameSession(store.get(u"b"_s), SessionB),
+              "round trip: both sessions after reload");
+        store.remove(u"a"_s);
+    }
+    SessionStore store{path};
+    store.load();
+    check(store.get(u"a"_s) == nullptr && sameSession(store.get(u"b"_s), SessionB),
+          "round trip: a removed session stays removed");
+}
+
+void testTruncatedRecord(const QString &path) {
+    auto [afterA, afterB] = writeTwo(path);
+    truncateFile(path, afterB - 3);
+    expectOnlyA(path, afterA, "truncated record: dropped, the ones before kept");
+}
+
+void testTruncatedRecordHeader(const QString &path) {
+    auto [afterA, afterB] = writeTwo(path);
+    truncateFile(path, afterA + RecordHeaderSize / 2);
+    expectOnlyA(path, afterA, "truncated record header: dropped, the ones before kept");
+}
+
+void testBadChecksum(const QString &path) {
+    auto [afterA, afterB] = writeTwo(path);
+    flipByte(path, afterB - 1);
+    expectOnlyA(path, afterA, "bad checksum: the record is dropped");
+}
+
+void testCorruptSize(const QString &path) {
+    auto [afterA, afterB] = writeTwo(path);
+    patchFile(path, afterA, "\xff\xff\xff\x7f");
+    expectOnlyA(path, afterA, "corrupt size: the scan stops before it");
+}
+
+void testCorruptFirstRecord(const QString &path) {
+    writeTwo(path);
+    flipByte(path, HeaderSize + RecordHeaderSize + 2);
+    SessionStore store{path};
+    store.load();
+    // the scan can not tell where the next record starts, so it stops there
+    check(store.get(u"a"_s) == nullptr && store.get(u"b"_s) == nullptr, "corrupt first record: nothing returned");
+    check(fileSize(path) == HeaderSize, "corrupt first record: cut after the header");
+    check(store.put(u"c"_s, SessionC) && sameSession(store.get(u"c"_s), SessionC),
+          "corrupt first record: new writes work");
+}
+
+void testTruncatedFileHeader(const QString &path) {
+    writeTwo(path);
+    truncateFile(path, HeaderSize / 2);
+    SessionStore store{path};
+    store.load();
+    check(store.get(u"a"_s) == nullptr && fileSize(path) == HeaderSize, "truncated header: a new store");
+    check(store.put(u"c"_s, SessionC) && sameSession(store.get(u"c"_s), SessionC),
+          "truncated header: new writes work");
+}
+
+void testUnknownFormat(const QString &path) {
+    writeTwo(path);
+    patchFile(path, 0, "XXXXXXXX");
+    SessionStore store{path};
+    store.load();
+    check(store.get(u"a"_s) == nullptr && fileSize(path) == HeaderSize, "unknown format: a new store");
+    check(QFile::exists(path + u".bad"_s), "unknown format: the old file is kept");
+}
+
+} // END anonymous namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QTemporaryDir dir;
+    const QString path = dir.filePath(u"sessions.db"_s);
+
+    testRoundTrip(path);
+    testTruncatedRecord(path);
+    testTruncatedRecordHeader(path);
+    testBadChecksum(path);
+    testCorruptSize(path);
+    testCorruptFirstRecord(path);
+    testTruncatedFileHeader(path);
+    testUnknownFormat(path);
+
+    if (failures > 0) {
+        qDebug() << failures << "checks failed";
+        return 1;
+    }
+    qDebug() << "all checks passed";
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <QtCore>
+#include "ShardPool.h"
+
+constexpr int VirtualNodesPerShard = 64;
+
+ShardPool::ShardPool(int shardCount) {
+    shardCount = max(shardCount, 1);
+    for (int i = 0; i < shardCount; i++) {
+        auto thread = new QThread;
+        thread->setObjectName(u"shard-%1"_s.arg(i));
+        auto context = new QObject;
+        context->moveToThread(thread);
+        thread->start();
+        threads.push_back(thread);
+        contexts.push_back(context);
+
+        for (int v = 0; v < VirtualNodesPerShard; v++) {
+            ring.emplace_back(stableHash(u"shard-%1-%2"_s.arg(i).arg(v).toUtf8()), i);
+        }
+    }
+    std::ranges::sort(ring);
+}
+
+ShardPool::~ShardPool() {
+    for (auto thread : threads) {
+        thread->quit();
+    }
+    for (size_t i = 0; i < threads.size(); i++) {
+        threads[i]->wait();
+        delete contexts[i];
+        delete threads[i];
+    }
+}
+
+int ShardPool::shardCount() const {
+    return static_cast<int>(threads.size());
+}
+
+QThread* ShardPool::thread(int shard) const {
+    return threads[shard];
+}
+
+int ShardPool::shardOf(const QString &key) const {
+    if (auto it = assignments.find(key); it != assignments.end()) {
+        return it->second;
+    }
+    uint32_t h = stableHash(key.toUtf8());
+    auto it = std::ranges::lower_bound(ring, h, {}, &pair<uint32_t, int>::first);
+    if (it == ring.end()) {
+        it = ring.begin();
+    }
+    return it->second;
+}
+
+void ShardPool::assign(const QString &key, int shard) {
+    assignments[key] = shard;
+}
+
+void ShardPool::unassign(const QString &key) {
+    assignments.erase(key);
+}
+
+void ShardPool::destroy(int shard, QObject *obj) {
+    QMetaObject::invokeMethod(contexts[shard], [obj] {
+        delete obj;
+    }, blockingConnection(shard));
+}
+
+void ShardPool::runOnEach(const std::function<void(int shard)> &func) {
+    for (int i = 0; i < shardCount(); i++) {
+        QMetaObject::invokeMethod(contexts[i], [i, &func] {
+            func(i);
+        }, blockingConnection(i));
+    }
+}
+
+Qt::ConnectionType ShardPool::blockingConnection(int shard) const {
+    return QThread::currentThread() == threads[shard] ? Qt::DirectConnection
+                                                      : Qt::BlockingQueuedConnection;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QObject>
+#include <QThread>
+#include "common.h"
+
+/**
+ * N worker threads, each running its own event loop with its own scheduler
+ * (Scheduler::instance()) and network access manager (HttpRqst::getNamInst()).
+ *
+ * Keys (account ids) are assigned to shards by consistent hashing, so adding
+ * or removing a shard only moves a small part of the keys. An explicit
+ * assignment overrides the hash ring, which is used to rebalance accounts
+ * away from an overloaded shard.
+ *
+ * Objects living in a shard must be created and deleted in the shard's thread,
+ * see create() and destroy().
+ */
+class ShardPool
+{
+public:
+    explicit ShardPool(int shardCount);
+    ~ShardPool();
+
+    int shardCount() const;
+    QThread* thread(int shard) const;
+
+    int shardOf(const QString &key) const;
+    void assign(const QString &key, int shard);
+    void unassign(const QString &key);
+
+    /**
+     * Calls factory in the thread of the shard and returns the created object.
+     * Blocks the calling thread until the object is created.
+     */
+    template <class T, class Factory>
+    T* create(int shard, Factory &&factory) {
+        T *ret = nullptr;
+        QMetaObject::invokeMethod(contexts[shard], [&ret, &factory] {
+            ret = factory();
+        }, blockingConnection(shard));
+        return ret;
+    }
+
+    /**
+     * Deletes obj in the thread of the shard.
+     * Blocks the calling thread until the object is deleted.
+     */
+    void destroy(int shard, QObject *obj);
+
+    /**
+     * Calls func in the thread of every shard and waits for all of them.
+     */
+    void runOnEach(const std::function<void(int shard)> &func);
+
+private:
+    Qt::ConnectionType blockingConnection(int shard) const;
+
+    std::vector<QThread*> threads;
+    std::vector<QObject*> contexts;
+    std::vector<pair<uint32_t, int>> ring;
+    std::map<QString, int> assignments;
+};
@@ -0,0 +1,120 @@
+#include <QtCore>
+#include "TaskState.h"
+
+constexpr int TaskStateVersion = 1;
+constexpr auto ServerUtcOffset = std::chrono::hours{8};
+
+static int64_t toEpochMs(SteadyTimepoint t) {
+    auto wall = std::chrono::system_clock::now() + (t - SteadyClockNow());
+    return DurationCast::round<milliseconds>(wall.time_since_epoch()).count();
+}
+
+static SteadyTimepoint fromEpochMs(int64_t ms) {
+    auto wall = std::chrono::system_clock::time_point{milliseconds{ms}};
+    return SteadyClockNow() + DurationCast::round<milliseconds>(wall - std::chrono::system_clock::now());
+}
+
+TaskState::~TaskState() {
+    if (saveTimer.isActive()) {
+        saveNow();
+    }
+}
+
+TaskState::TaskState(const QString &filePath)
+    : filePath{filePath}
+{
+    saveTimer.setSingleShot(true);
+    saveTimer.callOnTimeout(this, &TaskState::saveNow);
+}
+
+void TaskState::load() {
+    QFile file{filePath};
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    const QJsonObject obj = QJsonDocument::fromJson(file.readAll()).object();
+    if (obj[u"version"_s].toInt() != TaskStateVersion) {
+        return;
+    }
+    schedule = obj[u"schedule"_s].toObject();
+    ledger = obj[u"ledger"_s].toObject();
+}
+
+void TaskState::save() {
+    if (!saveTimer.isActive()) {
+        saveTimer.start(3s);
+    }
+}
+
+void TaskState::saveNow() {
+    saveTimer.stop();
+    QJsonObject obj{
+        {u"version"_s, TaskStateVersion},
+        {u"schedule"_s, schedule},
+        {u"ledger"_s, ledger},
+    };
+    QSaveFile file{filePath};
+    if (!file.open(QIODevice::WriteOnly)) {
+        qDebug() << "failed to open task state file";
+        return;
+    }
+    file.write(QJsonDocument{obj}.toJson(QJsonDocument::Compact));
+    if (!file.commit()) {
+        qDebug() << "failed to save task state" << file.errorString();
+    }
+}
+
+std::map<int, SteadyTimepoint> TaskState::getSchedule() const {
+    std::map<int, SteadyTimepoint> ret;
+    for (auto it = schedule.begin(); it != schedule.end(); it++) {
+        ret[it.key().toInt()] = fromEpochMs(it.value().toInteger());
+    }
+    return ret;
+}
+
+void TaskState::setScheduleTime(int taskId, SteadyTimepoint t) {
+    schedule[QString::number(taskId)] = toEpochMs(t);
+    save();
+}
+
+void TaskState::removeSchedule(int taskId) {
+    schedule.remove(QString::number(taskId));
+    save();
+}
+
+void TaskState::clearSchedule() {
+    schedule = {};
+    save();
+}
+
+void TaskState::setAccount(const QString &accountKey) {
+    this->accountKey = accountKey;
+}
+
+bool TaskState::isDone(int taskId, int64_t day) const {
+    const QJsonObject entry = ledger[accountKey].toObject();
+    if (entry[u"day"_s].toInteger() != day) {
+        return false;
+    }
+    return entry[u"done"_s].toArray().contains(taskId);
+}
+
+void TaskState::markDone(int taskId, int64_t day) {
+    if (accountKey.isEmpty() || isDone(taskId, day)) {
+        return;
+    }
+    QJsonObject entry = ledger[accountKey].toObject();
+    QJsonArray done;
+    if (entry[u"day"_s].toInteger() == day) {
+        done = entry[u"done"_s].toArray();
+    }
+    done.append(taskId);
+    entry[u"day"_s] = day;
+    entry[u"done"_s] = done;
+    ledger[accountKey] = entry;
+    save();
+}
+
+int64_t TaskState::serverDay(milliseconds serverTime) {
+    return DurationCast::floor<std::chrono::days>(serverTime + ServerUtcOffset).count();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <QJsonObject>
+#include "common.h"
+
+/**
+ * Persists the scheduler's pending tasks and a per-account, per-server-day
+ * ledger of completed daily tasks, so that a restart resumes where the
+ * previous run left off instead of re-checking every task.
+ *
+ * Writes are deferred and go through QSaveFile, so a crash never leaves
+ * a truncated state file behind.
+ */
+class TaskState: public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit TaskState(const QString &filePath);
+    ~TaskState() override;
+
+    void load();
+    void save();
+    void saveNow();
+
+    // Pending schedule tasks, keyed by schedule task id
+    std::map<int, SteadyTimepoint> getSchedule() const;
+    void setScheduleTime(int taskId, SteadyTimepoint t);
+    void removeSchedule(int taskId);
+    void clearSchedule();
+
+    // Per-day ledger of the current account
+    void setAccount(const QString &accountKey);
+    bool isDone(int taskId, int64_t day) const;
+    void markDone(int taskId, int64_t day);
+
+    // Server day number (UTC+8) of the given server time
+    static int64_t serverDay(milliseconds serverTime);
+
+private:
+    QString filePath;
+    QString accountKey;
+    QJsonObject schedule;
+    QJsonObject ledger;
+    QTimer saveTimer;
+};
@@ -1,16 +1,28 @@
 #include "TopwarHelper.h"
-#include "MainWindow.h"
+#include "AccountManager.h"
 #include "Config.h"
-#include "log.h"
 
+// per-account session file of older versions, moved into the SessionStore
 constexpr auto SessionSaveRelPath = "topwarSession.dat";
+constexpr auto TaskStateSaveRelPath = "taskState.json";
 
 constexpr auto ReservedLoginTime = 5s;
 constexpr auto KeepAliveTime = 10s; // close connection after idle
 constexpr auto TaskMaxPendingTime = 120s;
+constexpr auto LoginRetryTime = 120s;
+constexpr auto LoginRetryJitter = 30s;
+constexpr auto LoginRqstDeadline = 60s;
+constexpr auto SessionTokenRefreshAge = std::chrono::hours{12};
+constexpr int MaxFailedLogins = 3; // the saved session is considered invalid after that
+constexpr auto PrewarmLeadTime = 10s; // well within the idle timeout of cached connections
 
 constexpr int DailyTaskId = 0;
 
+// Schedule tasks whose callbacks can be rebuilt from their id after a restart
+static bool isPersistentScheduleTask(int id) {
+    return id == DailyTaskId || id == TopwarRqstId::AWARD_EXPLORE_SEA;
+}
+
 
 struct ChangeServerParam {
     int serverId;
@@ -34,42 +46,69 @@ public:
 
 TopwarHelper::~TopwarHelper() = default;
 
-TopwarHelper::TopwarHelper() {
-    doRqstGameVersion();
+TopwarHelper::TopwarHelper(AccountManager *manager, const QString &accountId,
+                           const QString &dataDir, const QJsonObject &configOverrides)
+    : manager{manager}, accountId{accountId}, dataDir{dataDir}, configOverrides{configOverrides},
+      cfg{Config::resolve(configOverrides)},
+      taskState{QDir{dataDir}.filePath(TaskStateSaveRelPath)}
+{
+    taskState.load();
+    restoreScheduleTasks();
 
-    logoutTimer.setSingleShot(true);
     logoutTimer.callOnTimeout(this, &TopwarHelper::logoutIfIdle);
-
-    loginTimer.setSingleShot(true);
     loginTimer.callOnTimeout(this, [this]{ loginBySession(readSavedSession());});
-
-    runTaskTimer.setSingleShot(true);
+    prewarmTimer.callOnTimeout(this, [this] { manager->prewarmGameHosts(); });
+    tokenRefreshTimer.callOnTimeout(this, &TopwarHelper::loginToRefreshToken);
     runTaskTimer.callOnTimeout(this, &TopwarHelper::runTask);
 }
 
-void TopwarHelper::doRqstGameVersion() {
-    auto rqstHandler = rqstGameVersion();
-    httpRqstAborter.bindRqst(rqstHandler);
-    rqstHandler.whenFinished(
-        [this](QString result) {
-            qDebug() << "version:" << result;
-            gameVersion = result;
-            if (!pendingLoginToken.isEmpty()) {
-                loginByToken(pendingLoginToken);
-                pendingLoginToken.clear();
-            }
-            if (pendingLoginSession != nullptr) {
-                loginBySession(std::move(pendingLoginSession));
+const QString& TopwarHelper::getAccountId() const {
+    return accountId;
+}
+
+const QJsonObject& TopwarHelper::getConfigOverrides() const {
+    return configOverrides;
+}
+
+void TopwarHelper::setConfigOverrides(const QJsonObject &overrides) {
+    configOverrides = overrides;
+    onConfigChanged();
+}
+
+void TopwarHelper::onConfigChanged() {
+    auto old = std::exchange(cfg, Config::resolve(configOverrides));
+    if (cfg->get(Config::Warzone) != old->get(Config::Warzone)) {
+        onWantedWarzoneChanged(cfg->get(Config::Warzone));
+        return;
+    }
+    if (cfg->get(Config::RunInterval) != old->get(Config::RunInterval) && scheduleTaskMap.contains(DailyTaskId)) {
+        seconds interval{cfg->get(Config::RunInterval)};
+        addScheduleTask(DailyTaskId, nextDailyRunDelay(interval), [this]{ doDailyTasks(); });
+        // after the task is added. The login follows the daily run, earlier or later
+        QTimer::singleShot(0, this, [this] {
+            if (conn == nullptr && loginTimer.isActive()) {
+                scheduleLogin();
             }
-        },
-        [](auto &&err) {
-            qDebug() << "failed to get game version." << err.getDescription();
-        }
-    );
+        });
+    }
 }
 
-unique_ptr<GameSessionInfo> TopwarHelper::readSavedSession() {
-    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(SessionSaveRelPath);
+nanoseconds TopwarHelper::getBusyTime() const {
+    nanoseconds ret = connBusyTime + logoutTimer.getBusyTime()
+                      + loginTimer.getBusyTime() + runTaskTimer.getBusyTime()
+                      + prewarmTimer.getBusyTime() + tokenRefreshTimer.getBusyTime();
+    if (conn != nullptr) {
+        ret += conn->getBusyTime();
+    }
+    return ret;
+}
+
+bool TopwarHelper::isConnected() const {
+    return conn != nullptr && conn->getWebSocket().isValid();
+}
+
+// Reads the session file of older versions, which had one file per account
+static unique_ptr<GameSessionInfo> readLegacySession(const QString &filePath) {
     QFile sessionSaveFile{filePath};
     if (!sessionSaveFile.open(QIODevice::ReadOnly)) {
         return {};
@@ -84,71 +123,145 @@ unique_ptr<GameSessionInfo> TopwarHelper::readSavedSession() {
     return session;
 }
 
-void TopwarHelper::saveSession() {
-    QString filePath = QDir{QCoreApplication::applicationDirPath()}.filePath(SessionSaveRelPath);
-    QFile sessionSaveFile{filePath};
-    if (!sessionSaveFile.open(QIODevice::WriteOnly)) {
-        qDebug() << "failed to open session save file";
-        return;
+unique_ptr<GameSessionInfo> TopwarHelper::readSavedSession() {
+    SessionStore &store = manager->getSessionStore();
+    if (auto session = store.get(accountId)) {
+        return session;
+    }
+    QString legacyFilePath = QDir{dataDir}.filePath(SessionSaveRelPath);
+    auto session = readLegacySession(legacyFilePath);
+    if (session != nullptr && store.put(accountId, *session)) {
+        QFile::remove(legacyFilePath);
     }
-    QDataStream out(&sessionSaveFile);
-    out.setByteOrder(QDataStream::LittleEndian);
-    GameSessionInfo session = conn->getSessionInfo();
-    out << session;
+    return session;
+}
+
+void TopwarHelper::saveSession() {
+    saveSession(conn->getSessionInfo());
+}
+
+void TopwarHelper::saveSession(const GameSessionInfo &session) {
+    // appends only if the session changed
+    manager->getSessionStore().put(accountId, session);
 }
 
 void TopwarHelper::loginByToken(const QString &token) {
-    if (gameVersion.isEmpty()) {
-        pendingLoginToken = token;
-        if (!httpRqstAborter.isValid()) {
-            doRqstGameVersion();
+    // a new login supersedes the requests of the previous one
+    loginScope = make_unique<HttpRqst::CancelScope>(&rqstScope, LoginRqstDeadline);
+    manager->requestGameVersion(this, [this, token, scope=loginScope.get()](const QString &gameVersion) {
+        if (gameVersion.isEmpty() || scope != loginScope.get() || scope->isCanceled()) {
+            return;
         }
-        return;
-    }
+        // in the threads of the executor, whose connections are pre-warmed.
+        // Replacing the handler aborts the request of the previous login
+        sessionRqstAborter = manager->getRqstExecutor().run(this,
+            [gameVersion, token] { return rqstSessionInfo(gameVersion, token); },
+            [this](unique_ptr<GameSessionInfo> session) {
+                qDebug() << session->serverId
+                         << "serverToken:" << session->serverInfoToken
+                         << "temp_id:" << session->tempId;
+                // kept even if the login waits long for admission, or fails
+                saveSession(*session);
+                tokenRefreshFailed = false;
+                loginBySession(std::move(session));
+            },
+            [](const HttpRqst::RqstError &err) {
+                qDebug() << "failed to get game session." << err.getDescription();
+            }
+        );
+    });
+}
 
-    rqstSessionInfo(gameVersion, token).whenFinished(
-        [this](unique_ptr<GameSessionInfo> session) {
-            qDebug() << session->serverId
-                     << "serverToken:" << session->serverInfoToken
-                     << "temp_id:" << session->tempId;
-            loginBySession(std::move(session));
-        },
-        [](auto &&err) {
-            qDebug() << "failed to get game session." << err.getDescription();
+void TopwarHelper::start(unique_ptr<GameSessionInfo> session) {
+    if (auto it = scheduleTaskMap.find(DailyTaskId); it != scheduleTaskMap.end()) {
+        auto t = (it->second.time - SteadyClockNow()) - ReservedLoginTime;
+        if (t > 0s) {
+            // daily tasks of this period are already done, resume the saved schedule
+            scheduleLogin();
+            return;
         }
-    );
+    }
+    loginBySession(std::move(session));
 }
 
 void TopwarHelper::loginBySession(unique_ptr<GameSessionInfo> session) {
-    if (gameVersion.isEmpty()) {
-        pendingLoginSession = std::move(session);
-        if (!httpRqstAborter.isValid()) {
-            doRqstGameVersion();
-        }
+    if (session == nullptr) {
         return;
     }
+    manager->getLoginAdmission().acquire(this, [this, session=shared_ptr<GameSessionInfo>{std::move(session)}] {
+        connectToGame(*session);
+    });
+}
 
-    conn = make_unique<GameConnection>(gameVersion, *session);
+// The version is only needed by LOGIN, so it is looked up while the socket is connecting
+void TopwarHelper::connectToGame(const GameSessionInfo &session) {
+    conn = make_unique<GameConnection>(session);
+    QPointer<GameConnection> newConn = conn.get();
+    manager->requestGameVersion(this, [this, newConn](const QString &gameVersion) {
+        if (newConn == nullptr) {
+            return;
+        }
+        if (gameVersion.isEmpty()) {
+            // the socket may still be connecting, so drop it instead of waiting for it to close
+            newConn->disconnect(this);
+            onConnectionClosed();
+            return;
+        }
+        newConn->setGameVersion(gameVersion);
+    });
+    connect(conn.get(), &GameConnection::loginRejected, this, [this, retried=false]() mutable {
+        if (retried) {
+            logWarn() << u"登录被拒绝"_s;
+            conn->getWebSocket().close();
+            return;
+        }
+        retried = true;
+        // Either the version is outdated or the session token is no longer valid. The version
+        // is shared by all accounts, so it is only replaced if the game site serves a new one
+        QPointer<GameConnection> currConn = conn.get();
+        manager->revalidateGameVersion(this, conn->getGameVersion(), [this, currConn](const QString &gameVersion) {
+            if (currConn == nullptr) {
+                return;
+            }
+            if (gameVersion.isEmpty()) {
+                currConn->getWebSocket().close();
+                return;
+            }
+            if (gameVersion == currConn->getGameVersion()) {
+                logWarn() << u"登录被拒绝，游戏版本未变，会话令牌可能已失效"_s;
+                currConn->getWebSocket().close();
+                return;
+            }
+            currConn->relogin(gameVersion);
+        });
+    });
     connect(conn.get(), &GameConnection::loginSucceeded, this, [this] {
-        getMainWindow()->showUserInfo(conn->getWarzone(), conn->getUsername());
+        manager->getLoginAdmission().release(this);
+        failedLoginCnt = 0;
+        loginUid = conn->getUserInfo()[u"gameUid"_s].toInteger();
+        loginWarzone = conn->getWarzone();
+        emit userInfoChanged(conn->getWarzone(), conn->getUsername());
         if (conn->getWarzone() == 0) {
-            log() << u"登录失败，问题待解决"_s;
+            logWarn() << u"登录失败，问题待解决"_s;
             return;
         }
 
         saveSession();
+        taskState.setAccount(QString::number(loginUid));
 
         if (shareBoxCtx != nullptr) {
             handleShareBoxLogin();
             return;
         }
 
-        int wantedWarzone = Config::get(Config::KeyWarzone).toInt();
+        int wantedWarzone = config(Config::Warzone);
         if (wantedWarzone != 0 && conn->getWarzone() != wantedWarzone) {
             conn->changeServer(wantedWarzone);
             return;
         }
 
+        refreshSessionTokenIfOld();
+
         currLoginTaskQueue = {};
         if (!scheduleTaskMap.contains(DailyTaskId)) {
             doDailyTasks();
@@ -157,16 +270,96 @@ void TopwarHelper::loginBySession(unique_ptr<GameSessionInfo> session) {
             runTask();
         }
     });
-    connect(conn.get(), &GameConnection::connectionClosed, this, [this] {
-        QTimer::singleShot(0, this, [this] {
-            conn.reset();
-            runTaskTimer.stop();
-            logoutTimer.stop();
-            scheduleLogin();
+    connect(conn.get(), &GameConnection::connectionClosed, this, &TopwarHelper::onConnectionClosed);
+}
+
+LogLine TopwarHelper::logWarn() const {
+    return LogLine{LogEvent::WarningText, loginUid, loginWarzone};
+}
+
+void TopwarHelper::onConnectionClosed() {
+    manager->getLoginAdmission().release(this);
+    manager->getTokenRefreshAdmission().release(this);
+    QTimer::singleShot(0, this, [this] {
+        if (!conn->getGameVersion().isEmpty() && conn->getUserInfo().isEmpty()) {
+            // LOGIN is sent but never succeeds
+            failedLoginCnt++;
+            if (failedLoginCnt == MaxFailedLogins) {
+                logWarn() << u"账号 "_s << accountId << u" 连续登录失败，会话可能已失效，请重新扫码登录"_s;
+            }
+        }
+        connBusyTime += conn->getBusyTime();
+        conn.reset();
+        runTaskTimer.stop();
+        logoutTimer.stop();
+        scheduleLogin();
+    });
+}
+
+// The token is refreshed in background while logged in, so that a scheduled
+// login never has to wait for a new token.
+void TopwarHelper::refreshSessionTokenIfOld() {
+    auto tokenAge = milliseconds{QDateTime::currentMSecsSinceEpoch() - conn->getSessionInfo().tokenTime};
+    if (tokenAge < SessionTokenRefreshAge) {
+        return;
+    }
+    LoginAdmission &admission = manager->getTokenRefreshAdmission();
+    admission.acquire(this, [this, &admission] {
+        if (!isConnected()) {
+            admission.release(this);
+            return;
+        }
+        conn->refreshSessionToken([this, &admission](bool ok) {
+            admission.release(this);
+            tokenRefreshFailed = !ok;
+            if (!ok) {
+                qDebug() << accountId << "failed to refresh session token";
+                return;
+            }
+            saveSession();
         });
     });
 }
 
+// While logged out, the token would only be refreshed by the next scheduled
+// login, which fails if the token expired meanwhile. So an account whose token
+// gets old before its next login logs in for the refresh alone, and logs out
+// again once idle.
+void TopwarHelper::scheduleTokenRefresh() {
+    tokenRefreshTimer.stop();
+    auto session = readSavedSession();
+    if (session == nullptr || session->tokenTime == 0 || tokenRefreshFailed) {
+        // an unknown age is refreshed by the next login
+        return;
+    }
+    auto tokenAge = milliseconds{QDateTime::currentMSecsSinceEpoch() - session->tokenTime};
+    auto t = max(SessionTokenRefreshAge - tokenAge, milliseconds{LoginRetryTime})
+             + LoginAdmission::phaseOf(accountId, LoginRetryJitter);
+    if (loginTimer.isActive() && t >= loginTimer.remainingTimeAsDuration()) {
+        // the next login refreshes it
+        return;
+    }
+    tokenRefreshTimer.start(t);
+}
+
+void TopwarHelper::loginToRefreshToken() {
+    if (conn != nullptr) {
+        // a login is running, it refreshes the token once logged in
+        return;
+    }
+    LoginAdmission &admission = manager->getTokenRefreshAdmission();
+    admission.acquire(this, [this, &admission] {
+        auto session = readSavedSession();
+        if (conn != nullptr || session == nullptr) {
+            admission.release(this);
+            return;
+        }
+        qDebug() << accountId << "logging in to refresh session token";
+        // the slot is kept by refreshSessionTokenIfOld(), and released with the connection
+        loginBySession(std::move(session));
+    });
+}
+
 void TopwarHelper::logoutIfIdle() {
     if (conn == nullptr || !conn->getWebSocket().isValid()) {
         return;
@@ -177,26 +370,51 @@ void TopwarHelper::logoutIfIdle() {
         return;
     }
 
-    gameVersion = QString{};
     conn->getWebSocket().close();
 }
 
 void TopwarHelper::scheduleLogin() {
+    // deterministic jitter so that failed logins of many accounts do not retry together
+    auto retryTime = LoginRetryTime + LoginAdmission::phaseOf(accountId, LoginRetryJitter);
     if (!scheduleTaskMap.empty()) {
         auto nextScheduleTime = SteadyClockMax;
         for (const auto& [id, task] : scheduleTaskMap) {
             nextScheduleTime = std::min(nextScheduleTime, task.time);
         }
         auto t = (nextScheduleTime - SteadyClockNow()) - ReservedLoginTime;
-        loginTimer.start(std::max(DurationCast::round<seconds>(t), 120s));
+        startLoginTimer(std::max(DurationCast::round<milliseconds>(t), retryTime));
     } else {
         // unexpected
-        loginTimer.start(120s); // retry
+        startLoginTimer(retryTime); // retry
+    }
+    scheduleTokenRefresh();
+}
+
+// Connections are opened shortly before the login, so that it skips the TLS handshakes
+void TopwarHelper::startLoginTimer(milliseconds t) {
+    loginTimer.start(t);
+    if (t > PrewarmLeadTime) {
+        prewarmTimer.start(t - PrewarmLeadTime);
+    } else {
+        prewarmTimer.stop();
+    }
+}
+
+// Aligns the daily runs of each account to its own phase in the interval,
+// so that accounts with the same interval do not wake up together.
+milliseconds TopwarHelper::nextDailyRunDelay(milliseconds interval) const {
+    auto phase = LoginAdmission::phaseOf(accountId, interval);
+    auto now = DurationCast::floor<milliseconds>(std::chrono::system_clock::now().time_since_epoch());
+    auto sinceSlot = (now - phase) % interval;
+    auto delay = interval - sinceSlot;
+    if (delay < interval / 2) {
+        delay += interval;
     }
+    return delay;
 }
 
 void TopwarHelper::onWantedWarzoneChanged(int warzone) {
-    scheduleTaskMap.clear();
+    clearScheduleTasks();
     if (conn == nullptr || !conn->getWebSocket().isValid()) {
         loginTimer.stop();
         loginBySession(readSavedSession());
@@ -215,15 +433,38 @@ void TopwarHelper::addTask(milliseconds t, std::function<void()> callback) {
 
 void TopwarHelper::addScheduleTask(int id, milliseconds t, std::function<void()> callback) {
     QTimer::singleShot(0, this, [this, id, t, callback=std::move(callback)] {
-        scheduleTaskMap[id] = Task{SteadyClockNow() + t, std::move(callback)};
+        auto time = SteadyClockNow() + t;
+        scheduleTaskMap[id] = Task{time, std::move(callback)};
+        if (isPersistentScheduleTask(id)) {
+            taskState.setScheduleTime(id, time);
+        }
         if (t < TaskMaxPendingTime && conn != nullptr && conn->getWebSocket().isValid()) {
             taskAdded(t);
         } else if (loginTimer.isActive() && t < loginTimer.remainingTimeAsDuration()) {
-            loginTimer.start(t);
+            startLoginTimer(t);
         }
     });
 }
 
+void TopwarHelper::restoreScheduleTasks() {
+    for (const auto& [id, time] : taskState.getSchedule()) {
+        std::function<void()> callback;
+        if (id == DailyTaskId) {
+            callback = [this]{ doDailyTasks(); };
+        } else if (id == TopwarRqstId::AWARD_EXPLORE_SEA) {
+            callback = [this]{ checkActivity(); };
+        } else {
+            continue;
+        }
+        scheduleTaskMap[id] = Task{time, std::move(callback)};
+    }
+}
+
+void TopwarHelper::clearScheduleTasks() {
+    scheduleTaskMap.clear();
+    taskState.clearSchedule();
+}
+
 void TopwarHelper::taskAdded(milliseconds t) {
     if (logoutTimer.isActive()) {
         logoutTimer.stop();
@@ -235,7 +476,7 @@ void TopwarHelper::taskAdded(milliseconds t) {
 
 void TopwarHelper::runTask() {
     if (!conn->getWebSocket().isValid()) {
-        logoutTimer.start(0);
+        logoutTimer.start(0ms);
         return;
     }
 
@@ -246,6 +487,7 @@ void TopwarHelper::runTask() {
         auto &[id, task] = *it;
         if (task.time < now + 10ms) {
             task.callback();
+            taskState.removeSchedule(id);
             it = scheduleTaskMap.erase(it);
         } else {
             if (task.time < now + TaskMaxPendingTime) {
@@ -283,8 +525,8 @@ void TopwarHelper::consumeCoin(QByteArray batchBuildData, double coin) {
 }
 
 void TopwarHelper::doDailyTasks() {
-    seconds interval{Config::get(Config::KeyRunInterval).toInt(Config::RunIntervalDefault)};
-    addScheduleTask(DailyTaskId, interval, [this]{ doDailyTasks(); });
+    seconds interval{config(Config::RunInterval)};
+    addScheduleTask(DailyTaskId, nextDailyRunDelay(interval), [this]{ doDailyTasks(); });
 
     checkActivity();
 
@@ -294,16 +536,41 @@ void TopwarHelper::doDailyTasks() {
         doDailyAllianceTasks();
     }
 
-    for (int i = conn->getUserInfo()[u"secretTreasure"_s].toInt(); i < 5; i++) {
-        addTask(3000ms + 100ms*i, [this]{ conn->obtainSecretTreasure(); });
+    if (!isDoneToday(TopwarRqstId::ShareRewardBoxReceive)) {
+        int obtainedCnt = conn->getUserInfo()[u"secretTreasure"_s].toInt();
+        if (obtainedCnt >= 5) {
+            markDoneToday(TopwarRqstId::ShareRewardBoxReceive);
+        }
+        for (int i = obtainedCnt; i < 5; i++) {
+            addTask(3000ms + 100ms*i, [this]{ conn->obtainSecretTreasure(); });
+        }
+    }
+
+    if (!isDoneToday(TopwarRqstId::VideoRewardGet)) {
+        int doAdRewardCnt = 20 - conn->getUserInfo()[u"dayGoldVideoCount"_s].toInt();
+        if (doAdRewardCnt <= 0) {
+            markDoneToday(TopwarRqstId::VideoRewardGet);
+        }
+        for (int i = 0; i < doAdRewardCnt; i++) {
+            addTask(3500ms + 40s * i, [this]{ conn->obtainVideoReward(); });
+        }
     }
 
-    int doAdRewardCnt = 20 - conn->getUserInfo()[u"dayGoldVideoCount"_s].toInt();
-    for (int i = 0; i < doAdRewardCnt; i++) {
-        addTask(3500ms + 40s * i, [this]{ conn->obtainVideoReward(); });
+    if (!isDoneToday(TopwarRqstId::SHARE_GIFT_GET_COUNT_REWARD)) {
+        addTask(4000ms, [this]{ checkWxShareReward(); });
     }
+}
+
+int64_t TopwarHelper::currentServerDay() const {
+    return TaskState::serverDay(conn->getLastServerTime());
+}
 
-    addTask(4000ms, [this]{ checkWxShareReward(); });
+bool TopwarHelper::isDoneToday(int taskId) const {
+    return taskState.isDone(taskId, currentServerDay());
+}
+
+void TopwarHelper::markDoneToday(int taskId) {
+    taskState.markDone(taskId, currentServerDay());
 }
 
 void TopwarHelper::doDailyAllianceTasks() {
@@ -314,8 +581,11 @@ void TopwarHelper::doDailyAllianceTasks() {
         int exp;
     };
     addTask(200ms, [this] {
+        if (conn->getAllianceWorldSiteDonateNum() == 0) {
+            return;
+        }
         conn->sendGetWorldSiteInfo([this](auto &&resp) {
-            int preferred = Config::get(Config::KeyWorldSiteDonatePrefer).toInt();
+            int preferred = config(Config::WorldSiteDonatePrefer);
             int64_t userAid = conn->getAllianceId();
             std::vector<WorldSite_t> candidates;
             candidates.reserve(8);
@@ -348,9 +618,12 @@ void TopwarHelper::doDailyAllianceTasks() {
     });
 
     addTask(1000ms, [this] {
+        if (conn->getAllianceDonateNum() == 0) {
+            return;
+        }
         conn->sendGetAllianceScienceInfo([this](auto &&resp) {
             int recommended = 0;
-            int preferred = Config::get(Config::KeyScienceDonatePrefer).toInt();
+            int preferred = config(Config::ScienceDonatePrefer);
             int candidate = 0;
             for (const auto &obj : resp[u"scs"_s].toArray()) {
                 int id = obj[u"sid"_s].toInt();
@@ -382,8 +655,15 @@ void TopwarHelper::doDailyAllianceTasks() {
         });
     });
 
-    if (QDate::currentDate().dayOfWeek() == 1 && Config::get(Config::KeyDonateCoinConsume).toBool()) {
-        addTask(2000ms, [this]{ conn->donateAllianceScience(AllianceScience::快速作战); });
+    // Monday of the server day, like the ledger, so that both agree around midnight
+    bool isMonday = QDate{1970, 1, 1}.addDays(currentServerDay()).dayOfWeek() == Qt::Monday;
+    if (isMonday && config(Config::DonateCoinConsume) && !isDoneToday(TopwarRqstId::ALLIANCE_DOANTE_SCIENCE)) {
+        addTask(2000ms, [this] {
+            // marked once the server accepts it, so that a failed donation is retried by the next login
+            conn->donateAllianceScience(AllianceScience::快速作战, [this] {
+                markDoneToday(TopwarRqstId::ALLIANCE_DOANTE_SCIENCE);
+            });
+        });
     }
 }
 
@@ -393,7 +673,7 @@ void TopwarHelper::checkActivity() {
             QString uiName = obj[u"showUiType"_s].toString();
             if (uiName == u"ActivityDeepSeaTreasure"_s) {
                 checkDeepSeaTreasure(obj.toObject());
-            } else if (uiName == u"ActivityShareBox"_s) {
+            } else if (uiName == u"ActivityShareBox"_s && !isDoneToday(TopwarRqstId::GET_SHAREBOX_ACTIVITY_REWARD)) {
                 checkShareBox(obj.toObject());
             }
         }
@@ -437,6 +717,7 @@ void TopwarHelper::checkWxShareReward() {
             for (int i = rewardCnt; i < 4; i++) {
                 conn->obtainWxShareReward();
             }
+            markDoneToday(TopwarRqstId::SHARE_GIFT_GET_COUNT_REWARD);
         }
     });
 }
@@ -461,6 +742,7 @@ void TopwarHelper::checkShareBox(const QJsonObject &obj) {
             }
             conn->sendGetShareBoxReward(i + 1, box[u"id"_s].toInt());
         }
+        markDoneToday(TopwarRqstId::GET_SHAREBOX_ACTIVITY_REWARD);
         return;
     }
 
@@ -513,7 +795,7 @@ void TopwarHelper::checkShareBox(const QJsonObject &obj) {
         conn->changeServer(server.serverId, server.uid, server.serverUrl);
         logoutTimer.stop();
         runTaskTimer.stop();
-        scheduleTaskMap.clear();
+        clearScheduleTasks();
     });
 }
 
@@ -1,26 +1,49 @@
 #pragma once
 
 #include "GameConnection.h"
+#include "TaskState.h"
+#include "Scheduler.h"
+#include "RqstExecutor.h"
+#include "Config.h"
+#include "log.h"
 #include <queue>
 
 template <class T>
 using MinHeap = std::priority_queue<T, std::vector<T>, std::greater<T>>;
 
 class ActivityShareBoxContext;
+class AccountManager;
 
 class TopwarHelper: public QObject
 {
     Q_OBJECT
 
 public:
-    TopwarHelper();
+    TopwarHelper(AccountManager *manager, const QString &accountId,
+                 const QString &dataDir, const QJsonObject &configOverrides);
     ~TopwarHelper();
 
+    const QString& getAccountId() const;
+    const QJsonObject& getConfigOverrides() const;
+    void setConfigOverrides(const QJsonObject &overrides);
+    // Resolves the settings again and applies the changes to the running account
+    void onConfigChanged();
+
+    template <class T>
+    T config(Config::Key<T> key) const {
+        return cfg->get(key);
+    }
+
+    nanoseconds getBusyTime() const;
+    bool isConnected() const;
+
     unique_ptr<GameSessionInfo> readSavedSession();
     void saveSession();
+    void saveSession(const GameSessionInfo &session);
 
     void loginByToken(const QString &token);
     void loginBySession(unique_ptr<GameSessionInfo> session);
+    void start(unique_ptr<GameSessionInfo> session);
     void onWantedWarzoneChanged(int warzone);
     void consumeCoin(QByteArray batchBuildData, double coin);
 
@@ -42,12 +65,26 @@ public:
         }
     };
 
+signals:
+    void userInfoChanged(int warzone, const QString &username);
+
 private:
-    void doRqstGameVersion();
+    // A warning about this account, recorded with the uid and warzone it last logged in with
+    LogLine logWarn() const;
+
+    void connectToGame(const GameSessionInfo &session);
+    void onConnectionClosed();
+    void refreshSessionTokenIfOld();
+    void scheduleTokenRefresh();
+    void loginToRefreshToken();
     void logoutIfIdle();
     void scheduleLogin();
+    void startLoginTimer(milliseconds t);
+    milliseconds nextDailyRunDelay(milliseconds interval) const;
 
     void addScheduleTask(int id, milliseconds t, std::function<void()> callback);
+    void restoreScheduleTasks();
+    void clearScheduleTasks();
     void addTask(milliseconds t, std::function<void()> callback);
 
     void taskAdded(milliseconds t);
@@ -61,17 +98,38 @@ private:
     void checkShareBox(const QJsonObject &obj);
     void handleShareBoxLogin();
 
-    HttpRqst::AbortHandler httpRqstAborter;
-    QString gameVersion;
-    QString pendingLoginToken;
-    unique_ptr<GameSessionInfo> pendingLoginSession;
+    int64_t currentServerDay() const;
+    bool isDoneToday(int taskId) const;
+    void markDoneToday(int taskId);
+
+    AccountManager *manager;
+    QString accountId;
+    QString dataDir;
+    QJsonObject configOverrides;
+    // the global settings with configOverrides on top
+    shared_ptr<const Config::Values> cfg;
+
+    // all HTTP requests of the account, canceled when the account is removed or moved
+    HttpRqst::CancelScope rqstScope;
+    unique_ptr<HttpRqst::CancelScope> loginScope;
+    AsyncAbortHandler sessionRqstAborter;
     unique_ptr<ActivityShareBoxContext> shareBoxCtx;
 
     MinHeap<Task> currLoginTaskQueue;
     std::map<int, Task> scheduleTaskMap;
+    TaskState taskState;
 
     unique_ptr<GameConnection> conn;
-    QTimer logoutTimer;
-    QTimer loginTimer;
-    QTimer runTaskTimer;
+    // of the last login, kept for the lines logged before the next one succeeds
+    int64_t loginUid{0};
+    int loginWarzone{0};
+    nanoseconds connBusyTime{0};
+    int failedLoginCnt{0};
+    // no background refresh until a refresh succeeds again
+    bool tokenRefreshFailed{false};
+    ScheduledTimer logoutTimer;
+    ScheduledTimer loginTimer;
+    ScheduledTimer prewarmTimer;
+    ScheduledTimer tokenRefreshTimer;
+    ScheduledTimer runTaskTimer;
 };
@@ -1,1974 +1,307 @@
+#include <algorithm>
+#include <cmath>
+#include <charconv>
 #include "TopwarIds.h"
+#include "GameCatalog.h"
 
-static QString _s;
+qsizetype formatNumber(double val, int precision, char16_t *out) {
+    static constexpr const char* Units[] = {
+        "", "K", "M", "B", "T",
+        "aa", "bb", "cc", "dd", "ee", "ff",
+        "gg", "hh", "ii", "jj", "kk", "ll"
+    };
+    // keeps the digits within uint64_t
+    constexpr int MaxPrecision = 6;
+    constexpr double MaxScaled = 1e18;
 
-QString getItemName(int itemId) {
-    switch (itemId) {
-    case 200003:  return u"迁城"_s;
+    char16_t *p = out;
+    if (std::isnan(val)) {
+        val = 0;
+    }
+    if (val < 0) {
+        *p++ = u'-';
+        val = -val;
+    }
+    precision = std::clamp(precision, 0, MaxPrecision);
 
-    case 1000005: return u"钻石50"_s;
-    case 1000006: return u"钻石100"_s;
+    // the largest power of 1000 not above val. Exact up to 1e21, unlike repeated division
+    size_t unitIdx = 0;
+    double unit = 1;
+    while (unitIdx + 1 < std::size(Units) && val >= unit * 1000) {
+        unit *= 1000;
+        unitIdx++;
+    }
+    double factor = Pow10(precision);
+    double scaled = std::min(std::round(val / unit * factor), MaxScaled);
+    auto digits = static_cast<uint64_t>(scaled);
+    auto divisor = static_cast<uint64_t>(factor);
 
-    case 1800001: return u"科技宝箱"_s;
-    case 3300001: return u"金币宝箱"_s;
+    char16_t intDigits[20];
+    int n = 0;
+    uint64_t intPart = digits / divisor;
+    do {
+        intDigits[n++] = static_cast<char16_t>(u'0' + intPart % 10);
+        intPart /= 10;
+    } while (intPart != 0);
+    while (n > 0) {
+        *p++ = intDigits[--n];
+    }
+    if (precision > 0) {
+        *p++ = u'.';
+        uint64_t frac = digits % divisor;
+        for (int i = precision - 1; i >= 0; i--) {
+            p[i] = static_cast<char16_t>(u'0' + frac % 10);
+            frac /= 10;
+        }
+        p += precision;
+    }
+    for (const char *c = Units[unitIdx]; *c != '\0'; c++) {
+        *p++ = static_cast<char16_t>(*c);
+    }
+    return p - out;
+}
 
-    case 1700011: return u"1级强化部件宝箱"_s;
-    case 1700012: return u"2级强化部件宝箱"_s;
-    case 1700013: return u"3级强化部件宝箱"_s;
+namespace {
 
-    case 1700030: return u"1级强化部件宝箱(新)"_s;
-    case 1700031: return u"2级强化部件宝箱(新)"_s;
-    case 1700032: return u"3级强化部件宝箱(新)"_s;
+struct RqstIdName {
+    int id;
+    std::string_view name;
+};
 
-    case 2100001: return u"普通招募券"_s;
-    case 2100002: return u"高级招募券"_s;
-    case 2100005: return u"精英抽卡券"_s;
+struct ScienceData {
+    int id;
+    int maxLevel;
+    QStringView name;
+};
 
-    case 2300002: return u"紫色万能碎片"_s;
-    case 2300003: return u"橙色万能碎片"_s;
+struct SiteKind {
+    int id;
+    int kind;
+};
 
-    default:
-        return u"item_"_s + QString::number(itemId);
-    }
-}
+/*
+ * Generated from TopwarIdsSnapshot.json:
+ *   RqstIdsById: request and push ids, sorted by id. Where the game uses an id
+ *                for both a request and a push, the name of the request is kept
+ *   RqstIdsByName: indexes into RqstIdsById, sorted by name. A name used by
+ *                  several ids maps to the first one
+ *   ItemNames, AllianceSciences, WorldSiteKinds: sorted by id. The same data as
+ *                  the GameCatalog, used when it is not loaded
+ */
+#include "TopwarIdsData.inc"
 
-std::vector<pair<int, QString>> allianceScienceValue {
-    {0,     u"未知"_s},
+// in the order shown in the UI
+constexpr IdName AllianceScienceNames[] = {
+    {0,     u"未知"},
 
-    {10100, u"联盟规模"_s},
-    {10200, u"勤俭节约"_s},
-    {10300, u"藏富于民"_s},
-    {10500, u"联盟福利"_s},
-    {10600, u"战争火力"_s},
-    {10700, u"家园防御"_s},
-    {10800, u"负重激活"_s},
-    {10900, u"快速作战"_s},
-    {11000, u"联盟内购"_s},
-    {11100, u"重金悬赏"_s},
-    {11200, u"全新荣光"_s},
-    {11300, u"领地扩张"_s},
+    {10100, u"联盟规模"},
+    {10200, u"勤俭节约"},
+    {10300, u"藏富于民"},
+    {10500, u"联盟福利"},
+    {10600, u"战争火力"},
+    {10700, u"家园防御"},
+    {10800, u"负重激活"},
+    {10900, u"快速作战"},
+    {11000, u"联盟内购"},
+    {11100, u"重金悬赏"},
+    {11200, u"全新荣光"},
+    {11300, u"领地扩张"},
 
-    {20100, u"快速征兵"_s},
-    {20200, u"快速维修"_s},
-    {20300, u"超级集结"_s},
-    {21000, u"超级增援"_s},
+    {20100, u"快速征兵"},
+    {20200, u"快速维修"},
+    {20300, u"超级集结"},
+    {21000, u"超级增援"},
 
-    {20400, u"陆军生命"_s},
-    {20500, u"海军生命"_s},
-    {20600, u"空军生命"_s},
-    {20700, u"陆军攻击"_s},
-    {20800, u"海军攻击"_s},
-    {20900, u"空军攻击"_s},
+    {20400, u"陆军生命"},
+    {20500, u"海军生命"},
+    {20600, u"空军生命"},
+    {20700, u"陆军攻击"},
+    {20800, u"海军攻击"},
+    {20900, u"空军攻击"},
 };
 
-const QString& AllianceScience::toString(int scienceId) {
-    for (const auto& [id, name] : allianceScienceValue) {
-        if (static_cast<int>(scienceId) == id) {
-            return name;
+// in the order shown in the UI
+constexpr IdName WorldSiteKindNames[] = {
+    {WorldSite::种类::未知, u"未知"},
+    {WorldSite::种类::资源, u"资源"},
+    {WorldSite::种类::道具, u"道具"},
+    {WorldSite::种类::士兵, u"士兵"},
+    {WorldSite::种类::宝藏, u"宝藏"},
+    {WorldSite::种类::采集, u"采集"},
+    {WorldSite::种类::全军生命, u"全军生命"},
+    {WorldSite::种类::全军攻击, u"全军攻击"},
+    {WorldSite::种类::急速追击, u"急速追击"},
+    {WorldSite::种类::守卫, u"守卫"},
+    {WorldSite::种类::任务, u"任务"},
+    {WorldSite::种类::金币, u"金币"},
+    {WorldSite::种类::交叉火力, u"交叉火力"},
+};
+
+constexpr bool idLess(const IdName &a, const IdName &b) {
+    return a.id < b.id;
+}
+
+// Sorted copy of a small table, made at compile time
+template <size_t N>
+constexpr std::array<IdName, N> sortedById(const IdName (&table)[N]) {
+    std::array<IdName, N> ret{};
+    std::copy(std::begin(table), std::end(table), ret.begin());
+    std::sort(ret.begin(), ret.end(), idLess);
+    return ret;
+}
+
+constexpr auto AllianceSciencesById = sortedById(AllianceScienceNames);
+// indexed by kind
+constexpr auto WorldSiteKindsByKind = sortedById(WorldSiteKindNames);
+
+constexpr bool isDenseFromZero(std::span<const IdName> table) {
+    for (size_t i = 0; i < table.size(); i++) {
+        if (table[i].id != static_cast<int>(i)) {
+            return false;
         }
     }
-    _s = QString::number(static_cast<int>(scienceId));
-    return _s;
+    return true;
 }
 
-const std::vector<pair<int, QString>>& AllianceScience::getValues() {
-    return allianceScienceValue;
-}
+constexpr auto byId = [](const auto &a, const auto &b) { return a.id < b.id; };
 
-int AllianceScience::getMaxLevel(int scienceId) {
-    switch (scienceId) {
-    case 10100: return 7;
-    case 10200: return 10;
-    case 10300: return 14;
-    case 10500: return 5;
-    case 10600:
-    case 10700:
-    case 10800: return 14;
-    case 10900: return 11;
-    case 11000:
-    case 11100: return 10;
+static_assert(std::is_sorted(std::begin(ItemNames), std::end(ItemNames), byId));
+static_assert(std::is_sorted(std::begin(AllianceSciences), std::end(AllianceSciences), byId));
+static_assert(std::is_sorted(std::begin(WorldSiteKinds), std::end(WorldSiteKinds), byId));
+static_assert(isDenseFromZero(WorldSiteKindsByKind));
+static_assert(std::size(RqstIdsByName) <= std::size(RqstIdsById));
+static_assert(std::is_sorted(std::begin(RqstIdsById), std::end(RqstIdsById),
+                             [](const RqstIdName &a, const RqstIdName &b) { return a.id < b.id; }));
+static_assert(std::is_sorted(std::begin(RqstIdsByName), std::end(RqstIdsByName),
+                             [](uint16_t a, uint16_t b) { return RqstIdsById[a].name < RqstIdsById[b].name; }));
+
+template <class Table>
+auto findById(const Table &table, int id) -> decltype(&*std::begin(table)) {
+    auto it = std::lower_bound(std::begin(table), std::end(table), id, [](const auto &e, int id) {
+        return e.id < id;
+    });
+    return it != std::end(table) && it->id == id ? &*it : nullptr;
+}
 
-    case 11200: return 1;
-    case 11300: return 2;
-    case 20100: return 10;
-    case 20200: return 10;
-    case 20300: return 5;
-    case 21000: return 8;
-    case 20400:
-    case 20500:
-    case 20600:
-    case 20700:
-    case 20800:
-    case 20900: return 14;
-    default: return 1;
+// A scan, for the name to id lookups, which are not on hot paths
+template <class Table>
+optional<int> findByName(const Table &table, QStringView name) {
+    for (const auto &e : table) {
+        if (e.name == name) {
+            return e.id;
+        }
     }
+    return {};
 }
 
+// Wraps the static text without copying it
+QString staticString(QStringView s) {
+    return QString::fromRawData(reinterpret_cast<const QChar*>(s.utf16()), s.size());
+}
 
+// The items, sciences and sites are looked up in the catalog once it is loaded,
+// else in the tables built in from the same snapshot
+const GameCatalog* loadedCatalog() {
+    const GameCatalog &catalog = GameCatalog::instance();
+    return catalog.isLoaded() ? &catalog : nullptr;
+}
 
-std::vector<pair<int, QString>> worldSiteKinds {
-    {WorldSite::种类::未知, u"未知"_s},
-    {WorldSite::种类::资源, u"资源"_s},
-    {WorldSite::种类::道具, u"道具"_s},
-    {WorldSite::种类::士兵, u"士兵"_s},
-    {WorldSite::种类::宝藏, u"宝藏"_s},
-    {WorldSite::种类::采集, u"采集"_s},
-    {WorldSite::种类::全军生命, u"全军生命"_s},
-    {WorldSite::种类::全军攻击, u"全军攻击"_s},
-    {WorldSite::种类::急速追击, u"急速追击"_s},
-    {WorldSite::种类::守卫, u"守卫"_s},
-    {WorldSite::种类::任务, u"任务"_s},
-    {WorldSite::种类::金币, u"金币"_s},
-    {WorldSite::种类::交叉火力, u"交叉火力"_s},
-};
+} // END anonymous namespace
 
-int WorldSite::siteToKind(int siteId) {
-    switch (siteId) {
-    case WorldSite::资源1: case WorldSite::资源2:
-        return WorldSite::种类::资源;
-    case WorldSite::道具1: case WorldSite::道具2:
-        return WorldSite::种类::道具;
-    case WorldSite::宝藏1: case WorldSite::宝藏2:
-        return WorldSite::种类::宝藏;
-    case WorldSite::士兵1: case WorldSite::士兵2:
-        return WorldSite::种类::士兵;
-    case WorldSite::采集1: case WorldSite::采集2:
-        return WorldSite::种类::采集;
-    case WorldSite::全军生命1: case WorldSite::全军生命2:
-        return WorldSite::种类::全军生命;
-    case WorldSite::全军攻击1: case WorldSite::全军攻击2:
-        return WorldSite::种类::全军攻击;
-    case WorldSite::急速追击1: case WorldSite::急速追击2:
-        return WorldSite::种类::急速追击;
-    case WorldSite::守卫1: case WorldSite::守卫2:
-        return WorldSite::种类::守卫;
-    case WorldSite::任务1: case WorldSite::任务2:
-        return WorldSite::种类::任务;
-    case WorldSite::金币1: case WorldSite::金币2:
-        return WorldSite::种类::金币;
-    case WorldSite::交叉火力1: case WorldSite::交叉火力2:
-        return WorldSite::种类::交叉火力;
-    default:
-        return WorldSite::种类::未知;
+QString getItemName(int itemId) {
+    if (const GameCatalog *catalog = loadedCatalog()) {
+        if (QStringView name = catalog->itemName(itemId); !name.isEmpty()) {
+            return staticString(name);
+        }
+    } else if (auto e = findById(ItemNames, itemId)) {
+        return staticString(e->name);
+    }
+    return u"item_"_s + QString::number(itemId);
+}
+
+optional<int> itemIdFromName(QStringView name) {
+    if (const GameCatalog *catalog = loadedCatalog()) {
+        return catalog->itemIdFromName(name);
     }
+    return findByName(ItemNames, name);
 }
 
-const QString &WorldSite::kindToString(int kind) {
-    for (const auto& [val, name] : worldSiteKinds) {
-        if (kind == val) {
-            return name;
+QString AllianceScience::toString(int scienceId) {
+    if (const GameCatalog *catalog = loadedCatalog()) {
+        if (QStringView name = catalog->scienceName(scienceId); !name.isEmpty()) {
+            return staticString(name);
         }
+    } else if (auto e = findById(AllianceSciences, scienceId)) {
+        return staticString(e->name);
     }
-    _s = QString{};
-    return _s;
+    // Unknown is only in the UI list
+    if (auto e = findById(AllianceSciencesById, scienceId)) {
+        return staticString(e->name);
+    }
+    return QString::number(scienceId);
 }
 
-const std::vector<pair<int, QString>>& WorldSite::getKinds() {
-    return worldSiteKinds;
+optional<int> AllianceScience::fromString(QStringView name) {
+    const GameCatalog *catalog = loadedCatalog();
+    if (auto id = catalog != nullptr ? catalog->scienceIdFromName(name) : findByName(AllianceSciences, name)) {
+        return id;
+    }
+    return findByName(AllianceScienceNames, name);
 }
 
+std::span<const IdName> AllianceScience::getValues() {
+    return AllianceScienceNames;
+}
 
+int AllianceScience::getMaxLevel(int scienceId) {
+    if (const GameCatalog *catalog = loadedCatalog()) {
+        return catalog->scienceMaxLevel(scienceId).value_or(1);
+    }
+    auto e = findById(AllianceSciences, scienceId);
+    return e != nullptr ? e->maxLevel : 1;
+}
 
-static const std::pair<int, const char*> RqstIdData[] = {
-    {0, "NO_QUEUE_HEART"},
-    {1, "LOGIN"},
-    {82, "LOGIN_OVER"},
-    {83, "User_Action_Time_Mark"},
-    {98, "HEART"},
-    {100, "BUILD_BUILDING"},
-    {101, "BUILD_ORDER"},
-    {102, "GET_ORDER"},
-    {103, "BUILD_STATE_UP"},
-    {104, "BUILD_MOVE"},
-    {120, "CHANGE_POSITION"},
-    {121, "BUY_COIN_FROM_MACHINE"},
-    {117, "UNLOCK_AREA_WAR"},
-    {106, "PRODUCT_SPEEDUP"},
-    {107, "TENURE"},
-    {108, "VISIT"},
-    {110, "ARMY_MOVE"},
-    {111, "DELETE_BUILDING"},
-    {112, "DELETE_ARMY"},
-    {113, "BUILD_REPAIR"},
-    {118, "SPEED_ARMY"},
-    {126, "AUTO_COLLECT_GOLD_LEVEL_UP"},
-    {124, "ORDER_QUEUE_SPEED_UP"},
-    {125, "ARMY_SPEED_ALL"},
-    {143, "ARMY_SPEED_SELECT"},
-    {122, "ORDER_QUEUE_ADD"},
-    {123, "ORDER_QUEUE_ALL_DONE"},
-    {151, "ORDER_QUEUE_ING_DONE"},
-    {127, "NewBuilding_ByItem"},
-    {128, "Get_BuildBoxesData"},
-    {129, "Build_ByBox"},
-    {130, "Build_Box_MERGE"},
-    {131, "Build_In_Box"},
-    {132, "Builds_In_Box"},
-    {182, "Group_Builds_In_Box"},
-    {133, "ErrorBuilds_In_Box"},
-    {134, "GOLD_ORDER_QUEUE_ADD"},
-    {135, "USE_PROP_SPEED_ARMY"},
-    {136, "Build_Box_Resolve"},
-    {203, "ARMY_MERGE"},
-    {206, "ARMY_HEAL"},
-    {207, "ARMY_CANCEL_PRODUCE"},
-    {144, "ARMY_CANCEL_PRODUCE_ALL"},
-    {145, "Treasure_Repair"},
-    {146, "Explode_Vein"},
-    {147, "Treasure_Piece_Repair"},
-    {148, "Treasure_Piece_Log_Get"},
-    {149, "Treasure_Piece_Log_Delete"},
-    {150, "Get_Home_Building_Reward"},
-    {209, "INSTALL_ARMY_EQUIP"},
-    {210, "TAKEOFF_ARMY_EQUIP"},
-    {211, "COMPOSE_ARMY_EQUIP"},
-    {213, "UNLOCK_ARMY_EQUIP_POS"},
-    {227, "CHANGE_ARMY_EQUIP_GROUP"},
-    {228, "GET_ARMY_EQUIP_GROUP"},
-    {214, "LEVEL_UP_INIT_ARMY_EQUIP"},
-    {215, "IMM_LEVEL_UP_INIT_ARMY_EQUIP"},
-    {216, "ARMY_FIX_INBOX"},
-    {116, "BUILDING_MERGE"},
-    {205, "ARMY_BATCH_MERGE"},
-    {119, "BUILDING_BATCH_MERGE"},
-    {301, "QUEST_COMPLETE"},
-    {302, "DAILY_QUEST_REFRESH"},
-    {303, "GET_DAILY_QUEST_REWARD"},
-    {304, "GET_DAILY_QUEST_BOX_REWARD"},
-    {305, "FAST_FINISH_DAILY_QUEST"},
-    {306, "GET_WORLD_TREASURE_QUEST"},
-    {307, "REFRESH_WORLD_TREASURE_QUEST"},
-    {308, "RECEIVE_WORLD_TREASURE_QUEST"},
-    {309, "Chapter_Task_Complete"},
-    {310, "Chapter_Task_Donate"},
-    {311, "Chapter_Complete"},
-    {312, "GET_QUEST_DATA"},
-    {601, "ShareId"},
-    {602, "PublicAddressReweard"},
-    {603, "FavWxReweard"},
-    {701, "SendPayToServer"},
-    {702, "DEV_SendPayToServer"},
-    {705, "CRYSTAL_SendPayToServer"},
-    {703, "GetG123PayInfo"},
-    {706, "SendPayToServer_toutiao"},
-    {707, "CashCouponPay"},
-    {708, "RequestPayServer_wanba"},
-    {2016, "RequestPayServer_wxios"},
-    {711, "SendPayToServer_ios"},
-    {712, "SendPayToServer_google"},
-    {2018, "SendPayToServer_googleplaypoint"},
-    {713, "RequestPayServer_oppo"},
-    {714, "RequestPayServer_vivo"},
-    {718, "RequestPayServer_huawei"},
-    {715, "SendPayToServer_ios_v1"},
-    {716, "SendPayToServer_googleplay_v1"},
-    {717, "CheckConsumedOrders_googleplay"},
-    {721, "SendPayToServer_huaweiglobal"},
-    {721, "SendPayToServer_huaweiglobal_v1"},
-    {1500, "SYNC_APPWX_PLAYER_INFO"},
-    {1501, "SYNC_APPQQ_PLAYER_INFO"},
-    {1505, "SYNC_APPFB_PLAYER_INFO"},
-    {2017, "PLAYER_PAY_USD_DOLLAR"},
-    {1512, "Fix_GP_Account"},
-    {800, "VideoRewardCommon"},
-    {801, "BuyEnergry"},
-    {802, "UpdatePlayerInfo"},
-    {803, "GetSignReward"},
-    {815, "ITEM_USE"},
-    {812, "ITEM_DELETE"},
-    {817, "Item_Compose"},
-    {816, "Science_LevelUp"},
-    {204, "ARMY_HELP"},
-    {221, "ARMY_HELP_ALL"},
-    {222, "Get_Assistance_Data"},
-    {869, "BindUserAccount"},
-    {1510, "UnBindUserSNS"},
-    {1511, "BindUserSNS"},
-    {2024, "IG_ACCOUNT"},
-    {1513, "BindSNSInfo"},
-    {1514, "SwitchAccountSNS"},
-    {1515, "UnBindSNSNEW"},
-    {1517, "GET_AIHELP_UNREAD"},
-    {1518, "RESET_AIHELP_UNREAD"},
-    {1651, "GET_DOWNLOAD_GIFT"},
-    {870, "LimitedShopRefresh"},
-    {871, "Limit_Shop_Buy"},
-    {872, "BindAccountReward"},
-    {1516, "G123BindAccountReward"},
-    {1394, "PlatformActivityState"},
-    {819, "FreeCoinShare"},
-    {820, "FreeCoinReward"},
-    {823, "ShareDoubleArmy"},
-    {824, "ShareRewardBoxReceive"},
-    {825, "GetTimeReward"},
-    {828, "SetMaxItem"},
-    {831, "ShareScience"},
-    {840, "PromotionOP"},
-    {834, "VideoRewardGet"},
-    {804, "ClickSharebox"},
-    {805, "GetShareBoxReward"},
-    {1739, "GetShipRewardByCoolDown"},
-    {1738, "StartShipRewardByCoolDown"},
-    {806, "ShareBoxs"},
-    {807, "RENDUOLILIANGDA"},
-    {808, "DailyQuests"},
-    {809, "RefreshDailyQuests"},
-    {810, "GetDailyTaskReward"},
-    {811, "SpeedDailyTask"},
-    {812, "GetDailyTaskBoxReward"},
-    {813, "DelFriendPowerItem"},
-    {501, "AddFriend"},
-    {502, "DelFriend"},
-    {506, "ReplayAllFriending"},
-    {507, "SendCrystalToFriend"},
-    {503, "AddFriending"},
-    {505, "ReplyFriending"},
-    {508, "GetCrossFriend"},
-    {818, "GoldBuyItem"},
-    {821, "GoldGetWelcomeReward"},
-    {822, "VIDEO_GET_GOLD"},
-    {751, "GROWTH_FUND_GET_REWARD"},
-    {109, "RemoveHomeObstaclePoint"},
-    {200, "ARMY_UNLOCK"},
-    {201, "ARMY_LEVELUP"},
-    {202, "ARMY_PUT"},
-    {400, "STARTADVENTURE"},
-    {401, "ADVENTURECLICK"},
-    {414, "STARTA_PVE_OBSTACLE"},
-    {415, "STARTA_PVE_OBSTACLE_ATTACK"},
-    {420, "NBATTLE_START_PVE_OBSTACLE"},
-    {421, "NBATTLE_START_PVE_JELLY"},
-    {416, "WORLDMAP_SCOUT"},
-    {417, "WORLDMAP_SUPER_SCOUT"},
-    {405, "BattleReward"},
-    {300, "ADVENTURE"},
-    {814, "SaveGuideStep"},
-    {670, "PostChatMsg"},
-    {675, "RequestPrivateChat"},
-    {676, "RequestPrivateUsers"},
-    {677, "DeletePrivateUser"},
-    {678, "ReadChatInfo"},
-    {679, "ChatReport"},
-    {940, "ChatGroupCreat"},
-    {941, "ChatGroupExit"},
-    {942, "ChatGroupSettingChange"},
-    {943, "ChatGroupInvite"},
-    {944, "ChatGroupGetList"},
-    {945, "ChatGroupRead"},
-    {947, "ChatGroupDelteSomeOne"},
-    {948, "ChatGroupCollect"},
-    {946, "ChatGroupGetInviteList"},
-    {1395, "ChatReportNew"},
-    {696, "HeadIconReport"},
-    {691, "SyncAppPushToken"},
-    {693, "SyncPushSwitch"},
-    {1392, "SyncNotifySwitch"},
-    {1607, "GetEmotionList"},
-    {1611, "GetServerAvatar"},
-    {901, "GET_WORLD_INFO"},
-    {902, "MARCH_WORLD_POINT"},
-    {903, "CHOOSE_WORLD_AREA"},
-    {904, "RECALL_MARCH"},
-    {1000, "LEAVE_WORLDMAP"},
-    {1001, "GET_TERRITORY_INFO"},
-    {1002, "GET_OWNER_TERRITORY_INFO"},
-    {905, "GET_MARCH_TIME"},
-    {906, "WORLD_SEARCH_MONSTER"},
-    {907, "WORLD_DESSTORYED_CONFIRM"},
-    {908, "WORLD_GETPLAYER_INFO"},
-    {909, "GET_PLAYER_POINT"},
-    {910, "PeaceShieldHandler"},
-    {911, "MOVE_CITY_POSITION"},
-    {912, "GET_MARCH_INFO"},
-    {916, "GET_MYWORLDCITY_SHIELD"},
-    {1026, "GET_JION_ALL_RCTIME"},
-    {650, "POWER_RANK"},
-    {651, "ALLIANCE_POWER_RANK"},
-    {652, "GET_WORLD_RANK"},
-    {630, "PLAYER_INFO"},
-    {640, "SendFBAppRequestId"},
-    {641, "GetFBAppRequestReward"},
-    {700, "GET_SERVER_EXCHANGE"},
-    {709, "GET_SERVER_ORDERED_EXCHANGE"},
-    {750, "GET_TIMECARD_REWARD"},
-    {757, "GET_CUSTOMCARD_REWARD"},
-    {829, "SET_SHARE_TIMES"},
-    {830, "GET_SHARE_TIMES"},
-    {832, "CHANGE_PROVINCE"},
-    {835, "CHANGE_NICK_NAME"},
-    {851, "CHANGE_USER_GENDER"},
-    {1304, "CHANGE_AVATAR"},
-    {838, "NOTICE_REGIST"},
-    {841, "GET_ACTIVITY_DATA"},
-    {842, "GET_ACTIVITY_REWARD"},
-    {843, "GET_ACTIVITY_RANK"},
-    {839, "GET_ACTIVITY_ALLSEVER_RANK"},
-    {844, "GET_ACTIVITY_REWARD_RANK"},
-    {845, "ACTIVITY_VALENTINE_GIVE"},
-    {846, "GET_SHAREBOX_ACTIVITY_REWARD"},
-    {860, "GET_CONVERT_REWARD"},
-    {847, "GET_USER_SERVERLIST"},
-    {848, "CHANGE_SERVER"},
-    {849, "RECALL_ACT_REWARD"},
-    {850, "ACTIVITY_KING_BOX_REWARD"},
-    {854, "GET_MY_CASTLE_FACE"},
-    {855, "USE_CASTLE_FACE"},
-    {856, "GET_ALL_MY_MARCH_INFO"},
-    {857, "CHARACTER_DELETE"},
-    {1343, "CASTLE_COLLECT_REWARD"},
-    {1344, "CHANGE_NATIONAL_FLAG"},
-    {836, "GET_ShakeMoneyTreeData"},
-    {837, "ShakeMoneyTreeData"},
-    {913, "FAVORITE_ADD"},
-    {914, "FAVORITE_DELETE"},
-    {915, "FAVORITE_GET_LIST"},
-    {917, "getBossInfo"},
-    {918, "GET_WORLD_BOSS_RANK"},
-    {919, "GET_BOSS_ATTACK_INFO"},
-    {920, "MARCH_SPEED_UP"},
-    {921, "MAIL_GET_LIST"},
-    {922, "MAIL_DROP"},
-    {923, "MAIL_FAVORITE"},
-    {924, "MAIL_READ"},
-    {925, "MAIL_SEND"},
-    {926, "MAIL_GETREWARD"},
-    {927, "MAIL_GETREPORT"},
-    {928, "MAIL_UNREAD"},
-    {929, "MAIL_QUERY"},
-    {932, "MAIL_CONTINUE_ATTACK"},
-    {933, "MAIL_nGetGroupList"},
-    {934, "MAIL_nUnreadCount"},
-    {935, "MAIL_nGetNewMails"},
-    {936, "Mail_nReadedAllMails"},
-    {937, "Mail_nDeleteShowTypeAll"},
-    {938, "MAIL_nUnreadCount_Now"},
-    {939, "MAIL_nRewardCount_Now"},
-    {930, "GET_GAME_NOTICE"},
-    {931, "VOTE_GAME_NOTICE"},
-    {2000, "GET_FAQ"},
-    {2011, "GET_FORUM_TOKEN"},
-    {2001, "VOTE_FAQ"},
-    {2002, "GET_VIP_DAY_REWARD"},
-    {960, "QUERY_RANK_CHALLENGE_INFO"},
-    {961, "QUERY_ARMY_RANK_LIST"},
-    {962, "ARMY_RANK_FLUSH"},
-    {963, "ARMY_RANK_CHALLENGE"},
-    {964, "ARMY_RANK_PRIZE"},
-    {965, "ARMY_RANK_BUY_CHALLENGE_NUM"},
-    {966, "MILITARY_BATTLE_HISTORY"},
-    {950, "ALLIANCE_GET_STATES"},
-    {951, "ALLIANCE_GET_DETAIL"},
-    {952, "ALLIANCE_GET_ROLES"},
-    {953, "ALLIANCE_PVP"},
-    {954, "ALLIANCE_CHANGE_COLOR"},
-    {955, "ALLIANCE_CHANGE_NOTICE"},
-    {956, "ALLIANCE_BUF_GET_GOLD"},
-    {957, "ALLIANCE_GET_PLAYERINFO"},
-    {1003, "ALLIANCE_GET_ALL_COORDS"},
-    {1004, "GET_WORLD_SITE_DATA"},
-    {1005, "GET_WORLD_POINT_MARCH"},
-    {1006, "WORLD_SITE_GIVEUP"},
-    {1007, "WORLD_SITE_CHANGENAME"},
-    {1008, "THRONE_GET_INFO"},
-    {1009, "THRONE_GET_OFFICIAL_LIST"},
-    {1010, "THRONE_CHANGE_PLAYER_OFFICIAL"},
-    {1011, "THRONE_GET_MANAGE_INFO"},
-    {1012, "THRONE_CHANGE_SERVER_NAME"},
-    {1013, "THRONE_CHANGE_NOTICE"},
-    {1014, "THRONE_BUY_BUFF"},
-    {1015, "THRONE_RECRUIT_BUFF"},
-    {1016, "THRONE_GIVE_GIFT"},
-    {1017, "THRONE_POWER_RANK"},
-    {1018, "THRONE_GIFT_DATA"},
-    {1019, "THRONE_HISTORY_DATA"},
-    {1020, "THRONE_KING_GIFT"},
-    {1064, "THRONE_REPORT_DATA"},
-    {1065, "WORLDSITE_RANK_DATA"},
-    {1066, "WORLDSITE_REPORT_DATA"},
-    {1067, "WORLDSITE_DONATE"},
-    {1068, "WORLDSITE_UPGRADE"},
-    {1024, "GET_AIRDROP_INFO"},
-    {1022, "INTERCEPT_AIRDROP_MARCH"},
-    {1023, "PRE_INTERCEPT_AIRDROP_MARCH"},
-    {1025, "WORLD_SEARCH_RALLYBOSS"},
-    {1084, "GET_WORLD_THRONE_DATA"},
-    {1085, "GET_CAMP_MARCH_INFO"},
-    {1100, "ALLIANCE_CREATE"},
-    {1101, "ALLIANCE_DISSOLUTION"},
-    {1102, "ALLIANCE_CHECK_NAME_CANUSE"},
-    {1103, "ALLIANCE_CHECK_TAG_CANUSE"},
-    {1104, "ALLIANCE_CHANGE_INFO"},
-    {1110, "ALLIANCE_REVISE_NOTICE"},
-    {1111, "ALLIANCE_CHANGE_MANIFESTO"},
-    {1112, "ALLIANCE_GET_APPLYLIST"},
-    {1114, "ALLIANCE_APPLY"},
-    {1115, "ALLIANCE_CANCEL_APPLY"},
-    {1116, "ALLIANCE_AGREE_APPLY"},
-    {1117, "ALLIANCE_REFUSE_APPLY"},
-    {1118, "ALLIANCE_GET_INVITE_LIST"},
-    {1123, "ALLIANCE_GET_MEMBER_RANK_LIST"},
-    {1125, "ALLIANCE_GET_MEMBER_POS"},
-    {1126, "ALLIANCE_CHANGE_MEMBER_RANK"},
-    {1127, "ALLIANCE_KICK_MEMBER"},
-    {1128, "ALLIANCE_EXIT"},
-    {1129, "ALLIANCE_CHANGE_LEADER"},
-    {1130, "ALLIANCE_RECALL_LEADER"},
-    {1131, "ALLIANCE_GET_INFO"},
-    {1132, "ALLIANCE_GET_MEMBER_LIST"},
-    {1133, "ALLIANCE_SEARCH"},
-    {1134, "ALLIANCE_GET_RECOMMEND_LIST"},
-    {1137, "ALLIANCE_GET_RECOMMEND"},
-    {1143, "ALLIANCE_GET_SCIENCE"},
-    {1144, "ALLIANCE_DOANTE_SCIENCE"},
-    {1145, "ALLIANCE_UPLEVEL_SCIENCE"},
-    {1146, "ALLIANCE_UPLEVEL_DONE"},
-    {1147, "ALLIANCE_RECOMMEND"},
-    {1148, "ALLIANCE_SCIENCE_INFO"},
-    {1149, "ALLIANCE_SHOP"},
-    {1150, "ALLIANCE_BUYSHOP"},
-    {1151, "ALLIANCE_SHOP_STATUE"},
-    {1152, "ALLIANCE_RECEIVE_FAKE_GIFT"},
-    {1194, "ALLIANCE_RECEIVE_NEW_FAKE_GIFT"},
-    {1153, "ALLIANCE_SEND_TO_ALL_MAIL"},
-    {1154, "ALLIANCE_GET_TERRITORY"},
-    {1155, "ALLIANCE_CREATE_TERRITORY"},
-    {1156, "ALLIANCE_GET_A_BUILDING_INFO"},
-    {1157, "ALLIANCE_REMOVE_A_BUILDING"},
-    {1158, "ALLIANCE_GET_A_BUILDING_INFO_SIMPLE"},
-    {1159, "ALLIANCE_BUILDING_DONATE"},
-    {1138, "ALLIANCE_GET_HELPLIST"},
-    {1139, "ALLIANCE_HELP_APPLY"},
-    {1140, "ALLIANCE_HELP_MEMBER"},
-    {1141, "ALLIANCE_HELP_RECEIVE"},
-    {1164, "ALLIANCE_MOVE_INVITE"},
-    {1179, "ALLIANCE_MOVE_INVITEALL"},
-    {1165, "ALLIANCE_MOVE_ACCEPT"},
-    {1180, "ALLIANCE_MOVE_REFUSE"},
-    {1181, "ALLIANCE_AUTO_ASSEMLBY_SET"},
-    {1182, "ALLIANCE_AUTO_ASSEMLBY_GET"},
-    {1183, "ALLIANCE_HELP_CANCLE"},
-    {1188, "ALLIANCE_RANDOM_KEY"},
-    {1142, "ALLIANCE_MEMBER_DYNAMIC"},
-    {671, "CHAT_CONNECT"},
-    {669, "CHAT_ALLIANCE_CHANGE"},
-    {672, "CHAT_SET_DING"},
-    {1200, "ALLIANCE_Assemblys"},
-    {1201, "ALLIANCE_Assembly_Create"},
-    {1202, "ALLIANCE_Assembly_Cancel"},
-    {1203, "ALLIANCE_Assembly_Repatriation"},
-    {1204, "ALLIANCE_Assembly_Join"},
-    {1205, "ALLIANCE_Defend"},
-    {1207, "ALLIANCE_Assistances"},
-    {1208, "ALLIANCE_BACKAssistance"},
-    {1209, "ALLIANCE_AssistanceRecored"},
-    {1210, "ALLIANCE_AssemblyBattleRecored"},
-    {1160, "ALLIANCE_BOSS_GET_INFO"},
-    {1161, "ALLIANCE_BOSS_DONATE"},
-    {1162, "ALLIANCE_BOSS_SET"},
-    {1163, "ALLIANCE_BOSS_CD"},
-    {853, "SHOP_GET_DATA"},
-    {861, "HERO_GET_DATA"},
-    {862, "HERO_RECRUIT"},
-    {863, "HERO_USE_EXP_ITEMS"},
-    {864, "HERO_COMPOSE"},
-    {865, "HERO_STAR_RISE"},
-    {866, "HERO_CONVERT_PATCH"},
-    {1341, "HERO_USE_SKILL"},
-    {1342, "HERO_CANCEL_SKILL"},
-    {1767, "HERO_USE_ACTIVE_SKILL"},
-    {611, "EVERYDAYREWARD_GET_DATA"},
-    {613, "EVERYDAYREWARD_GET_REWARD"},
-    {867, "CASINO_QUERY"},
-    {868, "CASINO_GET_REWARD"},
-    {752, "FIRST_CHARGE_GET"},
-    {137, "GET_WAREHOUSE_INFO"},
-    {138, "ADD_WAREHOUSE_LATTICE"},
-    {139, "WAREHOUSE_DELETE_ARMYS"},
-    {140, "WAREHOUSE_MOVE_ARMYS_OUT"},
-    {141, "Building_Exchange"},
-    {217, "ARMY_STORE"},
-    {218, "ARMY_WAREHOUSE_MERGE"},
-    {219, "ARMY_WAREHOUSE_BATCH_MERGE"},
-    {220, "ARMY_HEAL_LIST"},
-    {224, "ARMY_OUT_WAREHOUSE_BATCH_MERGE"},
-    {225, "POWERITEM_COMPOSE_ALL"},
-    {231, "POWERITEM_COMPOSE_GROUPS"},
-    {142, "DECORATION_COMPOSE_ALL"},
-    {226, "ARMY_STORE_SINGLE"},
-    {875, "START_MINE"},
-    {876, "AWARD_MINE"},
-    {4105, "GET_MINE_EXCHANGE_NUM"},
-    {4158, "SetHallucinationSkin"},
-    {877, "BUILD_IN_MINE"},
-    {1169, "CancelAllianceExchangeHandler"},
-    {1168, "HelpAllianceExchangeHandler"},
-    {1166, "TransferToTerritory"},
-    {1167, "RequestAllianceExchangeHandler"},
-    {1170, "GetAllianceExchangesByTypeHandlerNew"},
-    {1171, "Get_Alliance_Chat_Reward_List"},
-    {1172, "Receive_Alliance_Chat_Reward"},
-    {1173, "Get_Alliance_Star_Task"},
-    {1174, "Get_Alliance_Star_Task_Reward"},
-    {1175, "GET_ALLIANCE_GIFTS"},
-    {1176, "Receive_Alliance_Gift_Small"},
-    {1177, "Receive_Alliance_Gift_Small_All"},
-    {1178, "Receive_Alliance_Gift_Big"},
-    {1754, "EliteScore_GET_REWARD"},
-    {694, "GetShareActId"},
-    {878, "PatchSynthesisSkin"},
-    {1408, "PatchSynthesisArmyLineSkin"},
-    {1021, "GetRefugee"},
-    {879, "PUZZLE_ACTIVITY_REWARD"},
-    {881, "GET_MY_CASTLE_NAMEPLATE"},
-    {882, "USE_CASTLE_NAMEPLATE"},
-    {614, "Activity_FRIEND_DETAIL"},
-    {896, "CONVERT_HERO_SKILL_BOX"},
-    {431, "GET_ISLAND_DATA"},
-    {437, "GET_ISLAND_BUY_ITEM"},
-    {446, "GET_ISLE_DATA"},
-    {447, "ISLE_EMBATTLE"},
-    {448, "ISLE_CHANLLEGE"},
-    {449, "ISLE_RESET"},
-    {450, "ISLE_BATTLE_LOG_GET"},
-    {451, "DEGENERATOR_INFO"},
-    {452, "DEGENERATOR_SEARCH"},
-    {453, "DEGENERATOR_FIGHT"},
-    {454, "DEGENERATOR_GET_MAIL"},
-    {455, "DEGENERATOR_REWARD"},
-    {456, "DEGENERATOR_REFRESH"},
-    {457, "DEGENERATOR_DELETE_MAILS"},
-    {458, "DEGENERATOR_READ_MAILS"},
-    {897, "STUDY_HERO_SKILL"},
-    {898, "FORGET_HERO_SKILL"},
-    {885, "LEVEL_UP_INSTALLED_HERO_SKILL"},
-    {886, "DECOMPOSE_HERO_SKILL"},
-    {887, "UNLOCK_HERO_TALENT_SLOT"},
-    {888, "UNDERSTAND_HERO_TALENT"},
-    {889, "RANDOM_HERO_TALENT"},
-    {894, "REPLACE_HERO_TALENT"},
-    {895, "LEVEL_UP_UNINSTALLED_HERO_SKILL"},
-    {899, "HERO_SKIN_CHANGE"},
-    {1740, "GET_HERO_BOND_INFO"},
-    {1741, "ACTIVATE_HERO_BOND_ATTRIBUTE"},
-    {755, "ACTIVITY_REVERSECARD"},
-    {753, "ACTIVITY_REVERSECARD_RESET"},
-    {754, "ACTIVITY_REVERSECARD_BUY"},
-    {756, "ACTIVITY_REVERSECARD_DATA"},
-    {3105, "ACTIVITY_REVERSECARD_NEW"},
-    {3106, "ACTIVITY_REVERSECARD_NEW_BUY"},
-    {3107, "ACTIVITY_REVERSECARD_NEW_RESET"},
-    {858, "GET_MY_ARMYLINE_FACE"},
-    {859, "USE_ARMYLINE_FACE"},
-    {883, "GET_MY_HEADFRAMES"},
-    {884, "USE_MY_HEADFRAME"},
-    {1300, "SUMMER_ACT_AWARD"},
-    {1301, "AWARD_GROW_ROAD_TASK"},
-    {1302, "AWARD_GROW_ROAD_STAGE"},
-    {1303, "AWARD_GROW_ROAD_ALL_STAGES"},
-    {1503, "WANBA_REWARD"},
-    {1504, "WANBA_REWARD_STATUS"},
-    {1400, "CROSS_SERVER"},
-    {1402, "GET_ONE_DARK_PORTAL_DATA"},
-    {1405, "GET_CROSS_SERVER_POINT_REWARD"},
-    {1406, "Receive_CROSS_SERVER_POINT_REWARD"},
-    {1407, "GET_CROSS_SERVER_KILL_RANK"},
-    {1422, "KING_CHOOSE_DST_FIGHT_ZONE"},
-    {1423, "GET_CROSS_SERVER_FIGHT_ZONE_INFO"},
-    {874, "SET_CHAT_BLOCK"},
-    {880, "SAVE_DEFENSE_TROOPS"},
-    {873, "GET_APP_BIND_STATS"},
-    {223, "MOVE_ARMY_OUT_WAREHOUSE"},
-    {1403, "ASK_DEFEND_ARMY"},
-    {1027, "SEARCH_HAMMER_BOSS"},
-    {1028, "MARCH_ARMY_DETAIL"},
-    {1029, "SEARCH_HAMMER_BOSS_MAXLEVEL"},
-    {1040, "GET_COUNTRY_BOSS_TASK_DATA"},
-    {1041, "GET_COUNTRY_BOSS_TASK_LINE_REWARD"},
-    {1042, "GET_COUNTRY_BOSS_TASK_REWARD"},
-    {1043, "GET_COUNTRY_BOSS_RANK"},
-    {1044, "GET_COUNTRY_BOSS_DAMAGE_REWARD"},
-    {1045, "COUNTTRY_BOSS_SUMMON"},
-    {1050, "GET_VOTE_TIME_DATA"},
-    {1051, "USER_VOTE_TIME"},
-    {1052, "KING_VOTE_TIME"},
-    {1308, "ACTIVITY_DRAW_CARD"},
-    {1309, "ACTIVITY_DRAW_CARD_RANK"},
-    {1305, "GET_ACTIVITY_SUMMER_LOTTERY_INFO"},
-    {1306, "GET_ACTIVITY_SUMMER_LOTTERY_REWARD"},
-    {1429, "SEND_REAL_NAME_INFO"},
-    {1440, "SEND_VIETNAM_REAL_NAME_INFO"},
-    {1441, "GET_GROUP_CROSS_VOTE"},
-    {1442, "GROUP_CROSS_VOTE"},
-    {1443, "GROUP_CROSS_VOTE_MANIFESTO"},
-    {1444, "GROUP_CROSS_GET_REWARD"},
-    {4001, "GET_OPC_STATE"},
-    {4011, "GET_VERIFICATION_CODE"},
-    {4012, "GET_VERIFICATION_MAIL_CODE"},
-    {4003, "CHECK_VERIFICATION_CODE"},
-    {4005, "CHECK_VERIFICATION_MAIL_CODE"},
-    {4006, "OPCENTER_GET_REWARD"},
-    {4007, "OPCENTER_GET_FORUM_REWARD"},
-    {1310, "DIRECT_REPLACE_HERO_TALENT"},
-    {1311, "ACTIVITY_KILL_RALLYBOSS_INFO"},
-    {1118, "AllianceMemberInviteGetData"},
-    {1119, "AllianceMemberInviteAction"},
-    {1121, "AllianceMemberInviteAgree"},
-    {1122, "AllianceMemberInviteDelete"},
-    {1319, "CHOICE_PROFESSION"},
-    {1318, "GET_LEARN_TALENT_DATA"},
-    {1314, "PROFESSION_LEARN_TALENT"},
-    {1316, "PROFESSION_SPEED_LEARN"},
-    {1315, "RESET_PROFESSION_TALENT"},
-    {1317, "CHANGE_PROFESSION"},
-    {1312, "ACTIVITY_BUY_SCORE_SHOP_ITEM"},
-    {699, "ACTIVITY_BUY_SCORE_GIFT_CHECK"},
-    {1313, "ACTIVITY_BUY_SCORE_GIFT_INFO"},
-    {4691, "ACTIVITY_SHOP_JP_BUY_ITEM"},
-    {3151, "ACTIVITY_RECFARGE_BENEFIT_GET_REWARD"},
-    {4695, "MAHUA_CITYSKIN_UPGRADE_FREE_GET"},
-    {1323, "ACTIVITY_LUCKY_DRAW_CARD_INFO"},
-    {1324, "ACTIVITY_LUCKY_DRAW_CARD_ACT"},
-    {1409, "ACTIVITY_RECHARGE_SCORE_SHOP_INFO"},
-    {1410, "ACTIVITY_RECHARGE_SCORE_SHOP_GET_REWARD"},
-    {1411, "GET_CROSS_SERVER_BATTLE_RECORD"},
-    {1412, "GET_SERVER_SCORE_RANK_DATA"},
-    {1413, "GET_CROSS_SERVER_EVENT_LOG"},
-    {1414, "GET_CROSS_SERVER_OPPONENT_ID"},
-    {1327, "ACTIVITY_RECHARGE_SCORE_SPIN_INFO"},
-    {1328, "ACTIVITY_RECHARGE_SCORE_SPIN_LOTTER"},
-    {1329, "ACTIVITY_RECHARGE_SCORE_SPIN_GET_REWARD"},
-    {1721, "HERO_SPIN_INFO"},
-    {1722, "HERO_SPIN_LOTTER"},
-    {1723, "HERO_SPIN_GET_REWARD"},
-    {1321, "SAVE_DEFENSE_HIGH_SET"},
-    {1322, "AWARD_ONCE"},
-    {2009, "AWARD_COUNT"},
-    {1325, "SWAP_HERO_TALENT"},
-    {1330, "GET_SHIELD_LOG"},
-    {790, "PAY_PRE_FLOW"},
-    {791, "GET_BUY_EXCHANGE_NUM"},
-    {1031, "GET_TOWER_LIST"},
-    {1032, "TOWER_REMOVE"},
-    {1033, "MARCH_WORLD_Build"},
-    {1034, "GET_TOWERINFO"},
-    {1035, "TOWER_COLLECT"},
-    {1036, "GET_THRONE_BATTLE_VOTE_DATA"},
-    {1037, "TRHONE_BATTLE_TIME_VOTE"},
-    {1038, "TRHONE_BATTLE_TIME_SELECT"},
-    {1061, "RegisterSystemPush"},
-    {1062, "UnregisterSystemPush"},
-    {852, "superReward"},
-    {900, "OCTOBER_RECORD"},
-    {1326, "NOBACK_LOTTERY"},
-    {1331, "FLOWER_LOG"},
-    {1336, "GET_WORLD_TREASURE"},
-    {1534, "DELETE_ACCOUNT_CHECK"},
-    {1532, "SUBMIT_DELETE_ACCOUNT"},
-    {1535, "CANCEL_DELETE_ACCOUNT"},
-    {1536, "CONFIRM_DELETE_ACCOUNT"},
-    {1533, "GET_DELETE_ROLE_LIST"},
-    {1537, "GET_UP_PIC_TOKEN"},
-    {1335, "UploadUserHeadImage"},
-    {1320, "PERSONAL_MONSTER_SIEGE_START"},
-    {1332, "GET_CASTLE_EFFECT_ITEM"},
-    {1333, "GET_MY_CASTLE_EFFECT"},
-    {1334, "USE_CASTLE_EFFECT"},
-    {1350, "SIGNUP_AL_MONSTER_SIEGE"},
-    {1351, "REPAIR_ALLIANCE_FORTRESS"},
-    {1352, "WEAK_AL_SIEGE_MONSTER"},
-    {1338, "THANKSGIVING_GETREWARD"},
-    {1337, "COMPOSE_ITEM"},
-    {5021, "MERGE_ITEM"},
-    {1361, "MILITARY_UP"},
-    {1362, "QUEST_GET"},
-    {1363, "QUEST_WorldPoint_get"},
-    {1339, "FIND_MOD"},
-    {1415, "GET_SIXTEEN_FIGHT"},
-    {1416, "GET_SIXTEEN_BET_INFO"},
-    {1417, "BET_SIXTEEN"},
-    {1360, "WORLDBATTLE_SHOP_BUY_ITEM"},
-    {1418, "CANCEL_BET_SIXTEEN"},
-    {1364, "BOUNTY_SHOP_BUY_ITEM"},
-    {1340, "RealNameReward"},
-    {1345, "ChangeHeroSkillsIndex"},
-    {1346, "SavePreMarch"},
-    {695, "USE_CDK_CODE"},
-    {1373, "GIFTBOX_DRAW"},
-    {1374, "GIFTBOX_NEXT"},
-    {1375, "GIFTBOX_GETPACKAGE"},
-    {1370, "ACTIVITY_MINE_DIG"},
-    {1371, "ACTIVITY_MINE_RESOLEVE"},
-    {1372, "ACTIVITY_MINE_CONVERT"},
-    {1393, "ACTIVITY_HUNT_DIG"},
-    {1376, "ACTIVITY_DICE_ROLL"},
-    {1377, "ACTIVITY_GET_DICE_REWARD"},
-    {1378, "ACTIVITY_DICE_RECORD"},
-    {1379, "Get_Treasure_Theme_Data"},
-    {1419, "RndTaskRefresh"},
-    {1365, "NEWYEAR_GETREWARD"},
-    {1420, "CrossServerFightKillRank"},
-    {1368, "LuckBagRequest"},
-    {1369, "ActivityJanuaryGiftSign"},
-    {1347, "ActivityCalendarGetData"},
-    {2003, "ActivityCalendarReadData"},
-    {1424, "CrossServerBattleInfo"},
-    {1366, "ActivitySocialReweard"},
-    {1367, "Evaluate_MOD"},
-    {1380, "getConsignList"},
-    {1381, "getSingleItemConsignList"},
-    {1621, "getSingleItemConsignBuyList"},
-    {1382, "consignmentSomeItem"},
-    {1622, "consignmentBuySomeItem"},
-    {1383, "consignmentBuy"},
-    {1623, "consignmenSell"},
-    {1384, "consignmentMyGoods"},
-    {1385, "consignmentRecord"},
-    {1386, "consignmentSoldOut"},
-    {1624, "consignmentBuySoldOut"},
-    {1387, "getStrengthenMakingData"},
-    {1388, "MAKE_FORMULA"},
-    {1389, "SPEED_UP_FORMULA"},
-    {1390, "CANCEL_FORMULA"},
-    {1391, "EQUIP_OR_REMOVE_DEF_TRAPS"},
-    {1398, "ProductionListGet"},
-    {1399, "ProductionStart"},
-    {1600, "ProductionComplete"},
-    {1396, "ProductionCancle"},
-    {1397, "ProductionReward"},
-    {1612, "ProductionBatch"},
-    {1613, "SaveMergeGameData"},
-    {1614, "GetMergeGameData"},
-    {1615, "MergeGameTaskComplete"},
-    {1608, "ActivityEaster_GetBall"},
-    {1609, "ActivityEaster_GetReward"},
-    {1630, "Get_Adventure_Data"},
-    {1631, "Adventure_Start"},
-    {1632, "Adventure_Hero_Save"},
-    {1633, "Adventure_Reward"},
-    {1634, "Adventure_Sweep_Reward"},
-    {1635, "Adventure_Boss_Attack"},
-    {1636, "Adventure_Total_Rank"},
-    {1637, "Adventure_Last_Win_Team"},
-    {1638, "Update_Activity_Info_By_Type"},
-    {1639, "Adventure_Shop_Item_Buy"},
-    {1640, "Adventure_GET_HALL_TASKS"},
-    {1641, "Adventure_AWARD_HALL_TASK"},
-    {680, "chatMuted"},
-    {1450, "GET_KVK_INFOS"},
-    {1451, "GS_TO_KVK"},
-    {1452, "KVK_TO_GS"},
-    {3601, "ACTIVITY_INVEST_SAVE"},
-    {3602, "ACTIVITY_INVEST_CLAIM"},
-    {3603, "ACTIVITY_INVEST_GET_FREE"},
-    {3604, "ACTIVITY_INVEST_REFRESH"},
-    {1453, "KVK_ALLIANCE_BUILDING"},
-    {1454, "KVK_ALLIANCE_BUILDING_CREATE"},
-    {1455, "KVK_ALLIANCE_BUILDING_DETAIL"},
-    {1456, "KVK_ALLIANCE_BUILDING_REMOVE"},
-    {1457, "KVK_ALLIANCE_BUILDING_FIX"},
-    {1458, "KVK_ALLIANCE_REBUILD_BASE"},
-    {1459, "KVK_ALLIANCE_REBUILD_BASE_DONATE"},
-    {1460, "KVK_ALLIANCE_CHOICE_COLOR"},
-    {1471, "EC_PREPARE_INFO"},
-    {1472, "EC_PREPARE_SYNTHESIS"},
-    {1473, "EC_PREPARE_DONATE"},
-    {1474, "EC_PREPARE_REWARD"},
-    {1475, "EC_PREPARE_RANK"},
-    {1476, "EC_PREPARE_DONATE_NEW"},
-    {1478, "KVK_GET_RANK"},
-    {1479, "KVK_GET_ACHEVEMENT"},
-    {1480, "KVK_GET_ACHEVEMENT_REWARD"},
-    {1481, "KVK_GET_PROGRESS_REWARD"},
-    {1461, "KVK_SMALL_MAP_INFO"},
-    {1462, "KVK_JUDGE_IS_CONNECT"},
-    {1463, "KVK_JUDGE_CITY_IS_CONNECT"},
-    {1482, "KVK_MARK_WORLD_POINT"},
-    {1483, "KVK_UNMARK_WORLD_POINT"},
-    {1520, "TRANSFER_SERVER_LIST"},
-    {1521, "TRANSFER_USER_LIST"},
-    {1522, "TRANSFER_SERVER"},
-    {1523, "TRANSFER_SELECT_INDEX"},
-    {1524, "TRANSFER_GET_MY_SERVER"},
-    {1525, "TRANSFER_SERVER_APPLY_REQUEST"},
-    {1526, "TRANSFER_SERVER_APPLY_OPERATE"},
-    {1527, "TRANSFER_SERVER_APPLY_LIST"},
-    {1528, "TRANSFER_SERVER_NEWBIE"},
-    {1601, "DecorateStorehouse_GetData"},
-    {1602, "DecorateStorehouse_PutIn"},
-    {1610, "DecorateStorehouse_PutInPos"},
-    {1603, "DecorateStorehouse_PutOut"},
-    {1604, "DecorateStorehouse_MovePos"},
-    {1605, "DecorateStorehouse_Compose"},
-    {1606, "DecorateStorehouse_PutOutAll"},
-    {1055, "GET_GUN_FIGHT_INFO"},
-    {1057, "GET_GUN_FIGHT_USER_INFO"},
-    {1056, "GET_GUN_FIGHT_ALLIANCE_RANK"},
-    {1184, "ALLIANCE_GET_SHOW_TASK"},
-    {1185, "ALLIANCE_TASK_TANK"},
-    {1186, "ALLIANCE_ACHEVEMENT_TASK_GET_REWARD"},
-    {1187, "ALLIANCE_BADGE_READ"},
-    {1643, "ARMYEQUIP_NEW_MATERIAL_PRODUCE"},
-    {1644, "ARMYEQUIP_NEW_MATERIAL_PRODUCE_DELETE"},
-    {1645, "ARMYEQUIP_NEW_MATERIAL_PRODUCE_GET"},
-    {1646, "ARMYEQUIP_NEW_MATERIAL_COMPOSE"},
-    {1647, "ARMYEQUIP_NEW_MATERIAL_DISMANTLE"},
-    {1648, "ARMYEQUIP_NEW_EQUIP_COMPOSE"},
-    {1649, "ARMYEQUIP_NEW_EQUIP_DISMANTLE"},
-    {1650, "ARMYEQUIP_NEW_EQUIP_CHANGE"},
-    {1652, "HURT_TANK_QUEST"},
-    {1642, "ACTIVITY_GET_SCORE_REWARD"},
-    {1777, "ACTIVITY_GET_ALL_SCORE_REWARD"},
-    {3140, "ACTIVITY_GET_ALL_TASK_REWARD"},
-    {3141, "MAHUA_SHARE_FIRST"},
-    {3142, "MAHUA_SHARE_GET_FIRST_REWARD"},
-    {3143, "EVA_PINBALL_DRAW"},
-    {3144, "EVA_PINBALL_GET_REWARD"},
-    {3145, "EVA_PINBALL_GET_LOG"},
-    {1058, "GET_GUN_FIGHT_USER_REWARD"},
-    {1059, "GET_ARIDROP_POINT"},
-    {1060, "SEND_SYSTEM_MSG"},
-    {1353, "GET_ALLIANCE_DISPLAY_TIME"},
-    {1354, "GET_AL_MONSTER_SIEGE_ACT_RANK_INFO"},
-    {1355, "AWARD_AL_MONSTER_SIEGE_RANK"},
-    {1356, "GET_AL_MONSTER_SIEGE_ITEM_COUNT"},
-    {1357, "GET_AL_MONSTER_RANK_DATA"},
-    {1358, "Compose_Treasure_Debris"},
-    {1359, "Get_Treasure_Theme_Reward"},
-    {1348, "ACTIVITY_ALLIANCEBP_RANK"},
-    {1349, "ASK_REWARD_FIRST_HERO"},
-    {1660, "NBATTLE_ARENA_PVE"},
-    {1661, "ARENA_PVE_MAIN_REQUEST"},
-    {1662, "ARENA_PVE_RANK"},
-    {1663, "ARENA_PVE_CONFIG"},
-    {1664, "ARENA_PVE_RECORD_LOG"},
-    {1653, "MigrateCode_getCode"},
-    {1654, "MigrateCode_CreateCode"},
-    {1655, "MigrateCode_UseCode"},
-    {1665, "ARENA_PVP_MAIN_REQUEST"},
-    {1666, "ARENA_PVP_SETD_DEFEND"},
-    {1667, "ARENA_PVP_DF_DETAIL"},
-    {1668, "ARENA_PVP_PLAYER_LIST"},
-    {1669, "ARENA_PVP_START_FIGHT"},
-    {1670, "ARENA_PVP_BATTLE_RECORD"},
-    {1671, "PVP_BUY_TICKET_ITEM"},
-    {1656, "Activity_Hero_Return_Reward_Select"},
-    {1657, "Activity_Hero_Return_Roll"},
-    {1658, "GET_WORLD_SERVER_BRIEFING"},
-    {1659, "GET_WORLD_SERVER_OTHER_BRIEFING"},
-    {1673, "King_Mark_Get"},
-    {1672, "King_Mark_CHANGE"},
-    {1680, "GET_TREASURE_MAP_DATA_BY_TYPE"},
-    {1681, "GET_RECENT_TREASURE_MAP_DATA"},
-    {1682, "CREATE_TREASURE_MAP_DATA"},
-    {1683, "DONATE_TREASURE_MAP_ITEM"},
-    {1684, "AWARD_DONATE_ITEM_TREASURE_MAP"},
-    {1685, "LOTTERY_TURN_TABLE_TREASURE_MAP"},
-    {1686, "TreasureMapChooseBoss"},
-    {1687, "GET_TREASURE_MAP_WORLD_BOSS_INFO"},
-    {1688, "GET_HURT_TREASURE_MAP_WORLD_BOSS_RANK"},
-    {1689, "GET_TREASURE_MAP_WORLD_SHOP"},
-    {1690, "BUY_IN_TREASURE_MAP_WORLD_SHOP"},
-    {1691, "GET_TREASURE_MAP_TASK_INFO"},
-    {1692, "GET_TREASURE_MAP_TASK_REWARD"},
-    {1693, "GIVE_UP_TREASURE_MAP_TASK"},
-    {1677, "King_Castle_Effect_Equip"},
-    {1674, "ACTIVITY_GURBAN_BUY_ADV"},
-    {1675, "ACTIVITY_GURBAN_USE_ITEM"},
-    {1678, "LUCK_MALL_REFRESH"},
-    {1679, "LUCK_MALL_BUY"},
-    {1676, "ACTIVITY_KINGDOM_GETINFO"},
-    {1700, "ACTIVITY_WORK_AWARD"},
-    {1694, "ADD_EXPLORE_SEA_SLOT"},
-    {1695, "AWARD_EXPLORE_SEA"},
-    {1696, "COMPOSE_EXPLORE_SEA_BOX"},
-    {1697, "SPEED_UP_EXPLORE_SEA"},
-    {1698, "START_EXPLORE_SEA"},
-    {1708, "EXPLORE_SEA_HUNT_ALL"},
-    {1748, "WORLDEMOJI_GET"},
-    {1749, "WORLDEMOJI_USE"},
-    {1750, "WORLDEMOJI_ON"},
-    {1751, "WORLDEMOJI_OFF"},
-    {1710, "GET_NEARST_TERRITORY_MARCH_TIME"},
-    {1701, "ACTIVITY_RED_BLUE_RESET_AWARD"},
-    {1704, "SYNC_CAMPAIGN_INFO"},
-    {1702, "GET_DECORATION_SUITS"},
-    {1703, "AWARD_DECORATION_SUIT"},
-    {1705, "Convert_ExcludeHero_Patch"},
-    {1712, "VideoGetArmy"},
-    {1713, "GET_LEVY_REWARD"},
-    {1711, "VideoGetRes"},
-    {1714, "ACTIVITY_CAMPFIRE_BURN"},
-    {1063, "GET_WORLD_RESOURCE_AMOUNT"},
-    {1699, "LIKENESS_SURVEY"},
-    {1715, "OPEN_ALL_SEA_CLOUD"},
-    {1716, "UNLOCK_AREA_WAR_SEA"},
-    {1717, "AREA_SEA_FIGHT"},
-    {1801, "MONEY_TREE_INFO_V1"},
-    {1802, "MONEY_TREE_CLICK_V1"},
-    {1488, "EC_GET_EXCHANG_INFO"},
-    {1489, "EC_GET_EXCHANG_REQUEST"},
-    {1490, "EC_GET_BUFF"},
-    {1484, "EC_STRONGEST_LEADER_COMPETITION"},
-    {1485, "EC_STRONGEST_LEADER_RANK"},
-    {1486, "EC_STRONGEST_LEADER_DONATE"},
-    {1487, "EC_STRONGEST_LEADER_GET_REWARD"},
-    {1730, "WorldCitySkinInteract"},
-    {1718, "ACTIVITY_PHASE_RANK_GET"},
-    {1719, "ACTIVITY_HISTORICAL_PHASE_RANK_GET"},
-    {1720, "ACTIVITY_HISTORICAL_DAY_RANK_GET"},
-    {1724, "GET_GLORIOUS_TRAINING_INFO"},
-    {1725, "START_GLORIOUS_TRAINING"},
-    {1726, "CANCEL_GLORIOUS_TRAINING"},
-    {1727, "SPEEDUP_GLORIOUS_TRAINING"},
-    {1728, "IMMEDIATELY_GLORIOUS_TRAINING"},
-    {229, "EXCHANGE_GLORIOUS_TRAINING"},
-    {1731, "CROSS_ARENA_MAIN_INFO"},
-    {1732, "CROSS_ARENA_SET_DEFEND"},
-    {1733, "CROSS_ARENA_GET_CHALEENGE_LIST"},
-    {1734, "CROSS_ARENA_ATTACK"},
-    {1735, "CROSS_ARENA_GET_OTHER_DEFEND"},
-    {1729, "CROSS_ARENA_CHALLANGE"},
-    {1736, "CROSS_ARENA_GET_BATTLE_LOG"},
-    {1737, "CROSS_ARENA_BUY_TICKET"},
-    {1742, "GET_TRANSPORT_EFFECT_DATA"},
-    {1743, "SET_TRANSPORT_EFFECT"},
-    {1744, "EXCHANGE_TRANSPORT_EFFECT"},
-    {1752, "GET_CITY_SKILL_DATA"},
-    {1753, "USE_CITY_SKILL"},
-    {445, "ISLE_SWEEP"},
-    {710, "PAY_SPEC_COUPON_FLOW"},
-    {731, "FIRST_CAHRGE_COLLECT_REWARD"},
-    {3001, "GS_TO_CAB"},
-    {3002, "CAB_TO_GS"},
-    {3003, "CAB_ASK_HOSPITAL_DATA"},
-    {3004, "CAB_CURE_ALL_ARMYS_DATA"},
-    {3010, "CAB_BUILDING_DETAIL"},
-    {3006, "CAB_SIGN"},
-    {3007, "CAB_GET_ALLIANCE_MEMEBER_LIST"},
-    {3008, "CAB_CHANGE_MEMBER_LIST"},
-    {3011, "CAB_SMALL_MAP_INFO"},
-    {3012, "CAB_MINI_MAP_INFO"},
-    {3005, "CAB_SPEED_CURE"},
-    {3013, "CAB_SITUATION"},
-    {3009, "CAB_RECORD"},
-    {1745, "FREE_PACK_PURCHASE_LOG"},
-    {1746, "FREE_PACK_PURCHASE"},
-    {1747, "FREE_PACK_COLLECT"},
-    {3015, "CAB_INTERCEPT_AIRDROP_MARCH"},
-    {3016, "CAB_PRE_INTERCEPT_AIRDROP_MARCH"},
-    {3014, "CAB_BATTLE_RESULT"},
-    {3020, "CAB_SYNC_DATA"},
-    {3017, "CAB_RECORD_COMPARE"},
-    {3101, "Activity_Baking_Item_Exchange"},
-    {3102, "Activity_Baking_Rank_Data_Get"},
-    {1189, "CREATE_ACTIVITY_ALLIANCE_BUILD"},
-    {1190, "GET_ACTIVITY_BUILD_FIGHT_LOGS"},
-    {1191, "Alliance_Boss_Choose"},
-    {1192, "Alliance_Boss_Open"},
-    {1755, "GET_ACTIVITY_CLOVER_LOTTERY_REWARD"},
-    {1759, "Get_WeChat_RedPacket_Code"},
-    {1760, "Get_WeChat_RedPacket_Reward"},
-    {1762, "Army_Mastery_LevelUp"},
-    {1763, "Army_Mastery_Strengthen"},
-    {3021, "CAB_SHOP_BUY"},
-    {1425, "CSB_SHOP_BUY"},
-    {3018, "CAB_RANK"},
-    {1810, "SERVER_TASK_LIST"},
-    {1811, "SERVER_TASK_REWARD"},
-    {1818, "GET_FORTRESS_LOTTERY_DATA"},
-    {1819, "FORTRESS_LOTTERY_REWARD"},
-    {1820, "GET_FORTRESS_SCRATCH_CARD_RECORD_DATA"},
-    {1825, "GET_FORTRESS_CHOOSE_ITEM_REWARD_DATA"},
-    {1826, "FORTRESS_CHOOSE_ITEM_REWARD"},
-    {1827, "GET_FORTRESS_CHOOSE_ARMY_REWARD_DATA"},
-    {1828, "FORTRESS_CHOOSE_ARMY_REWARD"},
-    {1815, "WONDER_TASK_INFO"},
-    {1816, "WONDER_TASK_RANK_INFO"},
-    {1817, "WONDER_TASK_REVICE"},
-    {1821, "GET_WORLD_SITE_MONSTER_LIST"},
-    {1822, "SUMMON_WORLD_SITE_MONSTER"},
-    {1823, "GET_WORLD_SITE_RESOURCES_LIST"},
-    {1824, "SUMMON_WORLD_SITE_RESOURCE"},
-    {1756, "QIU_BI_TE_INFO"},
-    {1757, "QIU_BI_TE_SHOOT"},
-    {1758, "QIU_BI_TE_OPEN_BOX"},
-    {1768, "ELEMENT_SCIENCE_INFO"},
-    {1769, "ELEMENT_SCIENCE_UPDATE"},
-    {1770, "ELEMENT_SCIENCE_SWITCH"},
-    {1765, "INFINITE_GIFT_ACT_AWARD_FREE"},
-    {1766, "INFINITE_GIFT_ACT_REFRESH"},
-    {1761, "UPGRADE_FORMATION"},
-    {2007, "GET_MARRCH_HERO_BUFF"},
-    {2008, "GET_CREDIT_INFO"},
-    {2010, "March_Speed_Up_City_Skill_Use"},
-    {1771, "DWARF_MINER_DIG"},
-    {1772, "DWARF_MINER_SKIP_WAITING"},
-    {1773, "DWARF_MINER_OPEN_CHEST"},
-    {1774, "DWARF_MINER_UNLOCK_CHEST"},
-    {3022, "EXCLUSIVE_SKILL_BUY"},
-    {3301, "SING_SIGN_IN_30_DAYS"},
-    {3302, "PROGRESS_SIGN_IN_30_DAYS"},
-    {3154, "ACTIVITY_PUZZLE_Play"},
-    {3155, "ACTIVITY_PUZZLE_GET_REWARD"},
-    {3156, "ACTIVITY_FREE_GIFT_GET_REWARD"},
-    {4900, "ACT_Interstellar_TITLE_GET_REWARD"},
-    {4900, "ACTIVITY_NEW_YEAR_OPEN_LANTERN"},
-    {4901, "ACTIVITY_NEW_YEAR_OPEN_SMALL"},
-    {4902, "ACTIVITY_NEW_YEAR_GET_SMALL_REWARD"},
-    {1775, "ActivityMonthSignIn"},
-    {1426, "GET_CROSS_HOSPITAL_QUEUES"},
-    {1427, "ARMY_CROSS_HEAL"},
-    {1428, "SPEEDUP_CROSS_HOSPITAL_QUEUE_BY_GOLD"},
-    {3401, "IdolJigSawSignIn"},
-    {3402, "JigsawGetIdols"},
-    {3403, "IdolJigsawGetInfos"},
-    {3404, "IdolJigsawDownloadImg"},
-    {704, "GetG123PayInfoNew"},
-    {3104, "VIDEO_ACTIVITY_DONATE"},
-    {3108, "VIDEO_ACTIVITY_DONATE_REAL_SCORE"},
-    {3109, "VIDEO_ACTIVITY_DONATE_Hinatazaka"},
-    {3103, "ACTIVITY_GET_SINGLE_INFO"},
-    {1506, "SYNC_PLATFORM_VIP_INFO"},
-    {1530, "GET_QQGAME_VIP_PRIVILEGE_INFO"},
-    {1531, "AWARD_QQGAME_VIP_PRIVILEGE"},
-    {720, "SendPayToServer_fbInstantGame"},
-    {2015, "POWER_GET_DETAIL"},
-    {3501, "BuyElectricity"},
-    {3502, "RadarScan"},
-    {3503, "RadarReset"},
-    {3504, "RadarGetInfo"},
-    {3505, "RadarStartTask"},
-    {3507, "RadarBeginMarch"},
-    {3508, "RadarGetReward"},
-    {3509, "RadarCountryGetReward"},
-    {3516, "RadarResetOneTask"},
-    {3514, "RadarLevelUp"},
-    {3515, "RadarDefend"},
-    {3517, "RadarStrength"},
-    {1776, "DWARF_MINER_RECEIVE_ALL"},
-    {3701, "EC_SHOP_BUY"},
-    {3702, "EC_SHOP_INIT"},
-    {1495, "KVK_ARK_RANK_INFO"},
-    {1496, "FR_ARK_INFO"},
-    {1494, "KVK_ARK_TRANSFER_MARCH"},
-    {1493, "EC_SCIENCE_INIT"},
-    {1491, "EC_SCIENCE_LEARN"},
-    {1492, "EC_SCIENCE_SPEED"},
-    {2012, "USER_ROLE_LIST_DETAIL"},
-    {2013, "G123QuerySnsState"},
-    {2014, "G123BindAccountRewardwithCheck"},
-    {2025, "USER_ROLE_LIST_DETAIL_NEW"},
-    {1193, "ALLIANCE_RECORD_DATA"},
-    {3161, "RICH_MAN_LOVER_DOUBLE_LINK"},
-    {3162, "RICH_MAN_CHECK_LINK"},
-    {3163, "RICH_MAN_LOVER_REWARD"},
-    {4008, "OPCENTER_OPEN_FORUM"},
-    {4009, "OPCENTER_OPEN_LINK"},
-    {4010, "OPCENTER_GET_LINK_REWARD"},
-    {3901, "Activity_King_Return_Code_Bind"},
-    {3902, "Activity_King_Return_Reward"},
-    {3903, "Activity_King_Return_Index_Reward"},
-    {3904, "Get_Activity_King_Return_Invite_Player_List"},
-    {230, "ARMYS_PUT"},
-    {3110, "TRANSFORMERS_BOSS_PREVIEW_UNLOCK"},
-    {3111, "MONEYSCORE_PACKAGE_FREE_RECEIVE"},
-    {3112, "HERO_UPGRADE"},
-    {4145, "HERO_CHANGE_UNLOCK"},
-    {4146, "HERO_CHANGE_SWITCH"},
-    {4159, "Send_View_Open_Task"},
-    {152, "Unlock_Area_V3"},
-    {153, "Unlock_Sea_Area_V3"},
-    {154, "Final_Unlock_Area_V3"},
-    {422, "Unlock_Area_Battle_V3"},
-    {423, "Repair_Fake_Battle"},
-    {159, "RANDOM_AREA_V3_EVENT_BUILD"},
-    {160, "EXECUTE_AREA_V3_RANDOM_EVENT_BUILD"},
-    {161, "Start_Wait_Area_V3"},
-    {162, "Army_Parade"},
-    {158, "PUTOUT_ARMY_FROM_AREA_V3_ARSENAL_BOX"},
-    {157, "RECEIVE_AREA_V3_MULTIPLE_TREASURE"},
-    {155, "REPAIR_AREA_V3_MAIN_BUILD"},
-    {156, "REMOVE_AREA_V3_MAIN_BUILD"},
-    {1778, "BREW_FORMULA"},
-    {1779, "AWARD_WADE_SIGN"},
-    {1799, "CHECK_ELEMENT_PUSH_GIFT"},
-    {1780, "ACTIVITY_SPECIFIED_PHASE_RANK_GET"},
-    {733, "GET_BULLION_INFO"},
-    {732, "BULLION_PAY"},
-    {734, "BULLION_PRICE_REPORT"},
-    {3801, "ActivityTransformerBossContribute"},
-    {3802, "NBATTLE_TRANSFORM_BOSS"},
-    {3803, "ActivityTransformerBossRecodeLog"},
-    {3804, "ActivityTransformerBossReward"},
-    {3805, "Get_Transformer_Boss_Pos"},
-    {3113, "ACTIVITY_BUMBLEBEE_GET_REWARD"},
-    {3811, "NBATTLE_TRANSFORM_BOSS_P2"},
-    {3127, "TRANSFORM2_RICHMAN_TOUCH_TASK"},
-    {3605, "MYSERY_BOX_UNBOXING"},
-    {3606, "MYSERY_BOX_REFRESH"},
-    {3607, "MYSERY_BOX_SHAKE"},
-    {3608, "MYSERY_BOX_STAGE_REWARD"},
-    {3511, "RADAR_FINISH_DRAW_EVENT"},
-    {3512, "RADAR_FINISH_PASSWORD_EVENT"},
-    {3513, "RADAR_RESET_READ_STATUS"},
-    {180, "BATCH_BUILD_ORDER"},
-    {4502, "RUSSIA_POP_STATUS"},
-    {3114, "AWARD_AUTO_ADD_POINT_BP_ACT_SCORE_STAGE"},
-    {4501, "RUSSIA_BP_RECYCLE_REWARD"},
-    {3137, "ITEM_RECYCLE_ACTIVITY"},
-    {3138, "SCORE_EXCHANGE_ITEM_ACTIVITY"},
-    {3139, "RANSOME_ITEM_ACTIVITY"},
-    {4101, "ITEM_RECYCLE"},
-    {4102, "ITEM_BATCH_RECYCLE"},
-    {4103, "ITEM_RANSOME"},
-    {4104, "ITEM_RECYCLE_RECORD"},
-    {3121, "PURCHASE_ACCUMULATE_RECHARGE"},
-    {4508, "SERGEY_HERO_SKIN_ACT_REWARD"},
-    {3120, "CITY_SKIN_SPECIAL_EXCHANGE"},
-    {4120, "CITY_SKIN_UPGRADE"},
-    {4122, "Request_A_Injured_Army"},
-    {3122, "RICH_MAN_ROLL_DICE"},
-    {3123, "RICH_MAN_ACHIEVEMENT_RECIVE"},
-    {3906, "HALLOWEEN_BP_INFINITE_RECEIVE"},
-    {3119, "HALLOWEEN_DAY_TASK_DOUBLE_RECEIVE"},
-    {740, "LIMITED_TIME_OFFER_SCORE_OPNE"},
-    {741, "LIMITED_TIME_OFFER_SCORE_INFO"},
-    {742, "LIMITED_TIME_OFFER_SCORE_FREE_REWARD"},
-    {743, "LIMITED_TIME_OFFER_SCORE_REWARD"},
-    {3907, "ACTIVITY_FIRE_A_CANNON"},
-    {1080, "GET_ALL_TERRITORY_INFO"},
-    {1082, "GET_VISIBLE_TERRITORY_INFO"},
-    {1083, "GET_MIX_TERRITORY_INFO"},
-    {1087, "RECALL_ALL_MARCH"},
-    {3115, "SMALLAMOUNTBP_FREE_REWARD"},
-    {3116, "SMALLAMOUNTBP_FDAY_REWARD"},
-    {4731, "ACTIVITY_JAPAN_TRAIN_TASK_CHAPTER"},
-    {4732, "ACTIVITY_JAPAN_TRAIN_TASK_REFRESH"},
-    {3126, "RANK_WITH_SHOP_BUY"},
-    {4697, "DECORATE_SHOP_BUY"},
-    {1430, "GET_GROUP_CROSS_FIGHT"},
-    {1431, "GET_GROUP_CROSS_FIGHT_BY_GROUP"},
-    {1432, "GET_GROUP_CROSS_FIGHT_BET_INFO"},
-    {1433, "BET_GROUP_CROSS_FIGHT"},
-    {1435, "TT_GET_RANK_DATA"},
-    {1437, "TT_SHOP_DATA"},
-    {1434, "TT_SHOP_BUY_ITEM"},
-    {1436, "SEND_GROUP_CROSS_FIGHT_GIFT"},
-    {1438, "TT_GET_GIFT_DATA"},
-    {3124, "HERO_CONVERT_SKIN"},
-    {3125, "NOTICE_DAILY_REWARD"},
-    {4123, "BARGAINSHOP_BUY"},
-    {4124, "BARGAINSHOP_BARGAIN"},
-    {4125, "BARGAINSHOP_HELP"},
-    {4126, "SAVE_GUIDE_FREE_PASSED_ID"},
-    {4174, "START_CHALLENGE_PVE_FIGHT"},
-    {4175, "START_MULTIPLE_FIGHT"},
-    {4176, "GET_PVE_CHALLENGE_LOG"},
-    {4701, "THANKS_GIVING_ACH_NUM_REWARD"},
-    {4702, "THANKS_GIVING_START_COOKING"},
-    {4705, "LOOK_UNLOCK_GIFT"},
-    {3908, "ACTIVITY_WARE_HOUSE_JP_GET_ITEM"},
-    {3909, "ACTIVITY_WARE_HOUSE_JP_GET_REWARD"},
-    {3910, "ACTIVITY_WARE_HOUSE_JP_REFRESH"},
-    {4130, "MINI_GAME_MAX_PASS_LEVEL"},
-    {4131, "MINI_GAME_GET_LEVEL_REWAED"},
-    {3911, "ACTIVITY_KING_BOX_REWARD_THIRD_EDITION"},
-    {4692, "ACTIVITY_SHOP_JP_REFRESH"},
-    {3919, "ACTIVITY_CHIP_SYNTHESIS"},
-    {4703, "THANKS_GIVING_QUICK_GET_COOKING_REWARD"},
-    {4704, "THANKS_GIVING_QUICK_CLAIM_COOKING_REWARD"},
-    {4127, "CASTLECOS"},
-    {163, "TRAIN_ARMY_SPEED_UP_BY_BUILDS"},
-    {4711, "CHRISTMAS_STORY_CHOOSE_TASK_REWARD"},
-    {4712, "CHRISTMAS_STORY_GET_CHAPTER_REWARD"},
-    {4713, "CHRISTMAS_STORY_GET_ALL_MAP_REWARD"},
-    {4714, "CHRISTMAS_STORY_SELECT_MAP"},
-    {4715, "CHRISTMAS_STORY_NEXT_MAP_STORY"},
-    {4716, "CHRISTMAS_STORY_REPEATE_CHALLENGE_TASK"},
-    {4717, "CHRISTMAS_USE_MAGNIFIER"},
-    {4764, "MYSTERIOUS_TRIANGLE_DRAW"},
-    {4765, "MYSTERIOUS_TRIANGLE_REFRESH"},
-    {4766, "MYSTERIOUS_TRIANGLE_GET_REWAARD"},
-    {4721, "TRANSFORMERS_2_UNLOCK_STSTE"},
-    {4741, "TRANSFORMERS_2_DONATE_ENERGY"},
-    {4742, "TRANSFORMERS_2_ENEMY_INFO"},
-    {4751, "TRANSFORMERS_2_HERO_LOTTERY"},
-    {4743, "TRANSFORMERS_2_DECORATIONS"},
-    {232, "BAG_ARMY_BATCH_PUT"},
-    {4128, "Get_Building_Skill_Data"},
-    {4129, "Building_Use_Skill"},
-    {1195, "HELP_ALL_ALLIANCE_MEMBERS"},
-    {1196, "Get_Alliance_Free_Zone_Data"},
-    {4744, "RUNINS_REWARD"},
-    {4745, "RUNINS_TIME"},
-    {3132, "RAMADAN_BUY"},
-    {3131, "RAMADAN_TOUCH"},
-    {3129, "TURNTABLE_DIAMOND_BUY"},
-    {3130, "TURNTABLE_OPENBOX"},
-    {3128, "TURNTABLE_PRIZEDRAW"},
-    {3135, "MAKESHIFTBAG_RECEIVE"},
-    {3133, "WORLD_PEACE_GET_PROGRESS_REWARD"},
-    {3134, "WORLD_PEACE_GET_REWARD"},
-    {4132, "CHANGE_HERO_DRESS"},
-    {4133, "USERINFO_COLLECT_CITY"},
-    {4135, "GET_EMPIRE_TREASURE_RANK_INFOS"},
-    {4136, "GET_EMPIRE_TREASURE_RANK_BY_LEVEL"},
-    {4137, "RECEIVE_EMPIRE_TREASURE_RANK_REWARD"},
-    {4138, "RECEIVE_EMPIRE_TREASURE_PROGRESS_REWARD"},
-    {4761, "TREASURE_BOX_SCHEDULE_RECEIVE"},
-    {4762, "TREASURE_BOX_RECEIVE"},
-    {4763, "TREASURE_BOX_REFRESH"},
-    {3913, "RECEIVE_BP_LOOP_REWARD"},
-    {3914, "GET_ACTIVITY_WAWAJI_PLAY"},
-    {3973, "Eva_Boss_Attack"},
-    {1781, "SYNC_SERVICE_TOUTIAO_CLICKID"},
-    {181, "UPGRADE_DECORATE_BUILDINGS"},
-    {9999, "TEST_REQUEST_CMD"},
-    {3136, "THREE_ARMY_HERO_ROTARY_CHOOSE_ARMY"},
-    {3912, "GET_ACTIVITY_PROFESSIONALTALENTBOX_REWARD"},
-    {3621, "Get_Activity_Rank_Total_Data"},
-    {3622, "Get_Activity_Rank_Total_Data_History"},
-    {1783, "GET_HEROID_SCREEN"},
-    {1782, "SHIP_WRECK_OVERDUE"},
-    {4139, "RecoveryGold"},
-    {4140, "GET_BLOCK_OUT_CONFIGS"},
-    {183, "GET_WAREHOUSE_INFO_BY_BUILD_TYPE"},
-    {4706, "GetGourmetProgressReward"},
-    {792, "QUERY_GIFTBAG_COUNT"},
-    {5101, "CROSS_ARENA_4C_MAIN_INFO"},
-    {5102, "CROSS_ARENA_4C_BUY_TICKET"},
-    {5103, "CROSS_ARENA_4C_GET_CHALEENGE_LIST"},
-    {5104, "CROSS_ARENA_4C_SET_DEFEND"},
-    {5105, "CROSS_ARENA_4C_ATTACK"},
-    {5106, "CROSS_ARENA_4C_CHALLANGE"},
-    {5107, "CROSS_ARENA_4C_GET_OTHER_DEFEND"},
-    {5108, "CROSS_ARENA_4C_GET_BATTLE_LOG"},
-    {1784, "GET_WORLD_CITY_ASSISTANCE_MARCH"},
-    {1787, "PROFESSION_CHECK_PUSH_GIFT"},
-    {1788, "OPEN_EQUIP_MANUFACTUR_CHECK_PUSH_GIFT"},
-    {1786, "CLOSE_WORLD_EMOJI"},
-    {1800, "ARMY_EQUIP_CHECK_PUSH_GIFT"},
-    {5001, "TANSFORM_EQUIP"},
-    {5002, "RESET_EQUIP_SUIT"},
-    {653, "ARMY_POWER_RANK"},
-    {654, "ALLIANCE_ARMY_POWER_RANK"},
-    {649, "MONUMENT_TASK_COMPLETE_RANK"},
-    {1197, "GET_ALLIANCE_SKILL"},
-    {1198, "ALLIANCE_SKILL_DONATE"},
-    {1199, "ALLIANCE_SKILL_RECOMMEND"},
-    {1105, "ALLIANCE_SKILL_USE"},
-    {1107, "ARMY_CAMP_MARCH"},
-    {5125, "FR_ALLIANCE_INIT"},
-    {5126, "FR_ALLIANCE_DONATE"},
-    {5127, "KVK_ALLIANCE_TEC_LVUP"},
-    {5128, "KVK_ALLIANCE_TEC_USE"},
-    {5116, "SPECIAL_CAR_INFO"},
-    {5117, "SPECIAL_CAR_BATTLE"},
-    {5141, "FR_PLAN"},
-    {5142, "FR_PLAN_REWARD_VOTE"},
-    {5143, "FR_PLAN_REWARD_SELECT"},
-    {5144, "FR_PLAN_REWARD_GET"},
-    {5145, "FR_PLAN_RANK"},
-    {5118, "GET_MY_SPECIAL_CAR"},
-    {5120, "GET_MARCH_BY_ID_FOR_SPECIAL_RES"},
-    {5119, "GET_SPECIAL_RES_Car_Log"},
-    {4696, "FIRST_CHARGE_THREE_DAY_ALREADY_OPEN"},
-    {4693, "GET_ACTIVITY_GIFT_SMALL_REWAED"},
-    {3623, "NEW_SUPER_REWARD"},
-    {3624, "NEW_OCTOBER_RECORD"},
-    {5131, "FR_WORLD_BOSS_PANEL"},
-    {5132, "FR_LEVEL_RANK"},
-    {5133, "FR_HISTORY_RANK"},
-    {5134, "FR_PERSON_RANK"},
-    {5135, "FR_WORLD_BOSS_RANK"},
-    {5136, "FR_WORLD_BOSS_REWARD"},
-    {5151, "FR_ALLIANCE_RANK"},
-    {793, "INTEGRAL_DATA"},
-    {4746, "GET_TF3_RANK_LIST"},
-    {5510, "ARENA_MECHA_DATA"},
-    {5511, "ARENA_MECHA_BATTLE"},
-    {5512, "ARENA_MECHA_RECORD_LOG"},
-    {5513, "ARENA_MECHA_RANK"},
-    {5514, "ARENA_MECHA_OTHER_INFO"},
-    {5515, "ARENA_MECHA_REWARD"},
-    {5501, "MECHA_GET_ALL"},
-    {5502, "MECHA_PART_FIX"},
-    {5503, "MECHA_PART_INSTALL"},
-    {5504, "MECHA_CHANGE_ARMY_TYPE"},
-    {5505, "MECHA_EXP_ITEM_USE"},
-    {5506, "MECHA_CHIP_USE"},
-    {5507, "MECHA_CHIP_REMOVE"},
-    {5508, "MECHA_CHIP_STRENGTHEN"},
-    {5509, "MECHA_SKIN_CHANGE"},
-    {5516, "MECHA_SKIN_BUY"},
-    {5518, "MECHA_CHIP_SCHEMES_SAVE"},
-    {5519, "MECHA_CHIP_SCHEMES_USE"},
-    {4694, "FINISH_BUBBLE"},
-    {4767, "GET_DAILY_TASK_LITE_FINAL_REWAED"},
-    {1785, "GET_QUICK_REPARE_INFO"},
-    {5015, "GET_ALLIANCE_GIFT_PAGE_INFIO"},
-    {5014, "GET_ALLIANCE_GIFT_INFO"},
-    {4770, "STAR_DEVELOP_CHOOSE_STAR"},
-    {4771, "STAR_DEVELOP_TRAIN"},
-    {4773, "STAR_DEVELOP_PERFORM"},
-    {4775, "STAR_DEVELOP_TASK_REWARD"},
-    {4776, "STAR_RANDOM_EVENT_CHOOSE"},
-    {4777, "STAR_DEVELOP_GET_FINAL_REWARD"},
-    {4778, "STAR_DEVELOP_GET_ALL_OCC_UNLOCK_REWARD"},
-    {4772, "STAR_DEVELOP_GET_SUPER_OCC_UNLOCK_REWARD"},
-    {5601, "GET_THOR_SCIENCE"},
-    {5602, "STUDY_THOR_SCIENCE"},
-    {2026, "USER_FACE_VERIFY_OCR"},
-    {2027, "USER_FACE_VERIFY_RESULT"},
-    {2030, "GET_HERO_SWITCH_DATA"},
-    {2031, "SAVE_HERO_SWITCH_DATA"},
-    {3150, "EP_SET_STATUS"},
-    {3152, "EP_STAGE_UNLOCK"},
-    {3153, "EP_ACTIVITY_UNLOCK"},
-    {4698, "GET_NEW_PRICE_CONFIG"},
-    {3518, "RADAR_STORY"},
-    {3519, "RADAR_STORY_DECODE"},
-    {4699, "InfiniteCaveOpenBox"},
-    {4700, "InfiniteCaveNextStage"},
-    {3916, "ActivityEvaCharge"},
-    {3917, "ActivityEvaStudy"},
-    {3918, "ActivityEvaFireLog"},
-    {3148, "EP2_SET_GUIDE"},
-    {3149, "START_GUIDE_SET_SHOW"},
-    {5622, "ALLIANCE_INSTRUCT_SEND"},
-    {5621, "ALLIANCE_INSTRUCT_GET_COUNT"},
-    {5623, "GET_ALLIANCE_INSTRUCT_LIST"},
-    {5624, "READ_ALLIANCE_INSTRUCT"},
-    {5625, "TOP_ALLIANCE_INSTRUCT"},
-    {5626, "DELETE_ALLIANCE_INSTRUCT"},
-    {5627, "GET_NEW_ALLIANCE_INSTRUCT"},
-    {3625, "SHARE_GIFT_NOTIC"},
-    {3626, "SHARE_GIFT_GET_COUNT_REWARD"},
-    {3627, "SHARE_GIFT_GET_NEW_USER_REWARD"},
-    {3628, "SHARE_GIFT_GET_LEVEL_REWARD"},
-    {795, "WX_UPDATE_LOGIN_CODE_TO_SERVER"},
-    {1106, "BUILD_REINFORCE_SUB_MARCH"},
-    {4160, "REQUEST_ANNUAL_SUMMARY"},
-    {4161, "GET_POWER_REWARD"},
-    {4168, "Get_Home_Air_Drop_Reward"},
-    {5517, "MECHA_CHIP_LOCK"},
-    {1538, "COMMON_SMS_GET_CODE"},
-    {1539, "COMMON_SMS_VERIFICATION_CODE"},
-    {3703, "KVK_S2_ER_GET_MINE_INFO"},
-    {3704, "KVK_S2_ER_MINE_FIGHT"},
-    {3705, "KVK_S2_ER_RANK_INFO"},
-    {3706, "KVK_S2_ER_MINE_FIGHT_RECORD_INFO"},
-    {1789, "QUICK_PRODUCE_ARMY_EQUIP"},
-    {3160, "ACTIVITY_HERO_LEVEL_UP_GET_REWARD"},
-    {6010, "BEHEMOTH_GET_STAGE_INFO"},
-    {6017, "GET_THRONE_PROTECT_MARCH_INFO"},
-    {6018, "THRONE_PROTECT_BOSS_WEAK"},
-    {6019, "GET_THRONE_PROTECT_BOX_REWARD"},
-    {6011, "BEHEMOTH_ASK_RANDOM_MARCH"},
-    {6012, "BEHEMOTH_INTERECPT_MARCH"},
-    {6013, "BEHEMOTH_ASSEMBLE_GET_REWARD"},
-    {6021, "BEHEMOTH_DONATE"},
-    {1790, "QUICK_MERGE_ARMY_EQUIP_MATERIAL"},
-    {3157, "WORLD_CUP_BET"},
-    {3158, "WORLD_CUP_GET_REWARD"},
-    {3159, "WORLD_CUP_MATCH_INFO"},
-    {5520, "SELECT_MECHA"},
-    {6014, "BEHEMOTH_ACTIVITY_DONATE"},
-    {6015, "BEHEMOTH_ACTIVITY_REWARD"},
-    {6016, "BEHEMOTH_ACTIVITY_PURCHASE"},
-    {6023, "BEHEMOTH_ACTIVITY_SELF_REWARD"},
-    {6025, "BEHEMOTH_ENDING_DONATE"},
-    {6026, "BEHEMOTH_ENDING_REWARD"},
-    {6027, "BEHEMOTH_ENDING_RANK_INFO"},
-    {6028, "BEHEMOTH_ENDING_VOTE"},
-    {6031, "BEHEMOTH_DONATE_SKILL_ENGERY"},
-    {6032, "BEHEMOTH_DONATE_SKILL_LV"},
-    {6033, "BEHEMOTH_DONATE_BUILD_LV"},
-    {6034, "BEHEMOTH_DONATE_ARSENAL_LV"},
-    {6035, "BEHEMOTH_FITHG_STAGE_GET_REWARD"},
-    {6041, "BEHEMOTH_WATCH_VIDEO"},
-    {6036, "BEHEMOTH_GET_ARSENAL_INFO"},
-    {6038, "BEHEMOTH_GET_ARSENAL_REWARD"},
-    {6037, "BUILD_BEHEMOTH_BUFF_TOWER"},
-    {1445, "THIRTYTWO_FINAL_CHAMPION_GUESSING"},
-    {1446, "THIRTYTWO_FINAL_CHAMPION_GUESSING_VOTE"},
-    {1447, "THIRTYTWO_FINAL_CHAMPION_GUESSING_VOTE_GETREWARD"},
-    {1448, "THIRTYTWO_FINAL_CHAMPION_VOTE_GETREWARD"},
-    {6039, "BEHEMOTH_GET_CALL_MONSTER_LIST"},
-    {3941, "PACIFIC_CHALLANGE_BOSS"},
-    {6103, "BORDER_GET_BUILDING_INFO"},
-    {6101, "BORDER_PLAYER_MOVE"},
-    {6104, "BORDER_GET_ACHIEVEMENT_REWARD"},
-    {6108, "BORDER_GET_LEVEL_AREA_INFO"},
-    {6106, "BORDER_GET_FIRST_REWARD"},
-    {6102, "BORDER_GET_SMALL_MAP_INFO"},
-    {6107, "BORDER_GET_BOSS_RANK_REWARD"},
-    {6110, "BORDER_SET_GUIDE"},
-    {6109, "ASK_BEHEMOTH_STATE"},
-    {6040, "BEHEMOTH_GET_BOSS_SKILL"},
-    {6300, "NEW_CAB_GET_BASE_DATA"},
-    {6301, "NEW_CAB_SIGN"},
-    {6302, "NEW_CAB_GET_ALLIANCE_LIST"},
-    {6303, "NEW_CAB_CHANGE_MEMBER_LIST"},
-    {6304, "NEW_CAB_TO_CAB"},
-    {6305, "NEW_CAB_TO_GS"},
-    {6316, "NEW_CAB_PERSONAL_SIGN"},
-    {6306, "AVA_BUILDING_DETAIL"},
-    {6307, "AVA_USE_SKILL"},
-    {6308, "NEW_CAB_GET_SITUATION_INFO"},
-    {6309, "AVA_ARK_INFO"},
-    {6310, "AVA_ASK_HOSPITAL_DATA"},
-    {6311, "AVA_CURE_ALL_ARMYS_DATA"},
-    {6313, "AVA_BATTLE_RESULT"},
-    {6312, "AVA_SPEED_CURE"},
-    {6314, "AVA_MINI_MAP_INFO"},
-    {6315, "AVA_BATTLE_LOG"},
-    {6318, "AVA_LOOK_ROOM_RESULT"},
-    {6317, "AVA_ROOM_MEMBER_LIST"},
-    {6319, "AVA_PERSONAL_LOG"},
-    {6217, "CONQUEROR_WARZONE_MEMBER_RANK"},
-    {6230, "GET_CONQUEROR_DONATE_TASK_AWARD"},
-    {6229, "GET_CONQUEROR_DONATE_ARMY"},
-    {6272, "CONQUEROR_SHOP_INIT"},
-    {6271, "CONQUEROR_SHOP_BUY"},
-    {6237, "CONQUEROR_GET_ARMYCARD"},
-    {6245, "CONQUEROR_CONTRIBUTION_RANK"},
-    {6250, "CONQUEROR_VERIFYARMY_RANK"},
-    {6251, "CONQUEROR_RANK"},
-    {6252, "CONQUEROR_ROUND_RANK"},
-    {6253, "CONQUEROR_HERO_RANK"},
-    {6254, "CONQUEROR_BATTLE_RANK"},
-    {6258, "CONQUEROR_HERO_GET_REWARD"},
-    {6259, "CONQUEROR_DONATE_SCORE_REWARD"},
-    {6261, "CONQUEROR_ACHIEVE_REWARD"},
-    {6262, "CONQUEROR_ACHIEVE_SCORE_REWARD"},
-    {6268, "CONQUEROR_HALL_RANK_CURRENT"},
-    {6269, "CONQUEROR_HALL_RANK_HISTORY"},
-    {3953, "RELIC_ABYSM_DISPATCHED_SOLDIERS"},
-    {6400, "Get_Colosseum_Data"},
-    {6401, "GET_Colosseum_Room_Data"},
-    {6402, "Colosseum_Cross_Fight"},
-    {6403, "Get_Colosseum_Cross_Log"},
-    {6404, "Get_Colosseum_Cross_Pos_Log"},
-    {6405, "Colosseum_Cross_Retreat"},
-    {6411, "GET_Colosseum_Self_Room_Data"},
-    {6412, "Colosseum_Fight"},
-    {6413, "Get_Colosseum_Self_Log"},
-    {6414, "Get_Colosseum_Pos_Log"},
-    {6415, "Colosseum_Self_Retreat"},
-    {7343, "RELIC_MARCH_WORLD_POINT"},
-    {7315, "PURIFICATION_TEAM_MARCH"},
-    {7316, "GET_COLLECTABLE_PURIFICATION"},
-    {7372, "RELIC_GVE_JOIN_RALLY"},
-    {7373, "GET_MARCH_BY_ID_FOR_GVE_CAR"},
-    {7374, "RELIC_GVE_JOIN_EVENT"},
-    {7375, "RELIC_GVE_JOIN_DEFENSE"},
-    {7376, "RELIC_GVE_DEFENSE_MARCH_INFO"},
-    {6320, "TEAM_MATCH_CREATE_TEAM"},
-    {6321, "TEAM_MATCH_RECOMMEND_LIST"},
-    {6322, "TEAM_MATCH_APPLY_JOIN"},
-    {6323, "TEAM_MATCH_GET_MY_APPLY_LIST"},
-    {6324, "TEAM_MATCH_CANCEL_MY_APPLY"},
-    {6325, "TEAM_MATCH_GET_TEAM_APPLY"},
-    {6326, "TEAM_MATCH_DEAL_APPLY"},
-    {6327, "TEAM_MATCH_CHANGE_TEAM_NAME"},
-    {6329, "TEAM_MATCH_EXIT_TEAM"},
-    {6330, "TEAM_MATCH_KICK_TEAM"},
-    {6331, "TEAM_MATCH_CHANGE_POSITION"},
-    {6332, "TEAM_MATCH_CHANGE_PREPARE_STATE"},
-    {6333, "TEAM_MATCH_CHANGE_SIGN"},
-    {6334, "TEAM_MATCH_CHANGE_BATTLE_TIME"},
-    {6335, "TEAM_MATCH_GET_BATTLE_DETAIL"},
-    {6336, "TEAM_MATCH_GET_TEAM_SITUATION"},
-    {6337, "TEAM_MATCH_GET_TEAM_RECORD"},
-    {6338, "TEAM_MATCH_GET_TEAM_RECORD_DETAIL"},
-    {7377, "GET_RELIC_PILLAR_GVE_CAR_RANK"},
-    {3977, "Infinite_Cave_Boss_Fight"},
-    {3632, "GI_JOE_ATTACK_BOSS"},
-    {3633, "GI_JOE_ATTACK_BOSS_CHALLENGE"},
+int WorldSite::siteToKind(int siteId) {
+    if (const GameCatalog *catalog = loadedCatalog()) {
+        return catalog->siteKind(siteId).value_or(WorldSite::种类::未知);
+    }
+    auto e = findById(WorldSiteKinds, siteId);
+    return e != nullptr ? e->kind : WorldSite::种类::未知;
+}
+
+QString WorldSite::kindToString(int kind) {
+    if (kind < 0 || kind >= static_cast<int>(WorldSiteKindsByKind.size())) {
+        return {};
+    }
+    return staticString(WorldSiteKindsByKind[kind].name);
+}
+
+optional<int> WorldSite::kindFromString(QStringView name) {
+    return findByName(WorldSiteKindNames, name);
+}
+
+std::span<const IdName> WorldSite::getKinds() {
+    return WorldSiteKindNames;
+}
 
-    {-1, "ERROR_ID"},
-    {1, "LOGIN"},
-    {2, "USER_DISCONNECT"},
-    {5, "PUSH_KICK_OUT"},
-    {11019, "PUSH_MigrationRole"},
-    {10101, "PUSH_BUILDING"},
-    {10109, "PUSH_BUILDINGS"},
-    {10021, "PUSH_ENERGY"},
-    {10031, "PUSH_REWARD"},
-    {10032, "PUSH_REALNAME"},
-    {10041, "PUSH_EXP"},
-    {10104, "PUSH_AREA"},
-    {10050, "PUSH_QUESTS"},
-    {10051, "PUSH_QUEST"},
-    {10202, "DELETE_ARMY"},
-    {10204, "ARMY_DROP_LIST"},
-    {10205, "ARMY_INFO_LIST"},
-    {10201, "PUSH_ARMY"},
-    {10501, "PUSH_PAYMENT"},
-    {10105, "PUSH_OCCUPATIONS"},
-    {10102, "PUSH_POINT"},
-    {10103, "PUSH_REMOVE_OBSTALCE"},
-    {10106, "PUSH_PEOPLE"},
-    {11037, "PUSH_Hero_Explor_And_State_Change"},
-    {10107, "DROP_BUILDING"},
-    {10709, "PUSH_MAX_ITEM"},
-    {10117, "DROP_BUILDING_LIST"},
-    {10118, "BUILDING_INFO_LIST"},
-    {10111, "PUSH_UNLOCK_OCEAN"},
-    {10203, "PUSH_ArmyBox"},
-    {10401, "PUSH_TOOL"},
-    {10402, "PUSH_ITEMS"},
-    {10701, "PUSH_SHAREBOX"},
-    {10702, "PUSH_TimeDowns"},
-    {10108, "PUSH_AutoCollect"},
-    {10502, "PUSH_EXCHANGE"},
-    {10448, "PUSH_EXCHANGE_ORDERED"},
-    {10510, "PUSH_TIME_CARDS"},
-    {10110, "PUSH_ACChargeLevel"},
-    {10070, "PUSH_LOCAL_NOTIFICATION"},
-    {20005, "PUSH_AIHELP_UNREAD"},
-    {20006, "PUSH_Confirm_Message"},
-    {10019, "USER_MARCH_INFO"},
-    {10007, "MARCH_INFO"},
-    {10008, "Push_PlayerInfo_Update"},
-    {10020, "PUSH_TERRITORY_INFO"},
-    {10413, "PUSH_USE_WORLD_EFFECT_ITEM"},
-    {10163, "MARCH_ATTACKMONSTER_FINISH"},
-    {10169, "WORLD_SITE_PUSH"},
-    {10170, "WORLD_POINT_MARCH_PUSH"},
-    {11107, "WORLD_CITY_POINT_MARCH_PUSH"},
-    {10171, "WORLD_SITES_PUSH"},
-    {10172, "USER_SHIELD_PUSH"},
-    {10173, "PUSH_THRONE_INFO"},
-    {10174, "PUSH_THRONE_KING_GIFT"},
-    {10175, "PUSH_THRONE_TOWER_ATTACK"},
-    {10177, "PUSH_CROSS_FIGHT_SERVER_INFO"},
-    {10178, "PUSH_THRONE_BATTLE_TIME"},
-    {10180, "PUSH_AIRDROP_AIRPLANE"},
-    {10181, "PUSH_AIRDROP_DROP_CHANGE"},
-    {10183, "PUSH_AIRDROP_VOTE_TIME"},
-    {10184, "PUSH_CROSS_SERVER_FIGHT_ZONE_INFO"},
-    {10190, "Push_City_Skin_Interact"},
-    {10191, "Push_City_Skill_Data"},
-    {10119, "ORDER_QUEUE_INFO"},
-    {10120, "ORDER_QUEUES_BATCH_INFO"},
-    {10121, "ARMY_EQUIP_INFO_PUSH"},
-    {10125, "ARMY_GROUP_EQUIP_INFO_PUSH"},
-    {10126, "Push_Treasure_Info"},
-    {10127, "Push_Decoration_Suit"},
-    {10128, "ORDER_QUEUES_BATCH_REMOVE"},
-    {10122, "Treasure_Record_Push"},
-    {10123, "Push_Chapter_Task"},
-    {10124, "Push_Chapter_Task_List"},
-    {10164, "USERARMY_MARCHSTATE"},
-    {10018, "PUSH_TILEINFO"},
-    {10162, "PUSH_ENEMYREFRESH"},
-    {10165, "PUSH_OWNER_WORLD_POINT_INFO"},
-    {10166, "PUSH_WORLD_DESTORYED"},
-    {10167, "PUSH_ATTACK_ARMIES"},
-    {20001, "PUSH_SYSTEM_SOUND_PLAY"},
-    {10266, "MARCH_ATTACKBOSS_FINISH"},
-    {10267, "WORLD_BOSS_APPEAR"},
-    {10268, "WORLD_BOSS_INFO"},
-    {10601, "PUSH_AddFriend"},
-    {10602, "PUSH_DelFriend"},
-    {10603, "PUSH_ADDFriending"},
-    {10604, "PUSH_CANCELADDFriending"},
-    {10001, "PUSH_RESOURCE"},
-    {10002, "PUSH_STRTIPS"},
-    {10012, "PUSH_STAR"},
-    {10301, "Push_PVE"},
-    {10703, "PUSH_DAILY_QUEST_INFO"},
-    {10704, "PUSH_DAILY_QUEST_ALL_INFO"},
-    {10706, "PUSH_CLEAROBSTACLE"},
-    {10707, "PUSH_TILE_PVE"},
-    {10052, "PUSH_NOTICE"},
-    {10263, "PUSH_GAME_NOTICE"},
-    {10264, "PUSH_SINGLE_MAIL"},
-    {1111121212, "PUSH_SHAREBOX_ARMY"},
-    {10670, "PUSH_WORLD_CHAT"},
-    {10801, "PUSH_FreeCoin"},
-    {10520, "WELCOME_REWARD_STATE"},
-    {10511, "PUSH_GROWTH_FUND"},
-    {10410, "PUSH_SHOP_BUY_LIMIT"},
-    {10411, "PUSH_SHOP_BUY_LIMIT_TIME"},
-    {10053, "PUSH_USER_DATA_COMMON"},
-    {10054, "PUSH_NOTICE_PARA"},
-    {10057, "PUSH_COMMON_MESSAGE"},
-    {10420, "PUSH_ALLIANCE_INFO"},
-    {10421, "PUSH_ALLIANCE_KICKED"},
-    {10422, "PUSH_ALLIANCE_RANK_CHANGE"},
-    {10423, "PUSH_ALLIANCE_INFO_CHANGE"},
-    {10424, "PUSH_ALLIANCE_APPLY_CHANGE"},
-    {10425, "PUSH_ALLIANCE_APPLY_ACCEPTED"},
-    {10426, "PUSH_ALLIANCE_HELP_DATA"},
-    {10427, "PUSH_ALLIANCE_HELP_ADD"},
-    {10428, "PUSH_ALLIANCE_HELP_REMOVE"},
-    {10429, "PUSH_ALLIANCE_MEMBER_DYNAMIC"},
-    {10056, "PUSH_ALLIANCE_BUFF"},
-    {10055, "PUSH_BUFF"},
-    {10460, "PUSH_STATE"},
-    {10802, "PUSH_FIND_REFUGEECAMP"},
-    {10803, "PUSH_ITEM_GET_MONSTER"},
-    {10362, "PUSH_COUNTRY_NOTICE_INFO"},
-    {10430, "PUSH_ALLIANCE_SCIENCEDATA"},
-    {10432, "PUSH_ALLIANCE_DIAMOND_DONATE_NUM"},
-    {10433, "PUSH_ALLIANCE_SHOP"},
-    {10434, "PUSH_ALLIANCE_BUILDING_CHANGE"},
-    {10436, "PUSH_ALLIANCE_MOVE_INVITE"},
-    {10443, "PUSH_ALLIANCE_MEMBER_INVITE_ADD"},
-    {10444, "PUSH_ALLIANCE_MEMBER_INVITE_DELETE"},
-    {10445, "PUSH_ALLIANCE_MEMBER_INVITE_DELETEALL"},
-    {10446, "PushAllianceSelfHelpList"},
-    {10435, "PUSH_ALLIANCE_BOSS"},
-    {10503, "PUSH_PAY_TO_SERVER"},
-    {10506, "PUSH_PAY_CHECK_NOT_ENOUGH"},
-    {11e3, "PUSH_CHATROOM_CHANGE"},
-    {10710, "SCIENCE_SHARE_NEWUSER"},
-    {10711, "SCIENCE_SHARE_USER"},
-    {10712, "SHARE_PUSH"},
-    {10901, "PUSH_ACTIVITY_STATE"},
-    {10902, "PUSH_TREASURE_TIME"},
-    {10903, "PUSH_BUILDING_BOX"},
-    {10904, "PUSH_ONE_ACTIVITY"},
-    {11001, "PUSH_BIND_ACCOUNT"},
-    {11005, "PUSH_SET_APP_PLAYERINFO"},
-    {20003, "PUSH_FORCE_CONFIG_UPDATE"},
-    {12e3, "PUSH_ALLIANCE_Assembly"},
-    {12001, "PUSH_ALLIANCE_Assembly_DEL"},
-    {12002, "PUSH_ALLIANCE_Assembly_Success"},
-    {10915, "PUSH_HERO_BOND_CHANGE"},
-    {12003, "PUSH_ALLIANCE_Assembly_Created"},
-    {12004, "PUSH_ALLIANCE_Assemblyed"},
-    {10905, "PUSH_CASTLE_FACE_CHANGE"},
-    {11011, "PUSH_CASTLE_EFFECT_CHANGE"},
-    {13401, "PUSH_OPC_STATE_CHANGE"},
-    {10907, "PUSH_CASTLE_NAMEPLATE_CHANGE"},
-    {10908, "PUSH_CASTLE_ARMYLINE_CHANGE"},
-    {10909, "PUSH_HEADFRAMES_CHANGE"},
-    {10906, "PUSH_HERO_INFO"},
-    {11036, "PUSH_HERO_STATE_CHANGE"},
-    {10910, "PUSH_HERO_SKIN_GET"},
-    {10911, "PUSH_HERO_SKIN_CHANGE"},
-    {10913, "PUSH_HERO_DELETE"},
-    {10470, "PUSH_HERO_ACTIVE_SKILL_INFO"},
-    {10713, "EVERYDAYREWARD_UPDATE_PUSH"},
-    {11002, "PUSH_VIP_CHANGE"},
-    {10504, "PUSH_FIRST_CHARGE_BENEFIT_CHANGE"},
-    {11003, "MINE_INFO"},
-    {10512, "DUBBING_INFO"},
-    {10513, "WORLD_BGM_INFO"},
-    {11022, "G123_ORDER_TOKEN"},
-    {10437, "ALLIANCE_EXCHANGE_ADD"},
-    {10438, "ALLIANCE_EXCHANGE_HELPED"},
-    {10439, "ALLIANCE_EXCHANGE_CANCELED"},
-    {10440, "ALLIANCE_EXCHANGE_REMOVE"},
-    {10441, "ALLIANCE_CHAT_REWARD_PUSH"},
-    {10442, "PUSH_ALLIANCE_GIFT_INFO"},
-    {10457, "PUSH_ALLIANCE_WORLDSITE_ATTACK"},
-    {10921, "PUSH_HERO_PICK_CONFIG"},
-    {11004, "LIMIT_GIFT_POP"},
-    {11025, "Push_Ship_Unlock"},
-    {10720, "PUSH_UPDATA_DAILY_REQUEST"},
-    {10721, "Push_WorldTreasure_Result"},
-    {10717, "GROW_ROAD_INFO"},
-    {10716, "GROW_ROAD_SUPER_FLAG"},
-    {10714, "GROW_ROAD_ALL_TASK_INFO"},
-    {10715, "GROW_ROAD_UPDATED_TASK_INFO"},
-    {13e3, "PUSH_SERVER_STATE"},
-    {13001, "PUSH_RESTART_GAME"},
-    {10505, "FIRST_PAY_CNY"},
-    {10718, "ACTIVITY_SUMMER_LOTTERY_INFO"},
-    {10719, "PUSH_WORLD_TREASURE_QUEST"},
-    {10722, "PUSH_COUNTRY_BOSS_DATA"},
-    {10723, "PUSH_PRODUCT_COMPLETE"},
-    {11033, "PUSH_UPDATE_CREDIT"},
-    {11034, "PUSH_MARCH_ARRIVE_EFFECT"},
-    {11006, "ACTIVITY_REVERSE_CARD"},
-    {11007, "ACTIVITY_LUCKY_DRAW_RESET"},
-    {11101, "PROFESSION_CHANGED_PUSH"},
-    {11102, "DEF_ARMY_CANDIDATE_INFO"},
-    {11009, "PUSH_SHOPPOINT_ACTIVITY"},
-    {10182, "PUSH_MY_PROFESSIONAL_TOWERS"},
-    {11103, "USER_MONSTER_SIEGE_INFO"},
-    {11104, "ALLIANCE_MONSTER_SIEGE_INFO"},
-    {11012, "PUSH_MOD_CHANGE"},
-    {10514, "DEGENERATOR_INFO_PUSH"},
-    {10515, "DEGENERATOR_MAIL_PUSH"},
-    {10516, "DEGENERATOR_REFRESH_PUSH"},
-    {10517, "PUSH_BUY_SCENE_GIFT_IDS"},
-    {13002, "WORLDBATTLE_SCORE_PUSH"},
-    {11013, "Push_Protect_Data"},
-    {11024, "Push_Paypay_Event"},
-    {11014, "PUSH_MILITARY_RANK"},
-    {11015, "MILITARY_RANK_SHOPS"},
-    {10912, "PUSH_ONE_ACTIVITYEXTRA"},
-    {10914, "PUSH_ALLIANCEBP_ACTIVITYPOINT"},
-    {11016, "Push_PresetMarchData"},
-    {11018, "Push_AdventureData"},
-    {11200, "GROUP_CHAT_CFG_CHANGE"},
-    {11201, "GROUP_CHAT_MEMBER_CHANGE"},
-    {10412, "PUSH_SALE_NUM_CHANGE"},
-    {10722, "FORMULA_MAKE_COMPLETE"},
-    {11105, "DEF_TRAPS_SLOTS_INFO"},
-    {20002, "POTION_USE_EFFECT"},
-    {11030, "PUSH_WORLDEMOJI_CHANGE"},
-    {11031, "PUSH_WORLDEMOJI_INIT"},
-    {11029, "PUSH_WORLDEMOJI_USE"},
-    {11108, "PUSH_WORLD_MARCH_EMOJI_USE"},
-    {20004, "PUSH_FAQ"},
-    {13200, "EIGHT_COUNTRY_STATUS"},
-    {13201, "KVK_ALLIANCE_BUILDING_STATUS_CHANGE"},
-    {13202, "KVK_ALLIANCE_INFO_CHANGE"},
-    {13203, "KVK_COUNTRY_INFO_CHANGE"},
-    {13204, "KVK_INFO_CHANGE"},
-    {13211, "EC_PREPARE_INFO_PUSH"},
-    {13501, "SEASON_MATCH_INFO_PUSH"},
-    {13212, "KVK_ACHEVEMENT_CHANGE"},
-    {13213, "KVK_FINISH_CHANGE"},
-    {13214, "KVK_PROGRESS_CHANGE"},
-    {13215, "KVK_EXPEDITION_FINISH_CHANGE"},
-    {10059, "DECORATE_STOREHOUSE_CHANGE"},
-    {11017, "GUN_FIGHT_INFO"},
-    {10447, "ALLIANCE_BADGE_AND_TASK_RED_DOT"},
-    {10449, "ALLIANCE_MOVE_CITY_BY_SYS"},
-    {10060, "Push_Status_Buff"},
-    {10267, "AREAN_CONFIG_PUSH"},
-    {10268, "CROSS_AREAN_CONFIG_PUSH"},
-    {10724, "TREASURE_MAP_DATA_REMOVE"},
-    {10725, "TREASURE_MAP_DATA_ADD"},
-    {10726, "TREASURE_MAP_DATA_UPDATE"},
-    {10727, "TREASURE_MAP_TASKS"},
-    {10179, "KING_MARK_PUSH"},
-    {10728, "EXPLORE_SEA_LEGEND_BOX_NOTICE"},
-    {10061, "AD_CAMPAIGN_SYNC"},
-    {10062, "Push_All_Science"},
-    {13216, "EIGHT_COUNTRY_STRONGEST_LEADER"},
-    {13217, "EIGHT_COUNTRY_CHANGE_TASK"},
-    {11021, "Push_New_Treasure_Piece_Log"},
-    {11028, "GLORIOUS_TRAINING_INFO"},
-    {11027, "Push_Transport_Effect_Data"},
-    {12005, "PUSH_BVACKEND_EVENT"},
-    {13301, "CAB_HOSPITAL_CHANGE"},
-    {13302, "CAB_ALLIANCE_BASE_INFO"},
-    {13306, "CAB_MINI_MAP_DATA"},
-    {13307, "CAB_BATTLE_RESULT"},
-    {13308, "CAB_ROOM_BASE_INFO"},
-    {10450, "ACT_ALLIANCE_BUILDING_STATUS_CHANGE"},
-    {13309, "CAB_BOMB_CAR_BOMB"},
-    {13310, "CAB_SHOP_BUY_TIMES"},
-    {13003, "CSB_SHOP_BUY_TIMES"},
-    {11032, "GIFT_ADD_LIST_PUSH"},
-    {20007, "SERVER_SCHEDULE_PUSH_INFO"},
-    {20008, "SERVER_SCHEDULE_TASK_INIT"},
-    {20009, "SERVER_SCHEDULE_TASK_COMPLETE"},
-    {20017, "SERVER_SCHEDULE_TASK_UPDATE"},
-    {10414, "EXCLUSIVE_SKILL_BUY_PUSH"},
-    {20010, "THIRTY_DAYS_PUSH"},
-    {13004, "CSB_HOSPITAL_QUEUE_CLEAR"},
-    {13005, "CSB_HOSPITAL_QUEUE_DELETE"},
-    {13006, "CSB_HOSPITAL_QUEUE_ADD"},
-    {13007, "CSB_HOSPITAL_QUEUE_MODIFY"},
-    {11020, "HEAD_PUSH"},
-    {11021, "EMOTION_PUSH"},
-    {10729, "QQGAME_VIP_PRIVILEGE"},
-    {20025, "RADAR_RING_CHANGE"},
-    {20018, "RADAR_GROUP_CHANGE"},
-    {20019, "RADAR_GROUP_EVENT_NUM_CHANGE"},
-    {20026, "RADAR_DAYGROUP_EVENT_NUM_CHANGE"},
-    {20013, "RADAR_STATUS_CHANGE"},
-    {20012, "RADAR_TIMEOUT_CHANGE"},
-    {20011, "PUSH_VIP_FREE_REWARD_UPDATE"},
-    {20015, "RADAR_ADD_ONE_TASK"},
-    {20016, "RADAR_OTHER_DATA_CHANGE"},
-    {13218, "KVK_SCIENCE"},
-    {10452, "PUSH_ALLIANCE_RECORD"},
-    {10112, "PUSH_WAITING_AREAS"},
-    {20034, "BULLION_CHANGE"},
-    {10730, "PUSH_AREA_WAR_V3"},
-    {10917, "PUSH_G123_HINATAZAKA_VIDEO_UNLOCK"},
-    {20014, "Push_G123_MONTHLY_PAY"},
-    {20020, "PUSH_MARCH_RESULT"},
-    {20021, "PUSH_RADAR_SIGN"},
-    {20023, "PUSH_USER_ROLE_LIST_DETAIL"},
-    {20024, "PUSH_Wade_Sign"},
-    {10518, "LIMITED_TIME_OFFER_SCORE_EXCHANGE"},
-    {11106, "PUSH_CAREER_SELECTION_INFO"},
-    {13251, "THRITEEN_TWO_MODE_CHANGE"},
-    {13253, "THRITEEN_TWO_VOTE_TIME_CHANGE"},
-    {13254, "THIRTY_TWO_VOTE_INFO_UPDATE"},
-    {13219, "PUSH_EC_POWER_BUFF"},
-    {13220, "Push_Hot_Spring_State"},
-    {13221, "Push_SG_Hot_Spring_State"},
-    {10129, "PUSH_UPDATE_ARMY_EQUIPS"},
-    {20027, "PUSH_STAMP"},
-    {10453, "ALLIANCE_HELP_REGET"},
-    {20028, "HERO_DRESS_GOT"},
-    {11038, "ADD_EMPIRE_TREASURE_RANK"},
-    {11039, "TRIGGER_PUSH_GIFT"},
-    {20030, "DAILY_LOGIN_PUSH_GIFT"},
-    {11040, "PUSH_EQUIP_LIST"},
-    {10455, "PUSH_ALLIANCELEADER_TRANSFER"},
-    {10456, "Push_Alliance_Free_Zone"},
-    {10363, "Push_Alliance_Skill"},
-    {10269, "CROSS_AREAN_4C_CONFIG_PUSH"},
-    {13206, "CHANGE_BUFF_PUSH"},
-    {20029, "PUSH_RECOMPILE_TABLE"},
-    {20032, "PUSH_ONE_MECHA_CHANGE"},
-    {20033, "PUSH_ONE_MECHA_PART_CHANGE"},
-    {10022, "PUSH_MECHA_TASK"},
-    {20035, "PUSH_MECHA_CHIP_UPDATE"},
-    {20040, "PUSH_MECHA_SKIN_UPDATE"},
-    {20031, "PUSH_CHAT_MUTE"},
-    {11041, "PUSH_HERO_SKILL_TIPS"},
-    {10271, "PUSH_FR_WORLD_BOSS_STATUS"},
-    {10065, "PUSH_SPE_BUFF_UPDATE"},
-    {20037, "PUSH_DECORATE_ACTIVITY_ID"},
-    {20036, "PUSH_USER_FACE_VERIFY"},
-    {20039, "PUSH_WEB_GAME_FACE_VERIFY_RESULT"},
-    {20038, "PUSH_REFRESH_STORE_PRICES"},
-    {20041, "PUSH_REFRESH_RADAR_STRORY_TASKING"},
-    {10364, "PUSH_NEWEST_ALLIANCE_INSTRUCT_DATA"},
-    {20042, "PUSH_WAREHOUSE_UPDATE"},
-    {20043, "PUSH_BIND_SMS_UPDATE"},
-    {11042, "PUSH_ITEM_GUARANTEE"},
-    {13222, "PUSH_ER_MINE_UPDATE"},
-    {20044, "PUSH_WORLD_CUP_INFO"},
-    {21004, "PUSH_BEHEMOTH_STAGE_CHANGE"},
-    {21007, "PUSH_BEHEMOTH_ARSENAL_CHANGE"},
-    {21009, "PUSH_BEHEMOTH_DEFEND_BOSS_ATTACK"},
-    {21008, "PUSH_BEHEMOTH_ATTACK_MONSTER"},
-    {21010, "PUSH_BEHEMOTH_CALL_MONSTER_LIST"},
-    {21011, "PUSH_BEHEMOTH_BUFF_BUILDING_KICK_ALL"},
-    {21022, "PUSH_BORDER_WAR_CENTER_AREA_CHANGE"},
-    {21024, "PUSH_BORDER_LEVEL_CHANGE"},
-    {21021, "BORDER_WAR_USER_INFO_CHANGE"},
-    {11202, "PUSH_GROUP_CHAT_COLLECT_CHANGE"},
-    {21025, "BORDER_GORILLA_SURRENDER"},
-    {10023, "LOGIN_PANNEL_LIMIT"},
-    {21101, "PUSH_STORY_SEND_RED"},
-    {21200, "NEW_CAB_ALLIANCE_BASE_INFO"},
-    {21201, "MAF_BATTLE_SKILL_INFO"},
-    {21202, "NEW_CAB_BATTLEGROUND_BASE_INFO"},
-    {21206, "TEAM_MATCH_BATTLEGROUND_BASE_INFO"},
-    {21203, "New_CAB_HOSPITAL_CHANGE"},
-    {21204, "AVA_MINI_MAP_DATA"},
-    {21205, "AVA_BATTLE_RESULT"},
-    {10071, "PUSH_UID_CREATED_SHOW_TIP"},
-    {21300, "PUSH_COLOSSEUM_BATTLE_DATA"},
-    {21207, "TEAM_MATCH_AIR_PLANE"},
-    {21401, "PUSH_Player_Back_Data"},
-    {21402, "PUSH_Player_Back_Account_Data"},
-};
 
 const char* rqstIdToString(int rqstId) {
-    static std::map<int, const char*> m{std::begin(RqstIdData), std::end(RqstIdData)};
-    if (auto it = m.find(rqstId); it != m.end()) {
-        return it->second;
-    } else {
-        static std::string s;
-        s = std::to_string(rqstId);
-        return s.c_str();
+    auto it = std::lower_bound(std::begin(RqstIdsById), std::end(RqstIdsById), rqstId,
+                               [](const RqstIdName &e, int id) { return e.id < id; });
+    if (it != std::end(RqstIdsById) && it->id == rqstId) {
+        return it->name.data();
+    }
+    // per thread, valid until the next call in the same thread
+    static thread_local char buf[16];
+    *std::to_chars(std::begin(buf), std::end(buf) - 1, rqstId).ptr = '\0';
+    return buf;
+}
+
+optional<int> rqstIdFromString(std::string_view name) {
+    auto it = std::lower_bound(std::begin(RqstIdsByName), std::end(RqstIdsByName), name,
+                               [](uint16_t i, std::string_view name) { return RqstIdsById[i].name < name; });
+    if (it != std::end(RqstIdsByName) && RqstIdsById[*it].name == name) {
+        return RqstIdsById[*it].id;
     }
+    return {};
 }
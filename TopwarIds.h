@@ -2,6 +2,9 @@
 
 #include <QObject>
 #include <QMetaEnum>
+#include <optional>
+#include <span>
+#include <string_view>
 #include "common.h"
 
 constexpr double Pow10(int exp) {
@@ -22,17 +25,20 @@ constexpr double operator ""_ff(long double val) { return val * Pow10(3*10); }
 constexpr double operator ""_gg(long double val) { return val * Pow10(3*11); }
 constexpr double operator ""_hh(long double val) { return val * Pow10(3*12); }
 
-inline QString formatNumber(double val, int precision = 2) {
-    constexpr const char* Units[] = {
-        "", "K", "M", "B", "T",
-        "aa", "bb", "cc", "dd", "ee", "ff",
-        "gg", "hh", "ii", "jj", "kk", "ll"
-    };
-    int exp = static_cast<int>(std::log10(val));
-    int unitIdx = exp / 3;
+// Longest output of formatNumber(val, precision, out)
+constexpr int FormatNumberMaxLen = 40;
+
+/**
+ * Writes val with a unit per factor of 1000 (K, M, B, T, aa, bb, ...) to out,
+ * which has room for FormatNumberMaxLen characters, and returns the length.
+ * Allocates nothing, for formatting numbers into log lines.
+ */
+qsizetype formatNumber(double val, int precision, char16_t *out);
 
-    double t = val / std::pow(10, unitIdx * 3);
-    return QString::number(t, 'f', precision) + Units[unitIdx];
+inline QString formatNumber(double val, int precision = 2) {
+    char16_t buf[FormatNumberMaxLen];
+    qsizetype len = formatNumber(val, precision, buf);
+    return QString{reinterpret_cast<const QChar*>(buf), len};
 }
 
 
@@ -42,7 +48,15 @@ const char* QEnumToString (const QEnum value) {
 }
 
 
+// An id with its display name, the text is static
+struct IdName {
+    int id;
+    QStringView name;
+};
+
+// "item_<id>" for unknown items
 QString getItemName(int itemId);
+optional<int> itemIdFromName(QStringView name);
 
 
 namespace AllianceScience {
@@ -75,42 +89,18 @@ enum {
     空军攻击 = 20900,
 };
 
-extern const QString& toString(int scienceId);
-extern const std::vector<pair<int, QString>>& getValues();
+// The id as text for unknown sciences
+QString toString(int scienceId);
+optional<int> fromString(QStringView name);
+// In display order, starting with Unknown
+std::span<const IdName> getValues();
+// 1 for unknown sciences
 int getMaxLevel(int scienceId);
 
 } // END namespace AllianceScience
 
 
 namespace WorldSite {
-enum {
-    资源1 = 148,
-    资源2 = 152,
-    守卫1 = 146,
-    守卫2 = 150,
-    道具1 = 134,
-    道具2 = 144,
-    士兵1 = 131,
-    士兵2 = 141,
-    任务1 = 126,
-    任务2 = 136,
-    宝藏1 = 129,
-    宝藏2 = 139,
-
-    金币1 = 102,
-    金币2 = 124,
-    采集1 = 106,
-    采集2 = 120,
-    全军生命1 = 110,
-    全军生命2 = 122,
-    全军攻击1 = 104,
-    全军攻击2 = 116,
-    急速追击1 = 108,
-    急速追击2 = 118,
-    交叉火力1 = 112,
-    交叉火力2 = 114,
-};
-
 enum 种类 {
     未知,
     资源,
@@ -127,9 +117,13 @@ enum 种类 {
     交叉火力,
 };
 
+// 未知 for unknown sites
 extern int siteToKind(int siteId);
-extern const QString& kindToString(int kind);
-extern const std::vector<pair<int, QString>>& getKinds();
+// Empty for unknown kinds
+QString kindToString(int kind);
+optional<int> kindFromString(QStringView name);
+// In display order, starting with 未知
+std::span<const IdName> getKinds();
 
 } // END namespace WorldSite
 
@@ -144,1808 +138,14 @@ enum {
 } // END namespace EnergyType
 
 
-namespace TopwarRqstId {
-enum {
-    NO_QUEUE_HEART=0,
-    LOGIN=1,
-    LOGIN_OVER=82,
-    User_Action_Time_Mark=83,
-    HEART=98,
-    BUILD_BUILDING=100,
-    BUILD_ORDER=101,
-    GET_ORDER=102,
-    BUILD_STATE_UP=103,
-    BUILD_MOVE=104,
-    CHANGE_POSITION=120,
-    BUY_COIN_FROM_MACHINE=121,
-    UNLOCK_AREA_WAR=117,
-    PRODUCT_SPEEDUP=106,
-    TENURE=107,
-    VISIT=108,
-    ARMY_MOVE=110,
-    DELETE_BUILDING=111,
-    DELETE_ARMY=112,
-    BUILD_REPAIR=113,
-    SPEED_ARMY=118,
-    AUTO_COLLECT_GOLD_LEVEL_UP=126,
-    ORDER_QUEUE_SPEED_UP=124,
-    ARMY_SPEED_ALL=125,
-    ARMY_SPEED_SELECT=143,
-    ORDER_QUEUE_ADD=122,
-    ORDER_QUEUE_ALL_DONE=123,
-    ORDER_QUEUE_ING_DONE=151,
-    NewBuilding_ByItem=127,
-    Get_BuildBoxesData=128,
-    Build_ByBox=129,
-    Build_Box_MERGE=130,
-    Build_In_Box=131,
-    Builds_In_Box=132,
-    Group_Builds_In_Box=182,
-    ErrorBuilds_In_Box=133,
-    GOLD_ORDER_QUEUE_ADD=134,
-    USE_PROP_SPEED_ARMY=135,
-    Build_Box_Resolve=136,
-    ARMY_MERGE=203,
-    ARMY_HEAL=206,
-    ARMY_CANCEL_PRODUCE=207,
-    ARMY_CANCEL_PRODUCE_ALL=144,
-    Treasure_Repair=145,
-    Explode_Vein=146,
-    Treasure_Piece_Repair=147,
-    Treasure_Piece_Log_Get=148,
-    Treasure_Piece_Log_Delete=149,
-    Get_Home_Building_Reward=150,
-    INSTALL_ARMY_EQUIP=209,
-    TAKEOFF_ARMY_EQUIP=210,
-    COMPOSE_ARMY_EQUIP=211,
-    UNLOCK_ARMY_EQUIP_POS=213,
-    CHANGE_ARMY_EQUIP_GROUP=227,
-    GET_ARMY_EQUIP_GROUP=228,
-    LEVEL_UP_INIT_ARMY_EQUIP=214,
-    IMM_LEVEL_UP_INIT_ARMY_EQUIP=215,
-    ARMY_FIX_INBOX=216,
-    BUILDING_MERGE=116,
-    ARMY_BATCH_MERGE=205,
-    BUILDING_BATCH_MERGE=119,
-    QUEST_COMPLETE=301,
-    DAILY_QUEST_REFRESH=302,
-    GET_DAILY_QUEST_REWARD=303,
-    GET_DAILY_QUEST_BOX_REWARD=304,
-    FAST_FINISH_DAILY_QUEST=305,
-    GET_WORLD_TREASURE_QUEST=306,
-    REFRESH_WORLD_TREASURE_QUEST=307,
-    RECEIVE_WORLD_TREASURE_QUEST=308,
-    Chapter_Task_Complete=309,
-    Chapter_Task_Donate=310,
-    Chapter_Complete=311,
-    GET_QUEST_DATA=312,
-    ShareId=601,
-    PublicAddressReweard=602,
-    FavWxReweard=603,
-    SendPayToServer=701,
-    DEV_SendPayToServer=702,
-    CRYSTAL_SendPayToServer=705,
-    GetG123PayInfo=703,
-    SendPayToServer_toutiao=706,
-    CashCouponPay=707,
-    RequestPayServer_wanba=708,
-    RequestPayServer_wxios=2016,
-    SendPayToServer_ios=711,
-    SendPayToServer_google=712,
-    SendPayToServer_googleplaypoint=2018,
-    RequestPayServer_oppo=713,
-    RequestPayServer_vivo=714,
-    RequestPayServer_huawei=718,
-    SendPayToServer_ios_v1=715,
-    SendPayToServer_googleplay_v1=716,
-    CheckConsumedOrders_googleplay=717,
-    SendPayToServer_huaweiglobal=721,
-    SendPayToServer_huaweiglobal_v1=721,
-    SYNC_APPWX_PLAYER_INFO=1500,
-    SYNC_APPQQ_PLAYER_INFO=1501,
-    SYNC_APPFB_PLAYER_INFO=1505,
-    PLAYER_PAY_USD_DOLLAR=2017,
-    Fix_GP_Account=1512,
-    VideoRewardCommon=800,
-    BuyEnergry=801,
-    UpdatePlayerInfo=802,
-    GetSignReward=803,
-    ITEM_USE=815,
-    ITEM_DELETE=812,
-    Item_Compose=817,
-    Science_LevelUp=816,
-    ARMY_HELP=204,
-    ARMY_HELP_ALL=221,
-    Get_Assistance_Data=222,
-    BindUserAccount=869,
-    UnBindUserSNS=1510,
-    BindUserSNS=1511,
-    IG_ACCOUNT=2024,
-    BindSNSInfo=1513,
-    SwitchAccountSNS=1514,
-    UnBindSNSNEW=1515,
-    GET_AIHELP_UNREAD=1517,
-    RESET_AIHELP_UNREAD=1518,
-    GET_DOWNLOAD_GIFT=1651,
-    LimitedShopRefresh=870,
-    Limit_Shop_Buy=871,
-    BindAccountReward=872,
-    G123BindAccountReward=1516,
-    PlatformActivityState=1394,
-    FreeCoinShare=819,
-    FreeCoinReward=820,
-    ShareDoubleArmy=823,
-    ShareRewardBoxReceive=824,
-    GetTimeReward=825,
-    SetMaxItem=828,
-    ShareScience=831,
-    PromotionOP=840,
-    VideoRewardGet=834,
-    ClickSharebox=804,
-    GetShareBoxReward=805,
-    GetShipRewardByCoolDown=1739,
-    StartShipRewardByCoolDown=1738,
-    ShareBoxs=806,
-    RENDUOLILIANGDA=807,
-    DailyQuests=808,
-    RefreshDailyQuests=809,
-    GetDailyTaskReward=810,
-    SpeedDailyTask=811,
-    GetDailyTaskBoxReward=812,
-    DelFriendPowerItem=813,
-    AddFriend=501,
-    DelFriend=502,
-    ReplayAllFriending=506,
-    SendCrystalToFriend=507,
-    AddFriending=503,
-    ReplyFriending=505,
-    GetCrossFriend=508,
-    GoldBuyItem=818,
-    GoldGetWelcomeReward=821,
-    VIDEO_GET_GOLD=822,
-    GROWTH_FUND_GET_REWARD=751,
-    RemoveHomeObstaclePoint=109,
-    ARMY_UNLOCK=200,
-    ARMY_LEVELUP=201,
-    ARMY_PUT=202,
-    STARTADVENTURE=400,
-    ADVENTURECLICK=401,
-    STARTA_PVE_OBSTACLE=414,
-    STARTA_PVE_OBSTACLE_ATTACK=415,
-    NBATTLE_START_PVE_OBSTACLE=420,
-    NBATTLE_START_PVE_JELLY=421,
-    WORLDMAP_SCOUT=416,
-    WORLDMAP_SUPER_SCOUT=417,
-    BattleReward=405,
-    ADVENTURE=300,
-    SaveGuideStep=814,
-    PostChatMsg=670,
-    RequestPrivateChat=675,
-    RequestPrivateUsers=676,
-    DeletePrivateUser=677,
-    ReadChatInfo=678,
-    ChatReport=679,
-    ChatGroupCreat=940,
-    ChatGroupExit=941,
-    ChatGroupSettingChange=942,
-    ChatGroupInvite=943,
-    ChatGroupGetList=944,
-    ChatGroupRead=945,
-    ChatGroupDelteSomeOne=947,
-    ChatGroupCollect=948,
-    ChatGroupGetInviteList=946,
-    ChatReportNew=1395,
-    HeadIconReport=696,
-    SyncAppPushToken=691,
-    SyncPushSwitch=693,
-    SyncNotifySwitch=1392,
-    GetEmotionList=1607,
-    GetServerAvatar=1611,
-    GET_WORLD_INFO=901,
-    MARCH_WORLD_POINT=902,
-    CHOOSE_WORLD_AREA=903,
-    RECALL_MARCH=904,
-    LEAVE_WORLDMAP=1000,
-    GET_TERRITORY_INFO=1001,
-    GET_OWNER_TERRITORY_INFO=1002,
-    GET_MARCH_TIME=905,
-    WORLD_SEARCH_MONSTER=906,
-    WORLD_DESSTORYED_CONFIRM=907,
-    WORLD_GETPLAYER_INFO=908,
-    GET_PLAYER_POINT=909,
-    PeaceShieldHandler=910,
-    MOVE_CITY_POSITION=911,
-    GET_MARCH_INFO=912,
-    GET_MYWORLDCITY_SHIELD=916,
-    GET_JION_ALL_RCTIME=1026,
-    POWER_RANK=650,
-    ALLIANCE_POWER_RANK=651,
-    GET_WORLD_RANK=652,
-    PLAYER_INFO=630,
-    SendFBAppRequestId=640,
-    GetFBAppRequestReward=641,
-    GET_SERVER_EXCHANGE=700,
-    GET_SERVER_ORDERED_EXCHANGE=709,
-    GET_TIMECARD_REWARD=750,
-    GET_CUSTOMCARD_REWARD=757,
-    SET_SHARE_TIMES=829,
-    GET_SHARE_TIMES=830,
-    CHANGE_PROVINCE=832,
-    CHANGE_NICK_NAME=835,
-    CHANGE_USER_GENDER=851,
-    CHANGE_AVATAR=1304,
-    NOTICE_REGIST=838,
-    GET_ACTIVITY_DATA=841,
-    GET_ACTIVITY_REWARD=842,
-    GET_ACTIVITY_RANK=843,
-    GET_ACTIVITY_ALLSEVER_RANK=839,
-    GET_ACTIVITY_REWARD_RANK=844,
-    ACTIVITY_VALENTINE_GIVE=845,
-    GET_SHAREBOX_ACTIVITY_REWARD=846,
-    GET_CONVERT_REWARD=860,
-    GET_USER_SERVERLIST=847,
-    CHANGE_SERVER=848,
-    RECALL_ACT_REWARD=849,
-    ACTIVITY_KING_BOX_REWARD=850,
-    GET_MY_CASTLE_FACE=854,
-    USE_CASTLE_FACE=855,
-    GET_ALL_MY_MARCH_INFO=856,
-    CHARACTER_DELETE=857,
-    CASTLE_COLLECT_REWARD=1343,
-    CHANGE_NATIONAL_FLAG=1344,
-    GET_ShakeMoneyTreeData=836,
-    ShakeMoneyTreeData=837,
-    FAVORITE_ADD=913,
-    FAVORITE_DELETE=914,
-    FAVORITE_GET_LIST=915,
-    getBossInfo=917,
-    GET_WORLD_BOSS_RANK=918,
-    GET_BOSS_ATTACK_INFO=919,
-    MARCH_SPEED_UP=920,
-    MAIL_GET_LIST=921,
-    MAIL_DROP=922,
-    MAIL_FAVORITE=923,
-    MAIL_READ=924,
-    MAIL_SEND=925,
-    MAIL_GETREWARD=926,
-    MAIL_GETREPORT=927,
-    MAIL_UNREAD=928,
-    MAIL_QUERY=929,
-    MAIL_CONTINUE_ATTACK=932,
-    MAIL_nGetGroupList=933,
-    MAIL_nUnreadCount=934,
-    MAIL_nGetNewMails=935,
-    Mail_nReadedAllMails=936,
-    Mail_nDeleteShowTypeAll=937,
-    MAIL_nUnreadCount_Now=938,
-    MAIL_nRewardCount_Now=939,
-    GET_GAME_NOTICE=930,
-    VOTE_GAME_NOTICE=931,
-    GET_FAQ=2000,
-    GET_FORUM_TOKEN=2011,
-    VOTE_FAQ=2001,
-    GET_VIP_DAY_REWARD=2002,
-    QUERY_RANK_CHALLENGE_INFO=960,
-    QUERY_ARMY_RANK_LIST=961,
-    ARMY_RANK_FLUSH=962,
-    ARMY_RANK_CHALLENGE=963,
-    ARMY_RANK_PRIZE=964,
-    ARMY_RANK_BUY_CHALLENGE_NUM=965,
-    MILITARY_BATTLE_HISTORY=966,
-    ALLIANCE_GET_STATES=950,
-    ALLIANCE_GET_DETAIL=951,
-    ALLIANCE_GET_ROLES=952,
-    ALLIANCE_PVP=953,
-    ALLIANCE_CHANGE_COLOR=954,
-    ALLIANCE_CHANGE_NOTICE=955,
-    ALLIANCE_BUF_GET_GOLD=956,
-    ALLIANCE_GET_PLAYERINFO=957,
-    ALLIANCE_GET_ALL_COORDS=1003,
-    GET_WORLD_SITE_DATA=1004,
-    GET_WORLD_POINT_MARCH=1005,
-    WORLD_SITE_GIVEUP=1006,
-    WORLD_SITE_CHANGENAME=1007,
-    THRONE_GET_INFO=1008,
-    THRONE_GET_OFFICIAL_LIST=1009,
-    THRONE_CHANGE_PLAYER_OFFICIAL=1010,
-    THRONE_GET_MANAGE_INFO=1011,
-    THRONE_CHANGE_SERVER_NAME=1012,
-    THRONE_CHANGE_NOTICE=1013,
-    THRONE_BUY_BUFF=1014,
-    THRONE_RECRUIT_BUFF=1015,
-    THRONE_GIVE_GIFT=1016,
-    THRONE_POWER_RANK=1017,
-    THRONE_GIFT_DATA=1018,
-    THRONE_HISTORY_DATA=1019,
-    THRONE_KING_GIFT=1020,
-    THRONE_REPORT_DATA=1064,
-    WORLDSITE_RANK_DATA=1065,
-    WORLDSITE_REPORT_DATA=1066,
-    WORLDSITE_DONATE=1067,
-    WORLDSITE_UPGRADE=1068,
-    GET_AIRDROP_INFO=1024,
-    INTERCEPT_AIRDROP_MARCH=1022,
-    PRE_INTERCEPT_AIRDROP_MARCH=1023,
-    WORLD_SEARCH_RALLYBOSS=1025,
-    GET_WORLD_THRONE_DATA=1084,
-    GET_CAMP_MARCH_INFO=1085,
-    ALLIANCE_CREATE=1100,
-    ALLIANCE_DISSOLUTION=1101,
-    ALLIANCE_CHECK_NAME_CANUSE=1102,
-    ALLIANCE_CHECK_TAG_CANUSE=1103,
-    ALLIANCE_CHANGE_INFO=1104,
-    ALLIANCE_REVISE_NOTICE=1110,
-    ALLIANCE_CHANGE_MANIFESTO=1111,
-    ALLIANCE_GET_APPLYLIST=1112,
-    ALLIANCE_APPLY=1114,
-    ALLIANCE_CANCEL_APPLY=1115,
-    ALLIANCE_AGREE_APPLY=1116,
-    ALLIANCE_REFUSE_APPLY=1117,
-    ALLIANCE_GET_INVITE_LIST=1118,
-    ALLIANCE_GET_MEMBER_RANK_LIST=1123,
-    ALLIANCE_GET_MEMBER_POS=1125,
-    ALLIANCE_CHANGE_MEMBER_RANK=1126,
-    ALLIANCE_KICK_MEMBER=1127,
-    ALLIANCE_EXIT=1128,
-    ALLIANCE_CHANGE_LEADER=1129,
-    ALLIANCE_RECALL_LEADER=1130,
-    ALLIANCE_GET_INFO=1131,
-    ALLIANCE_GET_MEMBER_LIST=1132,
-    ALLIANCE_SEARCH=1133,
-    ALLIANCE_GET_RECOMMEND_LIST=1134,
-    ALLIANCE_GET_RECOMMEND=1137,
-    ALLIANCE_GET_SCIENCE=1143,
-    ALLIANCE_DOANTE_SCIENCE=1144,
-    ALLIANCE_UPLEVEL_SCIENCE=1145,
-    ALLIANCE_UPLEVEL_DONE=1146,
-    ALLIANCE_RECOMMEND=1147,
-    ALLIANCE_SCIENCE_INFO=1148,
-    ALLIANCE_SHOP=1149,
-    ALLIANCE_BUYSHOP=1150,
-    ALLIANCE_SHOP_STATUE=1151,
-    ALLIANCE_RECEIVE_FAKE_GIFT=1152,
-    ALLIANCE_RECEIVE_NEW_FAKE_GIFT=1194,
-    ALLIANCE_SEND_TO_ALL_MAIL=1153,
-    ALLIANCE_GET_TERRITORY=1154,
-    ALLIANCE_CREATE_TERRITORY=1155,
-    ALLIANCE_GET_A_BUILDING_INFO=1156,
-    ALLIANCE_REMOVE_A_BUILDING=1157,
-    ALLIANCE_GET_A_BUILDING_INFO_SIMPLE=1158,
-    ALLIANCE_BUILDING_DONATE=1159,
-    ALLIANCE_GET_HELPLIST=1138,
-    ALLIANCE_HELP_APPLY=1139,
-    ALLIANCE_HELP_MEMBER=1140,
-    ALLIANCE_HELP_RECEIVE=1141,
-    ALLIANCE_MOVE_INVITE=1164,
-    ALLIANCE_MOVE_INVITEALL=1179,
-    ALLIANCE_MOVE_ACCEPT=1165,
-    ALLIANCE_MOVE_REFUSE=1180,
-    ALLIANCE_AUTO_ASSEMLBY_SET=1181,
-    ALLIANCE_AUTO_ASSEMLBY_GET=1182,
-    ALLIANCE_HELP_CANCLE=1183,
-    ALLIANCE_RANDOM_KEY=1188,
-    ALLIANCE_MEMBER_DYNAMIC=1142,
-    CHAT_CONNECT=671,
-    CHAT_ALLIANCE_CHANGE=669,
-    CHAT_SET_DING=672,
-    ALLIANCE_Assemblys=1200,
-    ALLIANCE_Assembly_Create=1201,
-    ALLIANCE_Assembly_Cancel=1202,
-    ALLIANCE_Assembly_Repatriation=1203,
-    ALLIANCE_Assembly_Join=1204,
-    ALLIANCE_Defend=1205,
-    ALLIANCE_Assistances=1207,
-    ALLIANCE_BACKAssistance=1208,
-    ALLIANCE_AssistanceRecored=1209,
-    ALLIANCE_AssemblyBattleRecored=1210,
-    ALLIANCE_BOSS_GET_INFO=1160,
-    ALLIANCE_BOSS_DONATE=1161,
-    ALLIANCE_BOSS_SET=1162,
-    ALLIANCE_BOSS_CD=1163,
-    SHOP_GET_DATA=853,
-    HERO_GET_DATA=861,
-    HERO_RECRUIT=862,
-    HERO_USE_EXP_ITEMS=863,
-    HERO_COMPOSE=864,
-    HERO_STAR_RISE=865,
-    HERO_CONVERT_PATCH=866,
-    HERO_USE_SKILL=1341,
-    HERO_CANCEL_SKILL=1342,
-    HERO_USE_ACTIVE_SKILL=1767,
-    EVERYDAYREWARD_GET_DATA=611,
-    EVERYDAYREWARD_GET_REWARD=613,
-    CASINO_QUERY=867,
-    CASINO_GET_REWARD=868,
-    FIRST_CHARGE_GET=752,
-    GET_WAREHOUSE_INFO=137,
-    ADD_WAREHOUSE_LATTICE=138,
-    WAREHOUSE_DELETE_ARMYS=139,
-    WAREHOUSE_MOVE_ARMYS_OUT=140,
-    Building_Exchange=141,
-    ARMY_STORE=217,
-    ARMY_WAREHOUSE_MERGE=218,
-    ARMY_WAREHOUSE_BATCH_MERGE=219,
-    ARMY_HEAL_LIST=220,
-    ARMY_OUT_WAREHOUSE_BATCH_MERGE=224,
-    POWERITEM_COMPOSE_ALL=225,
-    POWERITEM_COMPOSE_GROUPS=231,
-    DECORATION_COMPOSE_ALL=142,
-    ARMY_STORE_SINGLE=226,
-    START_MINE=875,
-    AWARD_MINE=876,
-    GET_MINE_EXCHANGE_NUM=4105,
-    SetHallucinationSkin=4158,
-    BUILD_IN_MINE=877,
-    CancelAllianceExchangeHandler=1169,
-    HelpAllianceExchangeHandler=1168,
-    TransferToTerritory=1166,
-    RequestAllianceExchangeHandler=1167,
-    GetAllianceExchangesByTypeHandlerNew=1170,
-    Get_Alliance_Chat_Reward_List=1171,
-    Receive_Alliance_Chat_Reward=1172,
-    Get_Alliance_Star_Task=1173,
-    Get_Alliance_Star_Task_Reward=1174,
-    GET_ALLIANCE_GIFTS=1175,
-    Receive_Alliance_Gift_Small=1176,
-    Receive_Alliance_Gift_Small_All=1177,
-    Receive_Alliance_Gift_Big=1178,
-    EliteScore_GET_REWARD=1754,
-    GetShareActId=694,
-    PatchSynthesisSkin=878,
-    PatchSynthesisArmyLineSkin=1408,
-    GetRefugee=1021,
-    PUZZLE_ACTIVITY_REWARD=879,
-    GET_MY_CASTLE_NAMEPLATE=881,
-    USE_CASTLE_NAMEPLATE=882,
-    Activity_FRIEND_DETAIL=614,
-    CONVERT_HERO_SKILL_BOX=896,
-    GET_ISLAND_DATA=431,
-    GET_ISLAND_BUY_ITEM=437,
-    GET_ISLE_DATA=446,
-    ISLE_EMBATTLE=447,
-    ISLE_CHANLLEGE=448,
-    ISLE_RESET=449,
-    ISLE_BATTLE_LOG_GET=450,
-    DEGENERATOR_INFO=451,
-    DEGENERATOR_SEARCH=452,
-    DEGENERATOR_FIGHT=453,
-    DEGENERATOR_GET_MAIL=454,
-    DEGENERATOR_REWARD=455,
-    DEGENERATOR_REFRESH=456,
-    DEGENERATOR_DELETE_MAILS=457,
-    DEGENERATOR_READ_MAILS=458,
-    STUDY_HERO_SKILL=897,
-    FORGET_HERO_SKILL=898,
-    LEVEL_UP_INSTALLED_HERO_SKILL=885,
-    DECOMPOSE_HERO_SKILL=886,
-    UNLOCK_HERO_TALENT_SLOT=887,
-    UNDERSTAND_HERO_TALENT=888,
-    RANDOM_HERO_TALENT=889,
-    REPLACE_HERO_TALENT=894,
-    LEVEL_UP_UNINSTALLED_HERO_SKILL=895,
-    HERO_SKIN_CHANGE=899,
-    GET_HERO_BOND_INFO=1740,
-    ACTIVATE_HERO_BOND_ATTRIBUTE=1741,
-    ACTIVITY_REVERSECARD=755,
-    ACTIVITY_REVERSECARD_RESET=753,
-    ACTIVITY_REVERSECARD_BUY=754,
-    ACTIVITY_REVERSECARD_DATA=756,
-    ACTIVITY_REVERSECARD_NEW=3105,
-    ACTIVITY_REVERSECARD_NEW_BUY=3106,
-    ACTIVITY_REVERSECARD_NEW_RESET=3107,
-    GET_MY_ARMYLINE_FACE=858,
-    USE_ARMYLINE_FACE=859,
-    GET_MY_HEADFRAMES=883,
-    USE_MY_HEADFRAME=884,
-    SUMMER_ACT_AWARD=1300,
-    AWARD_GROW_ROAD_TASK=1301,
-    AWARD_GROW_ROAD_STAGE=1302,
-    AWARD_GROW_ROAD_ALL_STAGES=1303,
-    WANBA_REWARD=1503,
-    WANBA_REWARD_STATUS=1504,
-    CROSS_SERVER=1400,
-    GET_ONE_DARK_PORTAL_DATA=1402,
-    GET_CROSS_SERVER_POINT_REWARD=1405,
-    Receive_CROSS_SERVER_POINT_REWARD=1406,
-    GET_CROSS_SERVER_KILL_RANK=1407,
-    KING_CHOOSE_DST_FIGHT_ZONE=1422,
-    GET_CROSS_SERVER_FIGHT_ZONE_INFO=1423,
-    SET_CHAT_BLOCK=874,
-    SAVE_DEFENSE_TROOPS=880,
-    GET_APP_BIND_STATS=873,
-    MOVE_ARMY_OUT_WAREHOUSE=223,
-    ASK_DEFEND_ARMY=1403,
-    SEARCH_HAMMER_BOSS=1027,
-    MARCH_ARMY_DETAIL=1028,
-    SEARCH_HAMMER_BOSS_MAXLEVEL=1029,
-    GET_COUNTRY_BOSS_TASK_DATA=1040,
-    GET_COUNTRY_BOSS_TASK_LINE_REWARD=1041,
-    GET_COUNTRY_BOSS_TASK_REWARD=1042,
-    GET_COUNTRY_BOSS_RANK=1043,
-    GET_COUNTRY_BOSS_DAMAGE_REWARD=1044,
-    COUNTTRY_BOSS_SUMMON=1045,
-    GET_VOTE_TIME_DATA=1050,
-    USER_VOTE_TIME=1051,
-    KING_VOTE_TIME=1052,
-    ACTIVITY_DRAW_CARD=1308,
-    ACTIVITY_DRAW_CARD_RANK=1309,
-    GET_ACTIVITY_SUMMER_LOTTERY_INFO=1305,
-    GET_ACTIVITY_SUMMER_LOTTERY_REWARD=1306,
-    SEND_REAL_NAME_INFO=1429,
-    SEND_VIETNAM_REAL_NAME_INFO=1440,
-    GET_GROUP_CROSS_VOTE=1441,
-    GROUP_CROSS_VOTE=1442,
-    GROUP_CROSS_VOTE_MANIFESTO=1443,
-    GROUP_CROSS_GET_REWARD=1444,
-    GET_OPC_STATE=4001,
-    GET_VERIFICATION_CODE=4011,
-    GET_VERIFICATION_MAIL_CODE=4012,
-    CHECK_VERIFICATION_CODE=4003,
-    CHECK_VERIFICATION_MAIL_CODE=4005,
-    OPCENTER_GET_REWARD=4006,
-    OPCENTER_GET_FORUM_REWARD=4007,
-    DIRECT_REPLACE_HERO_TALENT=1310,
-    ACTIVITY_KILL_RALLYBOSS_INFO=1311,
-    AllianceMemberInviteGetData=1118,
-    AllianceMemberInviteAction=1119,
-    AllianceMemberInviteAgree=1121,
-    AllianceMemberInviteDelete=1122,
-    CHOICE_PROFESSION=1319,
-    GET_LEARN_TALENT_DATA=1318,
-    PROFESSION_LEARN_TALENT=1314,
-    PROFESSION_SPEED_LEARN=1316,
-    RESET_PROFESSION_TALENT=1315,
-    CHANGE_PROFESSION=1317,
-    ACTIVITY_BUY_SCORE_SHOP_ITEM=1312,
-    ACTIVITY_BUY_SCORE_GIFT_CHECK=699,
-    ACTIVITY_BUY_SCORE_GIFT_INFO=1313,
-    ACTIVITY_SHOP_JP_BUY_ITEM=4691,
-    ACTIVITY_RECFARGE_BENEFIT_GET_REWARD=3151,
-    MAHUA_CITYSKIN_UPGRADE_FREE_GET=4695,
-    ACTIVITY_LUCKY_DRAW_CARD_INFO=1323,
-    ACTIVITY_LUCKY_DRAW_CARD_ACT=1324,
-    ACTIVITY_RECHARGE_SCORE_SHOP_INFO=1409,
-    ACTIVITY_RECHARGE_SCORE_SHOP_GET_REWARD=1410,
-    GET_CROSS_SERVER_BATTLE_RECORD=1411,
-    GET_SERVER_SCORE_RANK_DATA=1412,
-    GET_CROSS_SERVER_EVENT_LOG=1413,
-    GET_CROSS_SERVER_OPPONENT_ID=1414,
-    ACTIVITY_RECHARGE_SCORE_SPIN_INFO=1327,
-    ACTIVITY_RECHARGE_SCORE_SPIN_LOTTER=1328,
-    ACTIVITY_RECHARGE_SCORE_SPIN_GET_REWARD=1329,
-    HERO_SPIN_INFO=1721,
-    HERO_SPIN_LOTTER=1722,
-    HERO_SPIN_GET_REWARD=1723,
-    SAVE_DEFENSE_HIGH_SET=1321,
-    AWARD_ONCE=1322,
-    AWARD_COUNT=2009,
-    SWAP_HERO_TALENT=1325,
-    GET_SHIELD_LOG=1330,
-    PAY_PRE_FLOW=790,
-    GET_BUY_EXCHANGE_NUM=791,
-    GET_TOWER_LIST=1031,
-    TOWER_REMOVE=1032,
-    MARCH_WORLD_Build=1033,
-    GET_TOWERINFO=1034,
-    TOWER_COLLECT=1035,
-    GET_THRONE_BATTLE_VOTE_DATA=1036,
-    TRHONE_BATTLE_TIME_VOTE=1037,
-    TRHONE_BATTLE_TIME_SELECT=1038,
-    RegisterSystemPush=1061,
-    UnregisterSystemPush=1062,
-    superReward=852,
-    OCTOBER_RECORD=900,
-    NOBACK_LOTTERY=1326,
-    FLOWER_LOG=1331,
-    GET_WORLD_TREASURE=1336,
-    DELETE_ACCOUNT_CHECK=1534,
-    SUBMIT_DELETE_ACCOUNT=1532,
-    CANCEL_DELETE_ACCOUNT=1535,
-    CONFIRM_DELETE_ACCOUNT=1536,
-    GET_DELETE_ROLE_LIST=1533,
-    GET_UP_PIC_TOKEN=1537,
-    UploadUserHeadImage=1335,
-    PERSONAL_MONSTER_SIEGE_START=1320,
-    GET_CASTLE_EFFECT_ITEM=1332,
-    GET_MY_CASTLE_EFFECT=1333,
-    USE_CASTLE_EFFECT=1334,
-    SIGNUP_AL_MONSTER_SIEGE=1350,
-    REPAIR_ALLIANCE_FORTRESS=1351,
-    WEAK_AL_SIEGE_MONSTER=1352,
-    THANKSGIVING_GETREWARD=1338,
-    COMPOSE_ITEM=1337,
-    MERGE_ITEM=5021,
-    MILITARY_UP=1361,
-    QUEST_GET=1362,
-    QUEST_WorldPoint_get=1363,
-    FIND_MOD=1339,
-    GET_SIXTEEN_FIGHT=1415,
-    GET_SIXTEEN_BET_INFO=1416,
-    BET_SIXTEEN=1417,
-    WORLDBATTLE_SHOP_BUY_ITEM=1360,
-    CANCEL_BET_SIXTEEN=1418,
-    BOUNTY_SHOP_BUY_ITEM=1364,
-    RealNameReward=1340,
-    ChangeHeroSkillsIndex=1345,
-    SavePreMarch=1346,
-    USE_CDK_CODE=695,
-    GIFTBOX_DRAW=1373,
-    GIFTBOX_NEXT=1374,
-    GIFTBOX_GETPACKAGE=1375,
-    ACTIVITY_MINE_DIG=1370,
-    ACTIVITY_MINE_RESOLEVE=1371,
-    ACTIVITY_MINE_CONVERT=1372,
-    ACTIVITY_HUNT_DIG=1393,
-    ACTIVITY_DICE_ROLL=1376,
-    ACTIVITY_GET_DICE_REWARD=1377,
-    ACTIVITY_DICE_RECORD=1378,
-    Get_Treasure_Theme_Data=1379,
-    RndTaskRefresh=1419,
-    NEWYEAR_GETREWARD=1365,
-    CrossServerFightKillRank=1420,
-    LuckBagRequest=1368,
-    ActivityJanuaryGiftSign=1369,
-    ActivityCalendarGetData=1347,
-    ActivityCalendarReadData=2003,
-    CrossServerBattleInfo=1424,
-    ActivitySocialReweard=1366,
-    Evaluate_MOD=1367,
-    getConsignList=1380,
-    getSingleItemConsignList=1381,
-    getSingleItemConsignBuyList=1621,
-    consignmentSomeItem=1382,
-    consignmentBuySomeItem=1622,
-    consignmentBuy=1383,
-    consignmenSell=1623,
-    consignmentMyGoods=1384,
-    consignmentRecord=1385,
-    consignmentSoldOut=1386,
-    consignmentBuySoldOut=1624,
-    getStrengthenMakingData=1387,
-    MAKE_FORMULA=1388,
-    SPEED_UP_FORMULA=1389,
-    CANCEL_FORMULA=1390,
-    EQUIP_OR_REMOVE_DEF_TRAPS=1391,
-    ProductionListGet=1398,
-    ProductionStart=1399,
-    ProductionComplete=1600,
-    ProductionCancle=1396,
-    ProductionReward=1397,
-    ProductionBatch=1612,
-    SaveMergeGameData=1613,
-    GetMergeGameData=1614,
-    MergeGameTaskComplete=1615,
-    ActivityEaster_GetBall=1608,
-    ActivityEaster_GetReward=1609,
-    Get_Adventure_Data=1630,
-    Adventure_Start=1631,
-    Adventure_Hero_Save=1632,
-    Adventure_Reward=1633,
-    Adventure_Sweep_Reward=1634,
-    Adventure_Boss_Attack=1635,
-    Adventure_Total_Rank=1636,
-    Adventure_Last_Win_Team=1637,
-    Update_Activity_Info_By_Type=1638,
-    Adventure_Shop_Item_Buy=1639,
-    Adventure_GET_HALL_TASKS=1640,
-    Adventure_AWARD_HALL_TASK=1641,
-    chatMuted=680,
-    GET_KVK_INFOS=1450,
-    GS_TO_KVK=1451,
-    KVK_TO_GS=1452,
-    ACTIVITY_INVEST_SAVE=3601,
-    ACTIVITY_INVEST_CLAIM=3602,
-    ACTIVITY_INVEST_GET_FREE=3603,
-    ACTIVITY_INVEST_REFRESH=3604,
-    KVK_ALLIANCE_BUILDING=1453,
-    KVK_ALLIANCE_BUILDING_CREATE=1454,
-    KVK_ALLIANCE_BUILDING_DETAIL=1455,
-    KVK_ALLIANCE_BUILDING_REMOVE=1456,
-    KVK_ALLIANCE_BUILDING_FIX=1457,
-    KVK_ALLIANCE_REBUILD_BASE=1458,
-    KVK_ALLIANCE_REBUILD_BASE_DONATE=1459,
-    KVK_ALLIANCE_CHOICE_COLOR=1460,
-    EC_PREPARE_INFO=1471,
-    EC_PREPARE_SYNTHESIS=1472,
-    EC_PREPARE_DONATE=1473,
-    EC_PREPARE_REWARD=1474,
-    EC_PREPARE_RANK=1475,
-    EC_PREPARE_DONATE_NEW=1476,
-    KVK_GET_RANK=1478,
-    KVK_GET_ACHEVEMENT=1479,
-    KVK_GET_ACHEVEMENT_REWARD=1480,
-    KVK_GET_PROGRESS_REWARD=1481,
-    KVK_SMALL_MAP_INFO=1461,
-    KVK_JUDGE_IS_CONNECT=1462,
-    KVK_JUDGE_CITY_IS_CONNECT=1463,
-    KVK_MARK_WORLD_POINT=1482,
-    KVK_UNMARK_WORLD_POINT=1483,
-    TRANSFER_SERVER_LIST=1520,
-    TRANSFER_USER_LIST=1521,
-    TRANSFER_SERVER=1522,
-    TRANSFER_SELECT_INDEX=1523,
-    TRANSFER_GET_MY_SERVER=1524,
-    TRANSFER_SERVER_APPLY_REQUEST=1525,
-    TRANSFER_SERVER_APPLY_OPERATE=1526,
-    TRANSFER_SERVER_APPLY_LIST=1527,
-    TRANSFER_SERVER_NEWBIE=1528,
-    DecorateStorehouse_GetData=1601,
-    DecorateStorehouse_PutIn=1602,
-    DecorateStorehouse_PutInPos=1610,
-    DecorateStorehouse_PutOut=1603,
-    DecorateStorehouse_MovePos=1604,
-    DecorateStorehouse_Compose=1605,
-    DecorateStorehouse_PutOutAll=1606,
-    GET_GUN_FIGHT_INFO=1055,
-    GET_GUN_FIGHT_USER_INFO=1057,
-    GET_GUN_FIGHT_ALLIANCE_RANK=1056,
-    ALLIANCE_GET_SHOW_TASK=1184,
-    ALLIANCE_TASK_TANK=1185,
-    ALLIANCE_ACHEVEMENT_TASK_GET_REWARD=1186,
-    ALLIANCE_BADGE_READ=1187,
-    ARMYEQUIP_NEW_MATERIAL_PRODUCE=1643,
-    ARMYEQUIP_NEW_MATERIAL_PRODUCE_DELETE=1644,
-    ARMYEQUIP_NEW_MATERIAL_PRODUCE_GET=1645,
-    ARMYEQUIP_NEW_MATERIAL_COMPOSE=1646,
-    ARMYEQUIP_NEW_MATERIAL_DISMANTLE=1647,
-    ARMYEQUIP_NEW_EQUIP_COMPOSE=1648,
-    ARMYEQUIP_NEW_EQUIP_DISMANTLE=1649,
-    ARMYEQUIP_NEW_EQUIP_CHANGE=1650,
-    HURT_TANK_QUEST=1652,
-    ACTIVITY_GET_SCORE_REWARD=1642,
-    ACTIVITY_GET_ALL_SCORE_REWARD=1777,
-    ACTIVITY_GET_ALL_TASK_REWARD=3140,
-    MAHUA_SHARE_FIRST=3141,
-    MAHUA_SHARE_GET_FIRST_REWARD=3142,
-    EVA_PINBALL_DRAW=3143,
-    EVA_PINBALL_GET_REWARD=3144,
-    EVA_PINBALL_GET_LOG=3145,
-    GET_GUN_FIGHT_USER_REWARD=1058,
-    GET_ARIDROP_POINT=1059,
-    SEND_SYSTEM_MSG=1060,
-    GET_ALLIANCE_DISPLAY_TIME=1353,
-    GET_AL_MONSTER_SIEGE_ACT_RANK_INFO=1354,
-    AWARD_AL_MONSTER_SIEGE_RANK=1355,
-    GET_AL_MONSTER_SIEGE_ITEM_COUNT=1356,
-    GET_AL_MONSTER_RANK_DATA=1357,
-    Compose_Treasure_Debris=1358,
-    Get_Treasure_Theme_Reward=1359,
-    ACTIVITY_ALLIANCEBP_RANK=1348,
-    ASK_REWARD_FIRST_HERO=1349,
-    NBATTLE_ARENA_PVE=1660,
-    ARENA_PVE_MAIN_REQUEST=1661,
-    ARENA_PVE_RANK=1662,
-    ARENA_PVE_CONFIG=1663,
-    ARENA_PVE_RECORD_LOG=1664,
-    MigrateCode_getCode=1653,
-    MigrateCode_CreateCode=1654,
-    MigrateCode_UseCode=1655,
-    ARENA_PVP_MAIN_REQUEST=1665,
-    ARENA_PVP_SETD_DEFEND=1666,
-    ARENA_PVP_DF_DETAIL=1667,
-    ARENA_PVP_PLAYER_LIST=1668,
-    ARENA_PVP_START_FIGHT=1669,
-    ARENA_PVP_BATTLE_RECORD=1670,
-    PVP_BUY_TICKET_ITEM=1671,
-    Activity_Hero_Return_Reward_Select=1656,
-    Activity_Hero_Return_Roll=1657,
-    GET_WORLD_SERVER_BRIEFING=1658,
-    GET_WORLD_SERVER_OTHER_BRIEFING=1659,
-    King_Mark_Get=1673,
-    King_Mark_CHANGE=1672,
-    GET_TREASURE_MAP_DATA_BY_TYPE=1680,
-    GET_RECENT_TREASURE_MAP_DATA=1681,
-    CREATE_TREASURE_MAP_DATA=1682,
-    DONATE_TREASURE_MAP_ITEM=1683,
-    AWARD_DONATE_ITEM_TREASURE_MAP=1684,
-    LOTTERY_TURN_TABLE_TREASURE_MAP=1685,
-    TreasureMapChooseBoss=1686,
-    GET_TREASURE_MAP_WORLD_BOSS_INFO=1687,
-    GET_HURT_TREASURE_MAP_WORLD_BOSS_RANK=1688,
-    GET_TREASURE_MAP_WORLD_SHOP=1689,
-    BUY_IN_TREASURE_MAP_WORLD_SHOP=1690,
-    GET_TREASURE_MAP_TASK_INFO=1691,
-    GET_TREASURE_MAP_TASK_REWARD=1692,
-    GIVE_UP_TREASURE_MAP_TASK=1693,
-    King_Castle_Effect_Equip=1677,
-    ACTIVITY_GURBAN_BUY_ADV=1674,
-    ACTIVITY_GURBAN_USE_ITEM=1675,
-    LUCK_MALL_REFRESH=1678,
-    LUCK_MALL_BUY=1679,
-    ACTIVITY_KINGDOM_GETINFO=1676,
-    ACTIVITY_WORK_AWARD=1700,
-    ADD_EXPLORE_SEA_SLOT=1694,
-    AWARD_EXPLORE_SEA=1695,
-    COMPOSE_EXPLORE_SEA_BOX=1696,
-    SPEED_UP_EXPLORE_SEA=1697,
-    START_EXPLORE_SEA=1698,
-    EXPLORE_SEA_HUNT_ALL=1708,
-    WORLDEMOJI_GET=1748,
-    WORLDEMOJI_USE=1749,
-    WORLDEMOJI_ON=1750,
-    WORLDEMOJI_OFF=1751,
-    GET_NEARST_TERRITORY_MARCH_TIME=1710,
-    ACTIVITY_RED_BLUE_RESET_AWARD=1701,
-    SYNC_CAMPAIGN_INFO=1704,
-    GET_DECORATION_SUITS=1702,
-    AWARD_DECORATION_SUIT=1703,
-    Convert_ExcludeHero_Patch=1705,
-    VideoGetArmy=1712,
-    GET_LEVY_REWARD=1713,
-    VideoGetRes=1711,
-    ACTIVITY_CAMPFIRE_BURN=1714,
-    GET_WORLD_RESOURCE_AMOUNT=1063,
-    LIKENESS_SURVEY=1699,
-    OPEN_ALL_SEA_CLOUD=1715,
-    UNLOCK_AREA_WAR_SEA=1716,
-    AREA_SEA_FIGHT=1717,
-    MONEY_TREE_INFO_V1=1801,
-    MONEY_TREE_CLICK_V1=1802,
-    EC_GET_EXCHANG_INFO=1488,
-    EC_GET_EXCHANG_REQUEST=1489,
-    EC_GET_BUFF=1490,
-    EC_STRONGEST_LEADER_COMPETITION=1484,
-    EC_STRONGEST_LEADER_RANK=1485,
-    EC_STRONGEST_LEADER_DONATE=1486,
-    EC_STRONGEST_LEADER_GET_REWARD=1487,
-    WorldCitySkinInteract=1730,
-    ACTIVITY_PHASE_RANK_GET=1718,
-    ACTIVITY_HISTORICAL_PHASE_RANK_GET=1719,
-    ACTIVITY_HISTORICAL_DAY_RANK_GET=1720,
-    GET_GLORIOUS_TRAINING_INFO=1724,
-    START_GLORIOUS_TRAINING=1725,
-    CANCEL_GLORIOUS_TRAINING=1726,
-    SPEEDUP_GLORIOUS_TRAINING=1727,
-    IMMEDIATELY_GLORIOUS_TRAINING=1728,
-    EXCHANGE_GLORIOUS_TRAINING=229,
-    CROSS_ARENA_MAIN_INFO=1731,
-    CROSS_ARENA_SET_DEFEND=1732,
-    CROSS_ARENA_GET_CHALEENGE_LIST=1733,
-    CROSS_ARENA_ATTACK=1734,
-    CROSS_ARENA_GET_OTHER_DEFEND=1735,
-    CROSS_ARENA_CHALLANGE=1729,
-    CROSS_ARENA_GET_BATTLE_LOG=1736,
-    CROSS_ARENA_BUY_TICKET=1737,
-    GET_TRANSPORT_EFFECT_DATA=1742,
-    SET_TRANSPORT_EFFECT=1743,
-    EXCHANGE_TRANSPORT_EFFECT=1744,
-    GET_CITY_SKILL_DATA=1752,
-    USE_CITY_SKILL=1753,
-    ISLE_SWEEP=445,
-    PAY_SPEC_COUPON_FLOW=710,
-    FIRST_CAHRGE_COLLECT_REWARD=731,
-    GS_TO_CAB=3001,
-    CAB_TO_GS=3002,
-    CAB_ASK_HOSPITAL_DATA=3003,
-    CAB_CURE_ALL_ARMYS_DATA=3004,
-    CAB_BUILDING_DETAIL=3010,
-    CAB_SIGN=3006,
-    CAB_GET_ALLIANCE_MEMEBER_LIST=3007,
-    CAB_CHANGE_MEMBER_LIST=3008,
-    CAB_SMALL_MAP_INFO=3011,
-    CAB_MINI_MAP_INFO=3012,
-    CAB_SPEED_CURE=3005,
-    CAB_SITUATION=3013,
-    CAB_RECORD=3009,
-    FREE_PACK_PURCHASE_LOG=1745,
-    FREE_PACK_PURCHASE=1746,
-    FREE_PACK_COLLECT=1747,
-    CAB_INTERCEPT_AIRDROP_MARCH=3015,
-    CAB_PRE_INTERCEPT_AIRDROP_MARCH=3016,
-    CAB_BATTLE_RESULT=3014,
-    CAB_SYNC_DATA=3020,
-    CAB_RECORD_COMPARE=3017,
-    Activity_Baking_Item_Exchange=3101,
-    Activity_Baking_Rank_Data_Get=3102,
-    CREATE_ACTIVITY_ALLIANCE_BUILD=1189,
-    GET_ACTIVITY_BUILD_FIGHT_LOGS=1190,
-    Alliance_Boss_Choose=1191,
-    Alliance_Boss_Open=1192,
-    GET_ACTIVITY_CLOVER_LOTTERY_REWARD=1755,
-    Get_WeChat_RedPacket_Code=1759,
-    Get_WeChat_RedPacket_Reward=1760,
-    Army_Mastery_LevelUp=1762,
-    Army_Mastery_Strengthen=1763,
-    CAB_SHOP_BUY=3021,
-    CSB_SHOP_BUY=1425,
-    CAB_RANK=3018,
-    SERVER_TASK_LIST=1810,
-    SERVER_TASK_REWARD=1811,
-    GET_FORTRESS_LOTTERY_DATA=1818,
-    FORTRESS_LOTTERY_REWARD=1819,
-    GET_FORTRESS_SCRATCH_CARD_RECORD_DATA=1820,
-    GET_FORTRESS_CHOOSE_ITEM_REWARD_DATA=1825,
-    FORTRESS_CHOOSE_ITEM_REWARD=1826,
-    GET_FORTRESS_CHOOSE_ARMY_REWARD_DATA=1827,
-    FORTRESS_CHOOSE_ARMY_REWARD=1828,
-    WONDER_TASK_INFO=1815,
-    WONDER_TASK_RANK_INFO=1816,
-    WONDER_TASK_REVICE=1817,
-    GET_WORLD_SITE_MONSTER_LIST=1821,
-    SUMMON_WORLD_SITE_MONSTER=1822,
-    GET_WORLD_SITE_RESOURCES_LIST=1823,
-    SUMMON_WORLD_SITE_RESOURCE=1824,
-    QIU_BI_TE_INFO=1756,
-    QIU_BI_TE_SHOOT=1757,
-    QIU_BI_TE_OPEN_BOX=1758,
-    ELEMENT_SCIENCE_INFO=1768,
-    ELEMENT_SCIENCE_UPDATE=1769,
-    ELEMENT_SCIENCE_SWITCH=1770,
-    INFINITE_GIFT_ACT_AWARD_FREE=1765,
-    INFINITE_GIFT_ACT_REFRESH=1766,
-    UPGRADE_FORMATION=1761,
-    GET_MARRCH_HERO_BUFF=2007,
-    GET_CREDIT_INFO=2008,
-    March_Speed_Up_City_Skill_Use=2010,
-    DWARF_MINER_DIG=1771,
-    DWARF_MINER_SKIP_WAITING=1772,
-    DWARF_MINER_OPEN_CHEST=1773,
-    DWARF_MINER_UNLOCK_CHEST=1774,
-    EXCLUSIVE_SKILL_BUY=3022,
-    SING_SIGN_IN_30_DAYS=3301,
-    PROGRESS_SIGN_IN_30_DAYS=3302,
-    ACTIVITY_PUZZLE_Play=3154,
-    ACTIVITY_PUZZLE_GET_REWARD=3155,
-    ACTIVITY_FREE_GIFT_GET_REWARD=3156,
-    ACT_Interstellar_TITLE_GET_REWARD=4900,
-    ACTIVITY_NEW_YEAR_OPEN_LANTERN=4900,
-    ACTIVITY_NEW_YEAR_OPEN_SMALL=4901,
-    ACTIVITY_NEW_YEAR_GET_SMALL_REWARD=4902,
-    ActivityMonthSignIn=1775,
-    GET_CROSS_HOSPITAL_QUEUES=1426,
-    ARMY_CROSS_HEAL=1427,
-    SPEEDUP_CROSS_HOSPITAL_QUEUE_BY_GOLD=1428,
-    IdolJigSawSignIn=3401,
-    JigsawGetIdols=3402,
-    IdolJigsawGetInfos=3403,
-    IdolJigsawDownloadImg=3404,
-    GetG123PayInfoNew=704,
-    VIDEO_ACTIVITY_DONATE=3104,
-    VIDEO_ACTIVITY_DONATE_REAL_SCORE=3108,
-    VIDEO_ACTIVITY_DONATE_Hinatazaka=3109,
-    ACTIVITY_GET_SINGLE_INFO=3103,
-    SYNC_PLATFORM_VIP_INFO=1506,
-    GET_QQGAME_VIP_PRIVILEGE_INFO=1530,
-    AWARD_QQGAME_VIP_PRIVILEGE=1531,
-    SendPayToServer_fbInstantGame=720,
-    POWER_GET_DETAIL=2015,
-    BuyElectricity=3501,
-    RadarScan=3502,
-    RadarReset=3503,
-    RadarGetInfo=3504,
-    RadarStartTask=3505,
-    RadarBeginMarch=3507,
-    RadarGetReward=3508,
-    RadarCountryGetReward=3509,
-    RadarResetOneTask=3516,
-    RadarLevelUp=3514,
-    RadarDefend=3515,
-    RadarStrength=3517,
-    DWARF_MINER_RECEIVE_ALL=1776,
-    EC_SHOP_BUY=3701,
-    EC_SHOP_INIT=3702,
-    KVK_ARK_RANK_INFO=1495,
-    FR_ARK_INFO=1496,
-    KVK_ARK_TRANSFER_MARCH=1494,
-    EC_SCIENCE_INIT=1493,
-    EC_SCIENCE_LEARN=1491,
-    EC_SCIENCE_SPEED=1492,
-    USER_ROLE_LIST_DETAIL=2012,
-    G123QuerySnsState=2013,
-    G123BindAccountRewardwithCheck=2014,
-    USER_ROLE_LIST_DETAIL_NEW=2025,
-    ALLIANCE_RECORD_DATA=1193,
-    RICH_MAN_LOVER_DOUBLE_LINK=3161,
-    RICH_MAN_CHECK_LINK=3162,
-    RICH_MAN_LOVER_REWARD=3163,
-    OPCENTER_OPEN_FORUM=4008,
-    OPCENTER_OPEN_LINK=4009,
-    OPCENTER_GET_LINK_REWARD=4010,
-    Activity_King_Return_Code_Bind=3901,
-    Activity_King_Return_Reward=3902,
-    Activity_King_Return_Index_Reward=3903,
-    Get_Activity_King_Return_Invite_Player_List=3904,
-    ARMYS_PUT=230,
-    TRANSFORMERS_BOSS_PREVIEW_UNLOCK=3110,
-    MONEYSCORE_PACKAGE_FREE_RECEIVE=3111,
-    HERO_UPGRADE=3112,
-    HERO_CHANGE_UNLOCK=4145,
-    HERO_CHANGE_SWITCH=4146,
-    Send_View_Open_Task=4159,
-    Unlock_Area_V3=152,
-    Unlock_Sea_Area_V3=153,
-    Final_Unlock_Area_V3=154,
-    Unlock_Area_Battle_V3=422,
-    Repair_Fake_Battle=423,
-    RANDOM_AREA_V3_EVENT_BUILD=159,
-    EXECUTE_AREA_V3_RANDOM_EVENT_BUILD=160,
-    Start_Wait_Area_V3=161,
-    Army_Parade=162,
-    PUTOUT_ARMY_FROM_AREA_V3_ARSENAL_BOX=158,
-    RECEIVE_AREA_V3_MULTIPLE_TREASURE=157,
-    REPAIR_AREA_V3_MAIN_BUILD=155,
-    REMOVE_AREA_V3_MAIN_BUILD=156,
-    BREW_FORMULA=1778,
-    AWARD_WADE_SIGN=1779,
-    CHECK_ELEMENT_PUSH_GIFT=1799,
-    ACTIVITY_SPECIFIED_PHASE_RANK_GET=1780,
-    GET_BULLION_INFO=733,
-    BULLION_PAY=732,
-    BULLION_PRICE_REPORT=734,
-    ActivityTransformerBossContribute=3801,
-    NBATTLE_TRANSFORM_BOSS=3802,
-    ActivityTransformerBossRecodeLog=3803,
-    ActivityTransformerBossReward=3804,
-    Get_Transformer_Boss_Pos=3805,
-    ACTIVITY_BUMBLEBEE_GET_REWARD=3113,
-    NBATTLE_TRANSFORM_BOSS_P2=3811,
-    TRANSFORM2_RICHMAN_TOUCH_TASK=3127,
-    MYSERY_BOX_UNBOXING=3605,
-    MYSERY_BOX_REFRESH=3606,
-    MYSERY_BOX_SHAKE=3607,
-    MYSERY_BOX_STAGE_REWARD=3608,
-    RADAR_FINISH_DRAW_EVENT=3511,
-    RADAR_FINISH_PASSWORD_EVENT=3512,
-    RADAR_RESET_READ_STATUS=3513,
-    BATCH_BUILD_ORDER=180,
-    RUSSIA_POP_STATUS=4502,
-    AWARD_AUTO_ADD_POINT_BP_ACT_SCORE_STAGE=3114,
-    RUSSIA_BP_RECYCLE_REWARD=4501,
-    ITEM_RECYCLE_ACTIVITY=3137,
-    SCORE_EXCHANGE_ITEM_ACTIVITY=3138,
-    RANSOME_ITEM_ACTIVITY=3139,
-    ITEM_RECYCLE=4101,
-    ITEM_BATCH_RECYCLE=4102,
-    ITEM_RANSOME=4103,
-    ITEM_RECYCLE_RECORD=4104,
-    PURCHASE_ACCUMULATE_RECHARGE=3121,
-    SERGEY_HERO_SKIN_ACT_REWARD=4508,
-    CITY_SKIN_SPECIAL_EXCHANGE=3120,
-    CITY_SKIN_UPGRADE=4120,
-    Request_A_Injured_Army=4122,
-    RICH_MAN_ROLL_DICE=3122,
-    RICH_MAN_ACHIEVEMENT_RECIVE=3123,
-    HALLOWEEN_BP_INFINITE_RECEIVE=3906,
-    HALLOWEEN_DAY_TASK_DOUBLE_RECEIVE=3119,
-    LIMITED_TIME_OFFER_SCORE_OPNE=740,
-    LIMITED_TIME_OFFER_SCORE_INFO=741,
-    LIMITED_TIME_OFFER_SCORE_FREE_REWARD=742,
-    LIMITED_TIME_OFFER_SCORE_REWARD=743,
-    ACTIVITY_FIRE_A_CANNON=3907,
-    GET_ALL_TERRITORY_INFO=1080,
-    GET_VISIBLE_TERRITORY_INFO=1082,
-    GET_MIX_TERRITORY_INFO=1083,
-    RECALL_ALL_MARCH=1087,
-    SMALLAMOUNTBP_FREE_REWARD=3115,
-    SMALLAMOUNTBP_FDAY_REWARD=3116,
-    ACTIVITY_JAPAN_TRAIN_TASK_CHAPTER=4731,
-    ACTIVITY_JAPAN_TRAIN_TASK_REFRESH=4732,
-    RANK_WITH_SHOP_BUY=3126,
-    DECORATE_SHOP_BUY=4697,
-    GET_GROUP_CROSS_FIGHT=1430,
-    GET_GROUP_CROSS_FIGHT_BY_GROUP=1431,
-    GET_GROUP_CROSS_FIGHT_BET_INFO=1432,
-    BET_GROUP_CROSS_FIGHT=1433,
-    TT_GET_RANK_DATA=1435,
-    TT_SHOP_DATA=1437,
-    TT_SHOP_BUY_ITEM=1434,
-    SEND_GROUP_CROSS_FIGHT_GIFT=1436,
-    TT_GET_GIFT_DATA=1438,
-    HERO_CONVERT_SKIN=3124,
-    NOTICE_DAILY_REWARD=3125,
-    BARGAINSHOP_BUY=4123,
-    BARGAINSHOP_BARGAIN=4124,
-    BARGAINSHOP_HELP=4125,
-    SAVE_GUIDE_FREE_PASSED_ID=4126,
-    START_CHALLENGE_PVE_FIGHT=4174,
-    START_MULTIPLE_FIGHT=4175,
-    GET_PVE_CHALLENGE_LOG=4176,
-    THANKS_GIVING_ACH_NUM_REWARD=4701,
-    THANKS_GIVING_START_COOKING=4702,
-    LOOK_UNLOCK_GIFT=4705,
-    ACTIVITY_WARE_HOUSE_JP_GET_ITEM=3908,
-    ACTIVITY_WARE_HOUSE_JP_GET_REWARD=3909,
-    ACTIVITY_WARE_HOUSE_JP_REFRESH=3910,
-    MINI_GAME_MAX_PASS_LEVEL=4130,
-    MINI_GAME_GET_LEVEL_REWAED=4131,
-    ACTIVITY_KING_BOX_REWARD_THIRD_EDITION=3911,
-    ACTIVITY_SHOP_JP_REFRESH=4692,
-    ACTIVITY_CHIP_SYNTHESIS=3919,
-    THANKS_GIVING_QUICK_GET_COOKING_REWARD=4703,
-    THANKS_GIVING_QUICK_CLAIM_COOKING_REWARD=4704,
-    CASTLECOS=4127,
-    TRAIN_ARMY_SPEED_UP_BY_BUILDS=163,
-    CHRISTMAS_STORY_CHOOSE_TASK_REWARD=4711,
-    CHRISTMAS_STORY_GET_CHAPTER_REWARD=4712,
-    CHRISTMAS_STORY_GET_ALL_MAP_REWARD=4713,
-    CHRISTMAS_STORY_SELECT_MAP=4714,
-    CHRISTMAS_STORY_NEXT_MAP_STORY=4715,
-    CHRISTMAS_STORY_REPEATE_CHALLENGE_TASK=4716,
-    CHRISTMAS_USE_MAGNIFIER=4717,
-    MYSTERIOUS_TRIANGLE_DRAW=4764,
-    MYSTERIOUS_TRIANGLE_REFRESH=4765,
-    MYSTERIOUS_TRIANGLE_GET_REWAARD=4766,
-    TRANSFORMERS_2_UNLOCK_STSTE=4721,
-    TRANSFORMERS_2_DONATE_ENERGY=4741,
-    TRANSFORMERS_2_ENEMY_INFO=4742,
-    TRANSFORMERS_2_HERO_LOTTERY=4751,
-    TRANSFORMERS_2_DECORATIONS=4743,
-    BAG_ARMY_BATCH_PUT=232,
-    Get_Building_Skill_Data=4128,
-    Building_Use_Skill=4129,
-    HELP_ALL_ALLIANCE_MEMBERS=1195,
-    Get_Alliance_Free_Zone_Data=1196,
-    RUNINS_REWARD=4744,
-    RUNINS_TIME=4745,
-    RAMADAN_BUY=3132,
-    RAMADAN_TOUCH=3131,
-    TURNTABLE_DIAMOND_BUY=3129,
-    TURNTABLE_OPENBOX=3130,
-    TURNTABLE_PRIZEDRAW=3128,
-    MAKESHIFTBAG_RECEIVE=3135,
-    WORLD_PEACE_GET_PROGRESS_REWARD=3133,
-    WORLD_PEACE_GET_REWARD=3134,
-    CHANGE_HERO_DRESS=4132,
-    USERINFO_COLLECT_CITY=4133,
-    GET_EMPIRE_TREASURE_RANK_INFOS=4135,
-    GET_EMPIRE_TREASURE_RANK_BY_LEVEL=4136,
-    RECEIVE_EMPIRE_TREASURE_RANK_REWARD=4137,
-    RECEIVE_EMPIRE_TREASURE_PROGRESS_REWARD=4138,
-    TREASURE_BOX_SCHEDULE_RECEIVE=4761,
-    TREASURE_BOX_RECEIVE=4762,
-    TREASURE_BOX_REFRESH=4763,
-    RECEIVE_BP_LOOP_REWARD=3913,
-    GET_ACTIVITY_WAWAJI_PLAY=3914,
-    Eva_Boss_Attack=3973,
-    SYNC_SERVICE_TOUTIAO_CLICKID=1781,
-    UPGRADE_DECORATE_BUILDINGS=181,
-    TEST_REQUEST_CMD=9999,
-    THREE_ARMY_HERO_ROTARY_CHOOSE_ARMY=3136,
-    GET_ACTIVITY_PROFESSIONALTALENTBOX_REWARD=3912,
-    Get_Activity_Rank_Total_Data=3621,
-    Get_Activity_Rank_Total_Data_History=3622,
-    GET_HEROID_SCREEN=1783,
-    SHIP_WRECK_OVERDUE=1782,
-    RecoveryGold=4139,
-    GET_BLOCK_OUT_CONFIGS=4140,
-    GET_WAREHOUSE_INFO_BY_BUILD_TYPE=183,
-    GetGourmetProgressReward=4706,
-    QUERY_GIFTBAG_COUNT=792,
-    CROSS_ARENA_4C_MAIN_INFO=5101,
-    CROSS_ARENA_4C_BUY_TICKET=5102,
-    CROSS_ARENA_4C_GET_CHALEENGE_LIST=5103,
-    CROSS_ARENA_4C_SET_DEFEND=5104,
-    CROSS_ARENA_4C_ATTACK=5105,
-    CROSS_ARENA_4C_CHALLANGE=5106,
-    CROSS_ARENA_4C_GET_OTHER_DEFEND=5107,
-    CROSS_ARENA_4C_GET_BATTLE_LOG=5108,
-    GET_WORLD_CITY_ASSISTANCE_MARCH=1784,
-    PROFESSION_CHECK_PUSH_GIFT=1787,
-    OPEN_EQUIP_MANUFACTUR_CHECK_PUSH_GIFT=1788,
-    CLOSE_WORLD_EMOJI=1786,
-    ARMY_EQUIP_CHECK_PUSH_GIFT=1800,
-    TANSFORM_EQUIP=5001,
-    RESET_EQUIP_SUIT=5002,
-    ARMY_POWER_RANK=653,
-    ALLIANCE_ARMY_POWER_RANK=654,
-    MONUMENT_TASK_COMPLETE_RANK=649,
-    GET_ALLIANCE_SKILL=1197,
-    ALLIANCE_SKILL_DONATE=1198,
-    ALLIANCE_SKILL_RECOMMEND=1199,
-    ALLIANCE_SKILL_USE=1105,
-    ARMY_CAMP_MARCH=1107,
-    FR_ALLIANCE_INIT=5125,
-    FR_ALLIANCE_DONATE=5126,
-    KVK_ALLIANCE_TEC_LVUP=5127,
-    KVK_ALLIANCE_TEC_USE=5128,
-    SPECIAL_CAR_INFO=5116,
-    SPECIAL_CAR_BATTLE=5117,
-    FR_PLAN=5141,
-    FR_PLAN_REWARD_VOTE=5142,
-    FR_PLAN_REWARD_SELECT=5143,
-    FR_PLAN_REWARD_GET=5144,
-    FR_PLAN_RANK=5145,
-    GET_MY_SPECIAL_CAR=5118,
-    GET_MARCH_BY_ID_FOR_SPECIAL_RES=5120,
-    GET_SPECIAL_RES_Car_Log=5119,
-    FIRST_CHARGE_THREE_DAY_ALREADY_OPEN=4696,
-    GET_ACTIVITY_GIFT_SMALL_REWAED=4693,
-    NEW_SUPER_REWARD=3623,
-    NEW_OCTOBER_RECORD=3624,
-    FR_WORLD_BOSS_PANEL=5131,
-    FR_LEVEL_RANK=5132,
-    FR_HISTORY_RANK=5133,
-    FR_PERSON_RANK=5134,
-    FR_WORLD_BOSS_RANK=5135,
-    FR_WORLD_BOSS_REWARD=5136,
-    FR_ALLIANCE_RANK=5151,
-    INTEGRAL_DATA=793,
-    GET_TF3_RANK_LIST=4746,
-    ARENA_MECHA_DATA=5510,
-    ARENA_MECHA_BATTLE=5511,
-    ARENA_MECHA_RECORD_LOG=5512,
-    ARENA_MECHA_RANK=5513,
-    ARENA_MECHA_OTHER_INFO=5514,
-    ARENA_MECHA_REWARD=5515,
-    MECHA_GET_ALL=5501,
-    MECHA_PART_FIX=5502,
-    MECHA_PART_INSTALL=5503,
-    MECHA_CHANGE_ARMY_TYPE=5504,
-    MECHA_EXP_ITEM_USE=5505,
-    MECHA_CHIP_USE=5506,
-    MECHA_CHIP_REMOVE=5507,
-    MECHA_CHIP_STRENGTHEN=5508,
-    MECHA_SKIN_CHANGE=5509,
-    MECHA_SKIN_BUY=5516,
-    MECHA_CHIP_SCHEMES_SAVE=5518,
-    MECHA_CHIP_SCHEMES_USE=5519,
-    FINISH_BUBBLE=4694,
-    GET_DAILY_TASK_LITE_FINAL_REWAED=4767,
-    GET_QUICK_REPARE_INFO=1785,
-    GET_ALLIANCE_GIFT_PAGE_INFIO=5015,
-    GET_ALLIANCE_GIFT_INFO=5014,
-    STAR_DEVELOP_CHOOSE_STAR=4770,
-    STAR_DEVELOP_TRAIN=4771,
-    STAR_DEVELOP_PERFORM=4773,
-    STAR_DEVELOP_TASK_REWARD=4775,
-    STAR_RANDOM_EVENT_CHOOSE=4776,
-    STAR_DEVELOP_GET_FINAL_REWARD=4777,
-    STAR_DEVELOP_GET_ALL_OCC_UNLOCK_REWARD=4778,
-    STAR_DEVELOP_GET_SUPER_OCC_UNLOCK_REWARD=4772,
-    GET_THOR_SCIENCE=5601,
-    STUDY_THOR_SCIENCE=5602,
-    USER_FACE_VERIFY_OCR=2026,
-    USER_FACE_VERIFY_RESULT=2027,
-    GET_HERO_SWITCH_DATA=2030,
-    SAVE_HERO_SWITCH_DATA=2031,
-    EP_SET_STATUS=3150,
-    EP_STAGE_UNLOCK=3152,
-    EP_ACTIVITY_UNLOCK=3153,
-    GET_NEW_PRICE_CONFIG=4698,
-    RADAR_STORY=3518,
-    RADAR_STORY_DECODE=3519,
-    InfiniteCaveOpenBox=4699,
-    InfiniteCaveNextStage=4700,
-    ActivityEvaCharge=3916,
-    ActivityEvaStudy=3917,
-    ActivityEvaFireLog=3918,
-    EP2_SET_GUIDE=3148,
-    START_GUIDE_SET_SHOW=3149,
-    ALLIANCE_INSTRUCT_SEND=5622,
-    ALLIANCE_INSTRUCT_GET_COUNT=5621,
-    GET_ALLIANCE_INSTRUCT_LIST=5623,
-    READ_ALLIANCE_INSTRUCT=5624,
-    TOP_ALLIANCE_INSTRUCT=5625,
-    DELETE_ALLIANCE_INSTRUCT=5626,
-    GET_NEW_ALLIANCE_INSTRUCT=5627,
-    SHARE_GIFT_NOTIC=3625,
-    SHARE_GIFT_GET_COUNT_REWARD=3626,
-    SHARE_GIFT_GET_NEW_USER_REWARD=3627,
-    SHARE_GIFT_GET_LEVEL_REWARD=3628,
-    WX_UPDATE_LOGIN_CODE_TO_SERVER=795,
-    BUILD_REINFORCE_SUB_MARCH=1106,
-    REQUEST_ANNUAL_SUMMARY=4160,
-    GET_POWER_REWARD=4161,
-    Get_Home_Air_Drop_Reward=4168,
-    MECHA_CHIP_LOCK=5517,
-    COMMON_SMS_GET_CODE=1538,
-    COMMON_SMS_VERIFICATION_CODE=1539,
-    KVK_S2_ER_GET_MINE_INFO=3703,
-    KVK_S2_ER_MINE_FIGHT=3704,
-    KVK_S2_ER_RANK_INFO=3705,
-    KVK_S2_ER_MINE_FIGHT_RECORD_INFO=3706,
-    QUICK_PRODUCE_ARMY_EQUIP=1789,
-    ACTIVITY_HERO_LEVEL_UP_GET_REWARD=3160,
-    BEHEMOTH_GET_STAGE_INFO=6010,
-    GET_THRONE_PROTECT_MARCH_INFO=6017,
-    THRONE_PROTECT_BOSS_WEAK=6018,
-    GET_THRONE_PROTECT_BOX_REWARD=6019,
-    BEHEMOTH_ASK_RANDOM_MARCH=6011,
-    BEHEMOTH_INTERECPT_MARCH=6012,
-    BEHEMOTH_ASSEMBLE_GET_REWARD=6013,
-    BEHEMOTH_DONATE=6021,
-    QUICK_MERGE_ARMY_EQUIP_MATERIAL=1790,
-    WORLD_CUP_BET=3157,
-    WORLD_CUP_GET_REWARD=3158,
-    WORLD_CUP_MATCH_INFO=3159,
-    SELECT_MECHA=5520,
-    BEHEMOTH_ACTIVITY_DONATE=6014,
-    BEHEMOTH_ACTIVITY_REWARD=6015,
-    BEHEMOTH_ACTIVITY_PURCHASE=6016,
-    BEHEMOTH_ACTIVITY_SELF_REWARD=6023,
-    BEHEMOTH_ENDING_DONATE=6025,
-    BEHEMOTH_ENDING_REWARD=6026,
-    BEHEMOTH_ENDING_RANK_INFO=6027,
-    BEHEMOTH_ENDING_VOTE=6028,
-    BEHEMOTH_DONATE_SKILL_ENGERY=6031,
-    BEHEMOTH_DONATE_SKILL_LV=6032,
-    BEHEMOTH_DONATE_BUILD_LV=6033,
-    BEHEMOTH_DONATE_ARSENAL_LV=6034,
-    BEHEMOTH_FITHG_STAGE_GET_REWARD=6035,
-    BEHEMOTH_WATCH_VIDEO=6041,
-    BEHEMOTH_GET_ARSENAL_INFO=6036,
-    BEHEMOTH_GET_ARSENAL_REWARD=6038,
-    BUILD_BEHEMOTH_BUFF_TOWER=6037,
-    THIRTYTWO_FINAL_CHAMPION_GUESSING=1445,
-    THIRTYTWO_FINAL_CHAMPION_GUESSING_VOTE=1446,
-    THIRTYTWO_FINAL_CHAMPION_GUESSING_VOTE_GETREWARD=1447,
-    THIRTYTWO_FINAL_CHAMPION_VOTE_GETREWARD=1448,
-    BEHEMOTH_GET_CALL_MONSTER_LIST=6039,
-    PACIFIC_CHALLANGE_BOSS=3941,
-    BORDER_GET_BUILDING_INFO=6103,
-    BORDER_PLAYER_MOVE=6101,
-    BORDER_GET_ACHIEVEMENT_REWARD=6104,
-    BORDER_GET_LEVEL_AREA_INFO=6108,
-    BORDER_GET_FIRST_REWARD=6106,
-    BORDER_GET_SMALL_MAP_INFO=6102,
-    BORDER_GET_BOSS_RANK_REWARD=6107,
-    BORDER_SET_GUIDE=6110,
-    ASK_BEHEMOTH_STATE=6109,
-    BEHEMOTH_GET_BOSS_SKILL=6040,
-    NEW_CAB_GET_BASE_DATA=6300,
-    NEW_CAB_SIGN=6301,
-    NEW_CAB_GET_ALLIANCE_LIST=6302,
-    NEW_CAB_CHANGE_MEMBER_LIST=6303,
-    NEW_CAB_TO_CAB=6304,
-    NEW_CAB_TO_GS=6305,
-    NEW_CAB_PERSONAL_SIGN=6316,
-    AVA_BUILDING_DETAIL=6306,
-    AVA_USE_SKILL=6307,
-    NEW_CAB_GET_SITUATION_INFO=6308,
-    AVA_ARK_INFO=6309,
-    AVA_ASK_HOSPITAL_DATA=6310,
-    AVA_CURE_ALL_ARMYS_DATA=6311,
-    AVA_BATTLE_RESULT=6313,
-    AVA_SPEED_CURE=6312,
-    AVA_MINI_MAP_INFO=6314,
-    AVA_BATTLE_LOG=6315,
-    AVA_LOOK_ROOM_RESULT=6318,
-    AVA_ROOM_MEMBER_LIST=6317,
-    AVA_PERSONAL_LOG=6319,
-    CONQUEROR_WARZONE_MEMBER_RANK=6217,
-    GET_CONQUEROR_DONATE_TASK_AWARD=6230,
-    GET_CONQUEROR_DONATE_ARMY=6229,
-    CONQUEROR_SHOP_INIT=6272,
-    CONQUEROR_SHOP_BUY=6271,
-    CONQUEROR_GET_ARMYCARD=6237,
-    CONQUEROR_CONTRIBUTION_RANK=6245,
-    CONQUEROR_VERIFYARMY_RANK=6250,
-    CONQUEROR_RANK=6251,
-    CONQUEROR_ROUND_RANK=6252,
-    CONQUEROR_HERO_RANK=6253,
-    CONQUEROR_BATTLE_RANK=6254,
-    CONQUEROR_HERO_GET_REWARD=6258,
-    CONQUEROR_DONATE_SCORE_REWARD=6259,
-    CONQUEROR_ACHIEVE_REWARD=6261,
-    CONQUEROR_ACHIEVE_SCORE_REWARD=6262,
-    CONQUEROR_HALL_RANK_CURRENT=6268,
-    CONQUEROR_HALL_RANK_HISTORY=6269,
-    RELIC_ABYSM_DISPATCHED_SOLDIERS=3953,
-    Get_Colosseum_Data=6400,
-    GET_Colosseum_Room_Data=6401,
-    Colosseum_Cross_Fight=6402,
-    Get_Colosseum_Cross_Log=6403,
-    Get_Colosseum_Cross_Pos_Log=6404,
-    Colosseum_Cross_Retreat=6405,
-    GET_Colosseum_Self_Room_Data=6411,
-    Colosseum_Fight=6412,
-    Get_Colosseum_Self_Log=6413,
-    Get_Colosseum_Pos_Log=6414,
-    Colosseum_Self_Retreat=6415,
-    RELIC_MARCH_WORLD_POINT=7343,
-    PURIFICATION_TEAM_MARCH=7315,
-    GET_COLLECTABLE_PURIFICATION=7316,
-    RELIC_GVE_JOIN_RALLY=7372,
-    GET_MARCH_BY_ID_FOR_GVE_CAR=7373,
-    RELIC_GVE_JOIN_EVENT=7374,
-    RELIC_GVE_JOIN_DEFENSE=7375,
-    RELIC_GVE_DEFENSE_MARCH_INFO=7376,
-    TEAM_MATCH_CREATE_TEAM=6320,
-    TEAM_MATCH_RECOMMEND_LIST=6321,
-    TEAM_MATCH_APPLY_JOIN=6322,
-    TEAM_MATCH_GET_MY_APPLY_LIST=6323,
-    TEAM_MATCH_CANCEL_MY_APPLY=6324,
-    TEAM_MATCH_GET_TEAM_APPLY=6325,
-    TEAM_MATCH_DEAL_APPLY=6326,
-    TEAM_MATCH_CHANGE_TEAM_NAME=6327,
-    TEAM_MATCH_EXIT_TEAM=6329,
-    TEAM_MATCH_KICK_TEAM=6330,
-    TEAM_MATCH_CHANGE_POSITION=6331,
-    TEAM_MATCH_CHANGE_PREPARE_STATE=6332,
-    TEAM_MATCH_CHANGE_SIGN=6333,
-    TEAM_MATCH_CHANGE_BATTLE_TIME=6334,
-    TEAM_MATCH_GET_BATTLE_DETAIL=6335,
-    TEAM_MATCH_GET_TEAM_SITUATION=6336,
-    TEAM_MATCH_GET_TEAM_RECORD=6337,
-    TEAM_MATCH_GET_TEAM_RECORD_DETAIL=6338,
-    GET_RELIC_PILLAR_GVE_CAR_RANK=7377,
-    Infinite_Cave_Boss_Fight=3977,
-    GI_JOE_ATTACK_BOSS=3632,
-    GI_JOE_ATTACK_BOSS_CHALLENGE=3633,
-};
-} // END namespace TopwarRqstId
-
-namespace TopwarPushId {
-enum {
-    ERROR_ID = -1,
-    LOGIN = 1,
-    USER_DISCONNECT = 2,
-    PUSH_KICK_OUT = 5,
-    PUSH_MigrationRole = 11019,
-    PUSH_BUILDING = 10101,
-    PUSH_BUILDINGS = 10109,
-    PUSH_ENERGY = 10021,
-    PUSH_REWARD = 10031,
-    PUSH_REALNAME = 10032,
-    PUSH_EXP = 10041,
-    PUSH_AREA = 10104,
-    PUSH_QUESTS = 10050,
-    PUSH_QUEST = 10051,
-    DELETE_ARMY = 10202,
-    ARMY_DROP_LIST = 10204,
-    ARMY_INFO_LIST = 10205,
-    PUSH_ARMY = 10201,
-    PUSH_PAYMENT = 10501,
-    PUSH_OCCUPATIONS = 10105,
-    PUSH_POINT = 10102,
-    PUSH_REMOVE_OBSTALCE = 10103,
-    PUSH_PEOPLE = 10106,
-    PUSH_Hero_Explor_And_State_Change = 11037,
-    DROP_BUILDING = 10107,
-    PUSH_MAX_ITEM = 10709,
-    DROP_BUILDING_LIST = 10117,
-    BUILDING_INFO_LIST = 10118,
-    PUSH_UNLOCK_OCEAN = 10111,
-    PUSH_ArmyBox = 10203,
-    PUSH_TOOL = 10401,
-    PUSH_ITEMS = 10402,
-    PUSH_SHAREBOX = 10701,
-    PUSH_TimeDowns = 10702,
-    PUSH_AutoCollect = 10108,
-    PUSH_EXCHANGE = 10502,
-    PUSH_EXCHANGE_ORDERED = 10448,
-    PUSH_TIME_CARDS = 10510,
-    PUSH_ACChargeLevel = 10110,
-    PUSH_LOCAL_NOTIFICATION = 10070,
-    PUSH_AIHELP_UNREAD = 20005,
-    PUSH_Confirm_Message = 20006,
-    USER_MARCH_INFO = 10019,
-    MARCH_INFO = 10007,
-    Push_PlayerInfo_Update = 10008,
-    PUSH_TERRITORY_INFO = 10020,
-    PUSH_USE_WORLD_EFFECT_ITEM = 10413,
-    MARCH_ATTACKMONSTER_FINISH = 10163,
-    WORLD_SITE_PUSH = 10169,
-    WORLD_POINT_MARCH_PUSH = 10170,
-    WORLD_CITY_POINT_MARCH_PUSH = 11107,
-    WORLD_SITES_PUSH = 10171,
-    USER_SHIELD_PUSH = 10172,
-    PUSH_THRONE_INFO = 10173,
-    PUSH_THRONE_KING_GIFT = 10174,
-    PUSH_THRONE_TOWER_ATTACK = 10175,
-    PUSH_CROSS_FIGHT_SERVER_INFO = 10177,
-    PUSH_THRONE_BATTLE_TIME = 10178,
-    PUSH_AIRDROP_AIRPLANE = 10180,
-    PUSH_AIRDROP_DROP_CHANGE = 10181,
-    PUSH_AIRDROP_VOTE_TIME = 10183,
-    PUSH_CROSS_SERVER_FIGHT_ZONE_INFO = 10184,
-    Push_City_Skin_Interact = 10190,
-    Push_City_Skill_Data = 10191,
-    ORDER_QUEUE_INFO = 10119,
-    ORDER_QUEUES_BATCH_INFO = 10120,
-    ARMY_EQUIP_INFO_PUSH = 10121,
-    ARMY_GROUP_EQUIP_INFO_PUSH = 10125,
-    Push_Treasure_Info = 10126,
-    Push_Decoration_Suit = 10127,
-    ORDER_QUEUES_BATCH_REMOVE = 10128,
-    Treasure_Record_Push = 10122,
-    Push_Chapter_Task = 10123,
-    Push_Chapter_Task_List = 10124,
-    USERARMY_MARCHSTATE = 10164,
-    PUSH_TILEINFO = 10018,
-    PUSH_ENEMYREFRESH = 10162,
-    PUSH_OWNER_WORLD_POINT_INFO = 10165,
-    PUSH_WORLD_DESTORYED = 10166,
-    PUSH_ATTACK_ARMIES = 10167,
-    PUSH_SYSTEM_SOUND_PLAY = 20001,
-    MARCH_ATTACKBOSS_FINISH = 10266,
-    WORLD_BOSS_APPEAR = 10267,
-    WORLD_BOSS_INFO = 10268,
-    PUSH_AddFriend = 10601,
-    PUSH_DelFriend = 10602,
-    PUSH_ADDFriending = 10603,
-    PUSH_CANCELADDFriending = 10604,
-    PUSH_RESOURCE = 10001,
-    PUSH_STRTIPS = 10002,
-    PUSH_STAR = 10012,
-    Push_PVE = 10301,
-    PUSH_DAILY_QUEST_INFO = 10703,
-    PUSH_DAILY_QUEST_ALL_INFO = 10704,
-    PUSH_CLEAROBSTACLE = 10706,
-    PUSH_TILE_PVE = 10707,
-    PUSH_NOTICE = 10052,
-    PUSH_GAME_NOTICE = 10263,
-    PUSH_SINGLE_MAIL = 10264,
-    PUSH_SHAREBOX_ARMY = 1111121212,
-    PUSH_WORLD_CHAT = 10670,
-    PUSH_FreeCoin = 10801,
-    WELCOME_REWARD_STATE = 10520,
-    PUSH_GROWTH_FUND = 10511,
-    PUSH_SHOP_BUY_LIMIT = 10410,
-    PUSH_SHOP_BUY_LIMIT_TIME = 10411,
-    PUSH_USER_DATA_COMMON = 10053,
-    PUSH_NOTICE_PARA = 10054,
-    PUSH_COMMON_MESSAGE = 10057,
-    PUSH_ALLIANCE_INFO = 10420,
-    PUSH_ALLIANCE_KICKED = 10421,
-    PUSH_ALLIANCE_RANK_CHANGE = 10422,
-    PUSH_ALLIANCE_INFO_CHANGE = 10423,
-    PUSH_ALLIANCE_APPLY_CHANGE = 10424,
-    PUSH_ALLIANCE_APPLY_ACCEPTED = 10425,
-    PUSH_ALLIANCE_HELP_DATA = 10426,
-    PUSH_ALLIANCE_HELP_ADD = 10427,
-    PUSH_ALLIANCE_HELP_REMOVE = 10428,
-    PUSH_ALLIANCE_MEMBER_DYNAMIC = 10429,
-    PUSH_ALLIANCE_BUFF = 10056,
-    PUSH_BUFF = 10055,
-    PUSH_STATE = 10460,
-    PUSH_FIND_REFUGEECAMP = 10802,
-    PUSH_ITEM_GET_MONSTER = 10803,
-    PUSH_COUNTRY_NOTICE_INFO = 10362,
-    PUSH_ALLIANCE_SCIENCEDATA = 10430,
-    PUSH_ALLIANCE_DIAMOND_DONATE_NUM = 10432,
-    PUSH_ALLIANCE_SHOP = 10433,
-    PUSH_ALLIANCE_BUILDING_CHANGE = 10434,
-    PUSH_ALLIANCE_MOVE_INVITE = 10436,
-    PUSH_ALLIANCE_MEMBER_INVITE_ADD = 10443,
-    PUSH_ALLIANCE_MEMBER_INVITE_DELETE = 10444,
-    PUSH_ALLIANCE_MEMBER_INVITE_DELETEALL = 10445,
-    PushAllianceSelfHelpList = 10446,
-    PUSH_ALLIANCE_BOSS = 10435,
-    PUSH_PAY_TO_SERVER = 10503,
-    PUSH_PAY_CHECK_NOT_ENOUGH = 10506,
-    PUSH_CHATROOM_CHANGE = 11000,
-    SCIENCE_SHARE_NEWUSER = 10710,
-    SCIENCE_SHARE_USER = 10711,
-    SHARE_PUSH = 10712,
-    PUSH_ACTIVITY_STATE = 10901,
-    PUSH_TREASURE_TIME = 10902,
-    PUSH_BUILDING_BOX = 10903,
-    PUSH_ONE_ACTIVITY = 10904,
-    PUSH_BIND_ACCOUNT = 11001,
-    PUSH_SET_APP_PLAYERINFO = 11005,
-    PUSH_FORCE_CONFIG_UPDATE = 20003,
-    PUSH_ALLIANCE_Assembly = 12000,
-    PUSH_ALLIANCE_Assembly_DEL = 12001,
-    PUSH_ALLIANCE_Assembly_Success = 12002,
-    PUSH_HERO_BOND_CHANGE = 10915,
-    PUSH_ALLIANCE_Assembly_Created = 12003,
-    PUSH_ALLIANCE_Assemblyed = 12004,
-    PUSH_CASTLE_FACE_CHANGE = 10905,
-    PUSH_CASTLE_EFFECT_CHANGE = 11011,
-    PUSH_OPC_STATE_CHANGE = 13401,
-    PUSH_CASTLE_NAMEPLATE_CHANGE = 10907,
-    PUSH_CASTLE_ARMYLINE_CHANGE = 10908,
-    PUSH_HEADFRAMES_CHANGE = 10909,
-    PUSH_HERO_INFO = 10906,
-    PUSH_HERO_STATE_CHANGE = 11036,
-    PUSH_HERO_SKIN_GET = 10910,
-    PUSH_HERO_SKIN_CHANGE = 10911,
-    PUSH_HERO_DELETE = 10913,
-    PUSH_HERO_ACTIVE_SKILL_INFO = 10470,
-    EVERYDAYREWARD_UPDATE_PUSH = 10713,
-    PUSH_VIP_CHANGE = 11002,
-    PUSH_FIRST_CHARGE_BENEFIT_CHANGE = 10504,
-    MINE_INFO = 11003,
-    DUBBING_INFO = 10512,
-    WORLD_BGM_INFO = 10513,
-    G123_ORDER_TOKEN = 11022,
-    ALLIANCE_EXCHANGE_ADD = 10437,
-    ALLIANCE_EXCHANGE_HELPED = 10438,
-    ALLIANCE_EXCHANGE_CANCELED = 10439,
-    ALLIANCE_EXCHANGE_REMOVE = 10440,
-    ALLIANCE_CHAT_REWARD_PUSH = 10441,
-    PUSH_ALLIANCE_GIFT_INFO = 10442,
-    PUSH_ALLIANCE_WORLDSITE_ATTACK = 10457,
-    PUSH_HERO_PICK_CONFIG = 10921,
-    LIMIT_GIFT_POP = 11004,
-    Push_Ship_Unlock = 11025,
-    PUSH_UPDATA_DAILY_REQUEST = 10720,
-    Push_WorldTreasure_Result = 10721,
-    GROW_ROAD_INFO = 10717,
-    GROW_ROAD_SUPER_FLAG = 10716,
-    GROW_ROAD_ALL_TASK_INFO = 10714,
-    GROW_ROAD_UPDATED_TASK_INFO = 10715,
-    PUSH_SERVER_STATE = 13000,
-    PUSH_RESTART_GAME = 13001,
-    FIRST_PAY_CNY = 10505,
-    ACTIVITY_SUMMER_LOTTERY_INFO = 10718,
-    PUSH_WORLD_TREASURE_QUEST = 10719,
-    PUSH_COUNTRY_BOSS_DATA = 10722,
-    PUSH_PRODUCT_COMPLETE = 10723,
-    PUSH_UPDATE_CREDIT = 11033,
-    PUSH_MARCH_ARRIVE_EFFECT = 11034,
-    ACTIVITY_REVERSE_CARD = 11006,
-    ACTIVITY_LUCKY_DRAW_RESET = 11007,
-    PROFESSION_CHANGED_PUSH = 11101,
-    DEF_ARMY_CANDIDATE_INFO = 11102,
-    PUSH_SHOPPOINT_ACTIVITY = 11009,
-    PUSH_MY_PROFESSIONAL_TOWERS = 10182,
-    USER_MONSTER_SIEGE_INFO = 11103,
-    ALLIANCE_MONSTER_SIEGE_INFO = 11104,
-    PUSH_MOD_CHANGE = 11012,
-    DEGENERATOR_INFO_PUSH = 10514,
-    DEGENERATOR_MAIL_PUSH = 10515,
-    DEGENERATOR_REFRESH_PUSH = 10516,
-    PUSH_BUY_SCENE_GIFT_IDS = 10517,
-    WORLDBATTLE_SCORE_PUSH = 13002,
-    Push_Protect_Data = 11013,
-    Push_Paypay_Event = 11024,
-    PUSH_MILITARY_RANK = 11014,
-    MILITARY_RANK_SHOPS = 11015,
-    PUSH_ONE_ACTIVITYEXTRA = 10912,
-    PUSH_ALLIANCEBP_ACTIVITYPOINT = 10914,
-    Push_PresetMarchData = 11016,
-    Push_AdventureData = 11018,
-    GROUP_CHAT_CFG_CHANGE = 11200,
-    GROUP_CHAT_MEMBER_CHANGE = 11201,
-    PUSH_SALE_NUM_CHANGE = 10412,
-    FORMULA_MAKE_COMPLETE = 10722,
-    DEF_TRAPS_SLOTS_INFO = 11105,
-    POTION_USE_EFFECT = 20002,
-    PUSH_WORLDEMOJI_CHANGE = 11030,
-    PUSH_WORLDEMOJI_INIT = 11031,
-    PUSH_WORLDEMOJI_USE = 11029,
-    PUSH_WORLD_MARCH_EMOJI_USE = 11108,
-    PUSH_FAQ = 20004,
-    EIGHT_COUNTRY_STATUS = 13200,
-    KVK_ALLIANCE_BUILDING_STATUS_CHANGE = 13201,
-    KVK_ALLIANCE_INFO_CHANGE = 13202,
-    KVK_COUNTRY_INFO_CHANGE = 13203,
-    KVK_INFO_CHANGE = 13204,
-    EC_PREPARE_INFO_PUSH = 13211,
-    SEASON_MATCH_INFO_PUSH = 13501,
-    KVK_ACHEVEMENT_CHANGE = 13212,
-    KVK_FINISH_CHANGE = 13213,
-    KVK_PROGRESS_CHANGE = 13214,
-    KVK_EXPEDITION_FINISH_CHANGE = 13215,
-    DECORATE_STOREHOUSE_CHANGE = 10059,
-    GUN_FIGHT_INFO = 11017,
-    ALLIANCE_BADGE_AND_TASK_RED_DOT = 10447,
-    ALLIANCE_MOVE_CITY_BY_SYS = 10449,
-    Push_Status_Buff = 10060,
-    AREAN_CONFIG_PUSH = 10267,
-    CROSS_AREAN_CONFIG_PUSH = 10268,
-    TREASURE_MAP_DATA_REMOVE = 10724,
-    TREASURE_MAP_DATA_ADD = 10725,
-    TREASURE_MAP_DATA_UPDATE = 10726,
-    TREASURE_MAP_TASKS = 10727,
-    KING_MARK_PUSH = 10179,
-    EXPLORE_SEA_LEGEND_BOX_NOTICE = 10728,
-    AD_CAMPAIGN_SYNC = 10061,
-    Push_All_Science = 10062,
-    EIGHT_COUNTRY_STRONGEST_LEADER = 13216,
-    EIGHT_COUNTRY_CHANGE_TASK = 13217,
-    Push_New_Treasure_Piece_Log = 11021,
-    GLORIOUS_TRAINING_INFO = 11028,
-    Push_Transport_Effect_Data = 11027,
-    PUSH_BVACKEND_EVENT = 12005,
-    CAB_HOSPITAL_CHANGE = 13301,
-    CAB_ALLIANCE_BASE_INFO = 13302,
-    CAB_MINI_MAP_DATA = 13306,
-    CAB_BATTLE_RESULT = 13307,
-    CAB_ROOM_BASE_INFO = 13308,
-    ACT_ALLIANCE_BUILDING_STATUS_CHANGE = 10450,
-    CAB_BOMB_CAR_BOMB = 13309,
-    CAB_SHOP_BUY_TIMES = 13310,
-    CSB_SHOP_BUY_TIMES = 13003,
-    GIFT_ADD_LIST_PUSH = 11032,
-    SERVER_SCHEDULE_PUSH_INFO = 20007,
-    SERVER_SCHEDULE_TASK_INIT = 20008,
-    SERVER_SCHEDULE_TASK_COMPLETE = 20009,
-    SERVER_SCHEDULE_TASK_UPDATE = 20017,
-    EXCLUSIVE_SKILL_BUY_PUSH = 10414,
-    THIRTY_DAYS_PUSH = 20010,
-    CSB_HOSPITAL_QUEUE_CLEAR = 13004,
-    CSB_HOSPITAL_QUEUE_DELETE = 13005,
-    CSB_HOSPITAL_QUEUE_ADD = 13006,
-    CSB_HOSPITAL_QUEUE_MODIFY = 13007,
-    HEAD_PUSH = 11020,
-    EMOTION_PUSH = 11021,
-    QQGAME_VIP_PRIVILEGE = 10729,
-    RADAR_RING_CHANGE = 20025,
-    RADAR_GROUP_CHANGE = 20018,
-    RADAR_GROUP_EVENT_NUM_CHANGE = 20019,
-    RADAR_DAYGROUP_EVENT_NUM_CHANGE = 20026,
-    RADAR_STATUS_CHANGE = 20013,
-    RADAR_TIMEOUT_CHANGE = 20012,
-    PUSH_VIP_FREE_REWARD_UPDATE = 20011,
-    RADAR_ADD_ONE_TASK = 20015,
-    RADAR_OTHER_DATA_CHANGE = 20016,
-    KVK_SCIENCE = 13218,
-    PUSH_ALLIANCE_RECORD = 10452,
-    PUSH_WAITING_AREAS = 10112,
-    BULLION_CHANGE = 20034,
-    PUSH_AREA_WAR_V3 = 10730,
-    PUSH_G123_HINATAZAKA_VIDEO_UNLOCK = 10917,
-    Push_G123_MONTHLY_PAY = 20014,
-    PUSH_MARCH_RESULT = 20020,
-    PUSH_RADAR_SIGN = 20021,
-    PUSH_USER_ROLE_LIST_DETAIL = 20023,
-    PUSH_Wade_Sign = 20024,
-    LIMITED_TIME_OFFER_SCORE_EXCHANGE = 10518,
-    PUSH_CAREER_SELECTION_INFO = 11106,
-    THRITEEN_TWO_MODE_CHANGE = 13251,
-    THRITEEN_TWO_VOTE_TIME_CHANGE = 13253,
-    THIRTY_TWO_VOTE_INFO_UPDATE = 13254,
-    PUSH_EC_POWER_BUFF = 13219,
-    Push_Hot_Spring_State = 13220,
-    Push_SG_Hot_Spring_State = 13221,
-    PUSH_UPDATE_ARMY_EQUIPS = 10129,
-    PUSH_STAMP = 20027,
-    ALLIANCE_HELP_REGET = 10453,
-    HERO_DRESS_GOT = 20028,
-    ADD_EMPIRE_TREASURE_RANK = 11038,
-    TRIGGER_PUSH_GIFT = 11039,
-    DAILY_LOGIN_PUSH_GIFT = 20030,
-    PUSH_EQUIP_LIST = 11040,
-    PUSH_ALLIANCELEADER_TRANSFER = 10455,
-    Push_Alliance_Free_Zone = 10456,
-    Push_Alliance_Skill = 10363,
-    CROSS_AREAN_4C_CONFIG_PUSH = 10269,
-    CHANGE_BUFF_PUSH = 13206,
-    PUSH_RECOMPILE_TABLE = 20029,
-    PUSH_ONE_MECHA_CHANGE = 20032,
-    PUSH_ONE_MECHA_PART_CHANGE = 20033,
-    PUSH_MECHA_TASK = 10022,
-    PUSH_MECHA_CHIP_UPDATE = 20035,
-    PUSH_MECHA_SKIN_UPDATE = 20040,
-    PUSH_CHAT_MUTE = 20031,
-    PUSH_HERO_SKILL_TIPS = 11041,
-    PUSH_FR_WORLD_BOSS_STATUS = 10271,
-    PUSH_SPE_BUFF_UPDATE = 10065,
-    PUSH_DECORATE_ACTIVITY_ID = 20037,
-    PUSH_USER_FACE_VERIFY = 20036,
-    PUSH_WEB_GAME_FACE_VERIFY_RESULT = 20039,
-    PUSH_REFRESH_STORE_PRICES = 20038,
-    PUSH_REFRESH_RADAR_STRORY_TASKING = 20041,
-    PUSH_NEWEST_ALLIANCE_INSTRUCT_DATA = 10364,
-    PUSH_WAREHOUSE_UPDATE = 20042,
-    PUSH_BIND_SMS_UPDATE = 20043,
-    PUSH_ITEM_GUARANTEE = 11042,
-    PUSH_ER_MINE_UPDATE = 13222,
-    PUSH_WORLD_CUP_INFO = 20044,
-    PUSH_BEHEMOTH_STAGE_CHANGE = 21004,
-    PUSH_BEHEMOTH_ARSENAL_CHANGE = 21007,
-    PUSH_BEHEMOTH_DEFEND_BOSS_ATTACK = 21009,
-    PUSH_BEHEMOTH_ATTACK_MONSTER = 21008,
-    PUSH_BEHEMOTH_CALL_MONSTER_LIST = 21010,
-    PUSH_BEHEMOTH_BUFF_BUILDING_KICK_ALL = 21011,
-    PUSH_BORDER_WAR_CENTER_AREA_CHANGE = 21022,
-    PUSH_BORDER_LEVEL_CHANGE = 21024,
-    BORDER_WAR_USER_INFO_CHANGE = 21021,
-    PUSH_GROUP_CHAT_COLLECT_CHANGE = 11202,
-    BORDER_GORILLA_SURRENDER = 21025,
-    LOGIN_PANNEL_LIMIT = 10023,
-    PUSH_STORY_SEND_RED = 21101,
-    NEW_CAB_ALLIANCE_BASE_INFO = 21200,
-    MAF_BATTLE_SKILL_INFO = 21201,
-    NEW_CAB_BATTLEGROUND_BASE_INFO = 21202,
-    New_CAB_HOSPITAL_CHANGE = 21203,
-    AVA_MINI_MAP_DATA = 21204,
-    AVA_BATTLE_RESULT = 21205,
-    TEAM_MATCH_BASE_INFO = 21209,
-    TEAM_MATCH_BATTLE_SKILL_INFO = 21210,
-    TEAM_MATCH_CAB_HOSPITAL_CHANGE = 21211,
-    TEAM_MATCH_MINI_MAP_DATA = 21212,
-    TEAM_MATCH_BATTLE_RESULT = 21213,
-    TEAM_MATCH_BATTLEGROUND_BASE_INFO = 21206,
-    TEAM_MATCH_AIR_PLANE = 21207,
-    PUSH_UID_CREATED_SHOW_TIP = 10071,
-    PUSH_COLOSSEUM_BATTLE_DATA = 21300,
-    PUSH_Player_Back_Data = 21401,
-    PUSH_Player_Back_Account_Data = 21402,
-};
-} // END namespace TopwarPushId
+// TopwarRqstId and TopwarPushId, generated from TopwarIdsSnapshot.json
+#include "TopwarIdsGenerated.h"
 
-extern const char* rqstIdToString(int rqstId);
+/**
+ * Name of a request or push id, or the id as text when unknown.
+ * The lookups are binary searches in tables sorted at build time, so they
+ * are thread-safe and take no lock. The text of an unknown id is valid until
+ * the next call in the same thread.
+ */
+const char* rqstIdToString(int rqstId);
+optional<int> rqstIdFromString(std::string_view name);
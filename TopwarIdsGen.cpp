@@ -0,0 +1,595 @@
+// TopwarIdsGen: generates the id enums and tables of TopwarIds from a snapshot
+// of the game data (TopwarIdsSnapshot.json), run by the build.
+//
+// Snapshot layout, the lists are kept in the order of the game:
+//   "source": where the snapshot was taken from, copied into the outputs
+//   "requests", "pushes": [name, id] of the request and push ids
+//   "items": [id, name]
+//   "allianceSciences": [scienceId, maxLevel, name]
+//   "worldSites": [siteId, kind], kind is a WorldSite::种类 value
+//
+// Outputs, written only when changed so that an unchanged snapshot rebuilds nothing:
+//   TopwarIdsGenerated.h: the TopwarRqstId and TopwarPushId enums
+//   TopwarIdsData.inc: the lookup tables, sorted, included by TopwarIds.cpp. The
+//   item, science and site tables are only used when the catalog is not loaded
+//   with --catalog: the game data catalog read at run time, see GameCatalog
+//
+// With --from-bundle <index.js>, the request and push ids are instead read from
+// the game's main JS bundle (assets/main/index.<hash>.js) and written into the
+// snapshot, keeping its other lists:
+//   TopwarIdsGen --from-bundle index.<hash>.js TopwarIdsSnapshot.json
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QDir>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QRegularExpression>
+#include <QSaveFile>
+#include <QSet>
+#include <QTextStream>
+#include <algorithm>
+#include <map>
+#include "common.h"
+#include "GameCatalog.h"
+
+namespace {
+
+struct NamedId {
+    QString name;
+    int id;
+};
+
+struct Science {
+    int id;
+    int maxLevel;
+    QString name;
+};
+
+struct Snapshot {
+    QString source;
+    std::vector<NamedId> requests;
+    std::vector<NamedId> pushes;
+    std::vector<NamedId> items;
+    std::vector<Science> sciences;
+    std::vector<pair<int, int>> sites;
+};
+
+class Generator {
+public:
+    bool load(const QString &path);
+    bool fromJson(const QJsonObject &obj);
+    QByteArray enumsHeader() const;
+    QByteArray dataTables() const;
+    QByteArray catalog() const;
+
+    QString error;
+
+private:
+    bool readIds(const QJsonObject &obj, const QString &key, std::vector<NamedId> &out);
+    bool readItems(const QJsonObject &obj);
+    bool readSciences(const QJsonObject &obj);
+    bool readSites(const QJsonObject &obj);
+    bool fail(const QString &msg) {
+        error = msg;
+        return false;
+    }
+
+    Snapshot snapshot;
+};
+
+bool isIdentifier(const QString &s) {
+    if (s.isEmpty() || s.front().isDigit()) {
+        return false;
+    }
+    return std::all_of(s.begin(), s.end(), [](QChar c) {
+        return (c >= u'a' && c <= u'z') || (c >= u'A' && c <= u'Z') || (c >= u'0' && c <= u'9') || c == u'_';
+    });
+}
+
+bool isInt(const QJsonValue &v) {
+    return v.isDouble() && v.toDouble() == v.toInt();
+}
+
+QByteArray cppString(const QString &s) {
+    QByteArray ret = s.toUtf8();
+    ret.replace('\\', "\\\\").replace('"', "\\\"");
+    return ret;
+}
+
+bool Generator::load(const QString &path) {
+    QFile file{path};
+    if (!file.open(QIODevice::ReadOnly)) {
+        return fail(path + u": "_s + file.errorString());
+    }
+    QJsonParseError parseError;
+    QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (!doc.isObject()) {
+        return fail(path + u": "_s + parseError.errorString());
+    }
+    return fromJson(doc.object());
+}
+
+bool Generator::fromJson(const QJsonObject &obj) {
+    snapshot = {};
+    snapshot.source = obj.value(u"source"_s).toString();
+    return readIds(obj, u"requests"_s, snapshot.requests)
+           && readIds(obj, u"pushes"_s, snapshot.pushes)
+           && readItems(obj)
+           && readSciences(obj)
+           && readSites(obj);
+}
+
+bool Generator::readIds(const QJsonObject &obj, const QString &key, std::vector<NamedId> &out) {
+    QSet<QString> names;
+    for (const QJsonValue &v : obj.value(key).toArray()) {
+        QJsonArray entry = v.toArray();
+        if (entry.size() != 2 || !isIdentifier(entry[0].toString()) || !isInt(entry[1])) {
+            return fail(key + u": bad entry "_s + QString::fromUtf8(QJsonDocument{entry}.toJson(QJsonDocument::Compact)));
+        }
+        QString name = entry[0].toString();
+        if (names.contains(name)) {
+            return fail(key + u": duplicate name "_s + name);
+        }
+        names.insert(name);
+        out.push_back({name, entry[1].toInt()});
+    }
+    if (out.empty()) {
+        return fail(key + u": missing"_s);
+    }
+    return true;
+}
+
+bool Generator::readItems(const QJsonObject &obj) {
+    QSet<int> ids;
+    for (const QJsonValue &v : obj.value(u"items"_s).toArray()) {
+        QJsonArray entry = v.toArray();
+        if (entry.size() != 2 || !isInt(entry[0]) || entry[1].toString().isEmpty()) {
+            return fail(u"items: bad entry "_s + QString::fromUtf8(QJsonDocument{entry}.toJson(QJsonDocument::Compact)));
+        }
+        int id = entry[0].toInt();
+        if (ids.contains(id)) {
+            return fail(u"items: duplicate id "_s + QString::number(id));
+        }
+        ids.insert(id);
+        snapshot.items.push_back({entry[1].toString(), id});
+    }
+    return true;
+}
+
+bool Generator::readSciences(const QJsonObject &obj) {
+    QSet<int> ids;
+    for (const QJsonValue &v : obj.value(u"allianceSciences"_s).toArray()) {
+        QJsonArray entry = v.toArray();
+        if (entry.size() != 3 || !isInt(entry[0]) || !isInt(entry[1]) || entry[1].toInt() < 1
+            || !entry[2].isString()) {
+            return fail(u"allianceSciences: bad entry "_s + QString::fromUtf8(QJsonDocument{entry}.toJson(QJsonDocument::Compact)));
+        }
+        int id = entry[0].toInt();
+        if (ids.contains(id)) {
+            return fail(u"allianceSciences: duplicate id "_s + QString::number(id));
+        }
+        ids.insert(id);
+        snapshot.sciences.push_back({id, entry[1].toInt(), entry[2].toString()});
+    }
+    return true;
+}
+
+bool Generator::readSites(const QJsonObject &obj) {
+    QSet<int> ids;
+    for (const QJsonValue &v : obj.value(u"worldSites"_s).toArray()) {
+        QJsonArray entry = v.toArray();
+        if (entry.size() != 2 || !isInt(entry[0]) || !isInt(entry[1])) {
+            return fail(u"worldSites: bad entry "_s + QString::fromUtf8(QJsonDocument{entry}.toJson(QJsonDocument::Compact)));
+        }
+        int id = entry[0].toInt();
+        if (ids.contains(id)) {
+            return fail(u"worldSites: duplicate id "_s + QString::number(id));
+        }
+        ids.insert(id);
+        snapshot.sites.push_back({id, entry[1].toInt()});
+    }
+    return true;
+}
+
+QByteArray generatedNotice(const QString &source) {
+    QByteArray ret = "// Generated by TopwarIdsGen from TopwarIdsSnapshot.json, do not edit\n";
+    if (!source.isEmpty()) {
+        ret += "// Snapshot source: " + source.toUtf8() + '\n';
+    }
+    return ret;
+}
+
+QByteArray Generator::enumsHeader() const {
+    QByteArray out = generatedNotice(snapshot.source);
+    out += "#pragma once\n";
+    auto writeEnum = [&out](const char *ns, const std::vector<NamedId> &ids) {
+        out += "\nnamespace "_ba + ns + " {\nenum {\n";
+        for (const NamedId &e : ids) {
+            out += "    " + e.name.toUtf8() + " = " + QByteArray::number(e.id) + ",\n";
+        }
+        out += "};\n} // END namespace "_ba + ns + '\n';
+    };
+    writeEnum("TopwarRqstId", snapshot.requests);
+    writeEnum("TopwarPushId", snapshot.pushes);
+    return out;
+}
+
+QByteArray Generator::dataTables() const {
+    QByteArray out = generatedNotice(snapshot.source);
+
+    // The name of an id used by a request and a push is the one of the request
+    std::map<int, QByteArray> namesById;
+    for (const auto *ids : {&snapshot.requests, &snapshot.pushes}) {
+        for (const NamedId &e : *ids) {
+            namesById.try_emplace(e.id, e.name.toUtf8());
+        }
+    }
+    // index in RqstIdsById of each name, the first id of a name used by several ones
+    std::map<QByteArray, int> indexByName;
+    out += "\nconstexpr RqstIdName RqstIdsById[] = {\n";
+    int index = 0;
+    for (const auto &[id, name] : namesById) {
+        out += "    {" + QByteArray::number(id) + ", \"" + name + "\"},\n";
+        indexByName.try_emplace(name, index++);
+    }
+    out += "};\n";
+
+    // sorted by byte, as std::string_view compares
+    out += "\nconstexpr uint16_t RqstIdsByName[] = {\n";
+    int column = 0;
+    for (const auto &[name, i] : indexByName) {
+        out += column == 0 ? "    " : " ";
+        out += QByteArray::number(i) + ',';
+        if (++column == 16) {
+            out += '\n';
+            column = 0;
+        }
+    }
+    out += column == 0 ? "};\n" : "\n};\n";
+
+    std::vector<NamedId> items = snapshot.items;
+    std::sort(items.begin(), items.end(), [](const NamedId &a, const NamedId &b) { return a.id < b.id; });
+    out += "\nconstexpr IdName ItemNames[] = {\n";
+    for (const NamedId &e : items) {
+        out += "    {" + QByteArray::number(e.id) + ", u\"" + cppString(e.name) + "\"},\n";
+    }
+    out += "};\n";
+
+    std::vector<Science> sciences = snapshot.sciences;
+    std::sort(sciences.begin(), sciences.end(), [](const Science &a, const Science &b) { return a.id < b.id; });
+    out += "\nconstexpr ScienceData AllianceSciences[] = {\n";
+    for (const Science &e : sciences) {
+        out += "    {" + QByteArray::number(e.id) + ", " + QByteArray::number(e.maxLevel)
+               + ", u\"" + cppString(e.name) + "\"},\n";
+    }
+    out += "};\n";
+
+    std::vector<pair<int, int>> sites = snapshot.sites;
+    std::sort(sites.begin(), sites.end());
+    out += "\nconstexpr SiteKind WorldSiteKinds[] = {\n";
+    for (const auto &[id, kind] : sites) {
+        out += "    {" + QByteArray::number(id) + ", " + QByteArray::number(kind) + "},\n";
+    }
+    out += "};\n";
+    return out;
+}
+
+// Appends strings to the pool of a catalog, each distinct one once
+class StringPool {
+public:
+    // offset and length in characters
+    pair<uint32_t, uint32_t> intern(const QString &s) {
+        auto [it, inserted] = offsets.try_emplace(s, static_cast<uint32_t>(pool.size()));
+        if (inserted) {
+            pool.append(s);
+        }
+        return {it->second, static_cast<uint32_t>(s.size())};
+    }
+
+    const QString& data() const { return pool; }
+
+private:
+    QString pool;
+    std::map<QString, uint32_t> offsets;
+};
+
+template <class T>
+void putRaw(QByteArray &buf, T val) {
+    val = qToLittleEndian(val);
+    buf.append(reinterpret_cast<const char*>(&val), sizeof(val));
+}
+
+void alignTo4(QByteArray &buf) {
+    while (buf.size() % 4 != 0) {
+        buf.append('\0');
+    }
+}
+
+QByteArray Generator::catalog() const {
+    std::vector<NamedId> items = snapshot.items;
+    std::sort(items.begin(), items.end(), [](const NamedId &a, const NamedId &b) { return a.id < b.id; });
+    std::vector<Science> sciences = snapshot.sciences;
+    std::sort(sciences.begin(), sciences.end(), [](const Science &a, const Science &b) { return a.id < b.id; });
+    std::vector<pair<int, int>> sites = snapshot.sites;
+    std::sort(sites.begin(), sites.end());
+
+    StringPool strings;
+    QByteArray itemTable;
+    for (const NamedId &e : items) {
+        auto [offset, len] = strings.intern(e.name);
+        putRaw<int32_t>(itemTable, e.id);
+        putRaw<uint32_t>(itemTable, offset);
+        putRaw<uint32_t>(itemTable, len);
+    }
+    QByteArray scienceTable;
+    for (const Science &e : sciences) {
+        auto [offset, len] = strings.intern(e.name);
+        putRaw<int32_t>(scienceTable, e.id);
+        putRaw<int32_t>(scienceTable, e.maxLevel);
+        putRaw<uint32_t>(scienceTable, offset);
+        putRaw<uint32_t>(scienceTable, len);
+    }
+    QByteArray siteTable;
+    for (const auto &[id, kind] : sites) {
+        putRaw<int32_t>(siteTable, id);
+        putRaw<int32_t>(siteTable, kind);
+    }
+
+    const uint32_t itemsOffset = GameCatalogHeaderSize;
+    const uint32_t sciencesOffset = itemsOffset + itemTable.size();
+    const uint32_t sitesOffset = sciencesOffset + scienceTable.size();
+    const uint32_t stringsOffset = sitesOffset + siteTable.size();
+
+    QByteArray out{GameCatalogMagic.toByteArray()};
+    putRaw<uint32_t>(out, GameCatalogVersion);
+    putRaw<uint32_t>(out, items.size());
+    putRaw<uint32_t>(out, itemsOffset);
+    putRaw<uint32_t>(out, sciences.size());
+    putRaw<uint32_t>(out, sciencesOffset);
+    putRaw<uint32_t>(out, sites.size());
+    putRaw<uint32_t>(out, sitesOffset);
+    putRaw<uint32_t>(out, stringsOffset);
+    putRaw<uint32_t>(out, strings.data().size());
+    Q_ASSERT(out.size() == GameCatalogHeaderSize);
+    // the records are multiples of 4 bytes, so every table stays aligned
+    out += itemTable;
+    out += scienceTable;
+    out += siteTable;
+    for (QChar c : strings.data()) {
+        putRaw<uint16_t>(out, c.unicode());
+    }
+    alignTo4(out);
+    return out;
+}
+
+bool writeIfChanged(const QString &path, const QByteArray &content, QString &error) {
+    QFile old{path};
+    if (old.open(QIODevice::ReadOnly) && old.readAll() == content) {
+        return true;
+    }
+    old.close();
+    QSaveFile file{path};
+    if (!file.open(QIODevice::WriteOnly) || file.write(content) != content.size() || !file.commit()) {
+        error = path + u": "_s + file.errorString();
+        return false;
+    }
+    return true;
+}
+
+// Names found in one of the tables only, present in every version of the game so far
+const QString RqstTableMarker = u"LOGIN_OVER"_s;
+const QString PushTableMarker = u"PUSH_KICK_OUT"_s;
+
+/**
+ * Reads the id table whose keys include marker from a JS bundle. The table is
+ * an object literal {NAME:1,...} or a compiled TypeScript enum
+ * e[e.NAME=1]="NAME", the innermost braces around marker. The ids are kept in
+ * the order of the bundle.
+ */
+bool extractIds(const QString &js, const QString &marker, std::vector<NamedId> &out, QString &error) {
+    // a key of an object literal, maybe quoted, or a member assigned in an enum
+    const QString key = uR"((?:[{,]\s*(["']?)(%1)\1\s*:|\.(%1)\s*=)\s*(-?\d+))"_s;
+    const QRegularExpression markerRe{key.arg(QRegularExpression::escape(marker))};
+    QRegularExpressionMatch match = markerRe.match(js);
+    if (!match.hasMatch()) {
+        error = marker + u" not found in the bundle"_s;
+        return false;
+    }
+    qsizetype begin = match.capturedStart();
+    for (int depth = 0; begin >= 0; begin--) {
+        if (js[begin] == u'}') {
+            depth++;
+        } else if (js[begin] == u'{' && depth-- == 0) {
+            break;
+        }
+    }
+    qsizetype end = begin + 1;
+    for (int depth = 0; end < js.size(); end++) {
+        if (js[end] == u'{') {
+            depth++;
+        } else if (js[end] == u'}' && depth-- == 0) {
+            break;
+        }
+    }
+    if (begin < 0 || end >= js.size()) {
+        error = u"unbalanced braces around "_s + marker;
+        return false;
+    }
+
+    const QRegularExpression entryRe{key.arg(uR"([A-Za-z_]\w*)"_s)};
+    QSet<QString> names;
+    auto it = entryRe.globalMatch(QStringView{js}.sliced(begin, end - begin));
+    while (it.hasNext()) {
+        QRegularExpressionMatch m = it.next();
+        QString name = m.captured(2).isEmpty() ? m.captured(3) : m.captured(2);
+        bool ok;
+        int id = m.captured(4).toInt(&ok);
+        if (!ok) {
+            error = u"bad id of "_s + name;
+            return false;
+        }
+        if (names.contains(name)) {
+            error = u"duplicate name "_s + name + u" in the table of "_s + marker;
+            return false;
+        }
+        names.insert(name);
+        out.push_back({name, id});
+    }
+    return true;
+}
+
+QByteArray jsonValue(const QJsonValue &v) {
+    QByteArray s = QJsonDocument{QJsonArray{v}}.toJson(QJsonDocument::Compact);
+    return s.sliced(1, s.size() - 2);
+}
+
+// In the layout of the checked-in file, one entry per line
+QByteArray snapshotJson(const QJsonObject &obj) {
+    QByteArray out = "{\n    \"source\": " + jsonValue(obj.value(u"source"_s)) + ",\n";
+    const std::array keys{"requests", "pushes", "items", "allianceSciences", "worldSites"};
+    for (size_t i = 0; i < keys.size(); i++) {
+        out += "    \""_ba + keys[i] + "\": [\n";
+        const QJsonArray entries = obj.value(QLatin1StringView{keys[i]}).toArray();
+        for (qsizetype j = 0; j < entries.size(); j++) {
+            out += "        [";
+            const QJsonArray entry = entries[j].toArray();
+            for (qsizetype k = 0; k < entry.size(); k++) {
+                out += (k == 0 ? "" : ", ") + jsonValue(entry[k]);
+            }
+            out += j + 1 < entries.size() ? "],\n" : "]\n";
+        }
+        out += i + 1 < keys.size() ? "    ],\n" : "    ]\n";
+    }
+    out += "}\n";
+    return out;
+}
+
+QJsonArray idsJson(const std::vector<NamedId> &ids) {
+    QJsonArray ret;
+    for (const NamedId &e : ids) {
+        ret.append(QJsonArray{e.name, e.id});
+    }
+    return ret;
+}
+
+// "1416 ids, 3 added, 1 removed, 2 renumbered" against the ids of the old snapshot
+QString idsChange(const QJsonArray &oldIds, const std::vector<NamedId> &ids) {
+    QHash<QString, int> oldByName;
+    for (const QJsonValue &v : oldIds) {
+        oldByName.insert(v[0].toString(), v[1].toInt());
+    }
+    int added = 0;
+    int renumbered = 0;
+    for (const NamedId &e : ids) {
+        auto it = oldByName.constFind(e.name);
+        if (it == oldByName.constEnd()) {
+            added++;
+        } else if (it.value() != e.id) {
+            renumbered++;
+        }
+    }
+    qsizetype removed = oldByName.size() - (qsizetype(ids.size()) - added);
+    return u"%1 ids, %2 added, %3 removed, %4 renumbered"_s
+        .arg(ids.size()).arg(added).arg(removed).arg(renumbered);
+}
+
+// Replaces the request and push ids of the snapshot with the ones of the bundle
+bool importBundle(const QString &bundlePath, const QString &snapshotPath, QTextStream &out, QString &error) {
+    QFile bundle{bundlePath};
+    if (!bundle.open(QIODevice::ReadOnly)) {
+        error = bundlePath + u": "_s + bundle.errorString();
+        return false;
+    }
+    const QString js = QString::fromUtf8(bundle.readAll());
+    std::vector<NamedId> requests;
+    std::vector<NamedId> pushes;
+    if (!extractIds(js, RqstTableMarker, requests, error) || !extractIds(js, PushTableMarker, pushes, error)) {
+        error = bundlePath + u": "_s + error;
+        return false;
+    }
+
+    QFile file{snapshotPath};
+    if (!file.open(QIODevice::ReadOnly)) {
+        error = snapshotPath + u": "_s + file.errorString();
+        return false;
+    }
+    QJsonParseError parseError;
+    QJsonObject obj = QJsonDocument::fromJson(file.readAll(), &parseError).object();
+    if (obj.isEmpty()) {
+        error = snapshotPath + u": "_s + parseError.errorString();
+        return false;
+    }
+    file.close();
+    out << "requests: " << idsChange(obj.value(u"requests"_s).toArray(), requests) << Qt::endl;
+    out << "pushes: " << idsChange(obj.value(u"pushes"_s).toArray(), pushes) << Qt::endl;
+    obj.insert(u"source"_s, u"request and push ids from "_s + QFileInfo{bundlePath}.fileName());
+    obj.insert(u"requests"_s, idsJson(requests));
+    obj.insert(u"pushes"_s, idsJson(pushes));
+
+    // checked as the build will read it
+    Generator gen;
+    if (!gen.fromJson(obj)) {
+        error = gen.error;
+        return false;
+    }
+    return writeIfChanged(snapshotPath, snapshotJson(obj), error);
+}
+
+} // END anonymous namespace
+
+int main(int argc, char *argv[]) {
+    QCoreApplication app(argc, argv);
+    QCoreApplication::setApplicationName(u"TopwarIdsGen"_s);
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(u"Generates the TopwarIds enums and tables from a game data snapshot."_s);
+    parser.addHelpOption();
+    parser.addPositionalArgument(u"snapshot"_s, u"The snapshot, TopwarIdsSnapshot.json."_s);
+    parser.addPositionalArgument(u"outdir"_s, u"Directory of the generated files, not used with --from-bundle."_s);
+    QCommandLineOption catalogOpt{u"catalog"_s, u"Also write the game data catalog to this file."_s, u"file"_s};
+    QCommandLineOption bundleOpt{u"from-bundle"_s,
+                                 u"Update the request and push ids of the snapshot from the game's main JS bundle."_s,
+                                 u"index.js"_s};
+    parser.addOptions({catalogOpt, bundleOpt});
+    parser.process(app);
+
+    const QStringList args = parser.positionalArguments();
+    QTextStream err{stderr};
+    if (parser.isSet(bundleOpt)) {
+        if (args.size() != 1) {
+            parser.showHelp(2);
+        }
+        QTextStream out{stdout};
+        QString error;
+        if (!importBundle(parser.value(bundleOpt), args[0], out, error)) {
+            err << "TopwarIdsGen: " << error << Qt::endl;
+            return 1;
+        }
+        return 0;
+    }
+    if (args.size() != 2) {
+        parser.showHelp(2);
+    }
+
+    Generator gen;
+    if (!gen.load(args[0])) {
+        err << "TopwarIdsGen: " << gen.error << Qt::endl;
+        return 1;
+    }
+    QDir outDir{args[1]};
+    if (!outDir.mkpath(u"."_s)) {
+        err << "TopwarIdsGen: can not create " << args[1] << Qt::endl;
+        return 1;
+    }
+    QString error;
+    if (!writeIfChanged(outDir.filePath(u"TopwarIdsGenerated.h"_s), gen.enumsHeader(), error)
+        || !writeIfChanged(outDir.filePath(u"TopwarIdsData.inc"_s), gen.dataTables(), error)
+        || (parser.isSet(catalogOpt) && !writeIfChanged(parser.value(catalogOpt), gen.catalog(), error))) {
+        err << "TopwarIdsGen: " << error << Qt::endl;
+        return 1;
+    }
+    return 0;
+}
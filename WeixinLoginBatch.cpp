@@ -0,0 +1,327 @@
+#include <QtCore>
+#include "WeixinLoginBatch.h"
+#include "WeixinLoginDialog.h"
+#include "GameSessionRqst.h"
+#include "log.h"
+
+using namespace HttpRqst;
+
+// requests in flight over all slots
+constexpr int MaxConcurrentRqsts = 16;
+// how long until every waiting slot is polled once, when they can not all be held
+constexpr auto TargetPollCycle = 20s;
+constexpr auto MinPollHoldTime = 3s;
+constexpr auto MaxPollHoldTime = 60s;
+constexpr int MaxRqstRetries = 3;
+// expired QR codes are replaced automatically for a while, then wait for a click
+constexpr int MaxAutoRefreshes = 3;
+
+struct WxPollResult {
+    int result;
+    QString code;
+};
+
+static QString qrCodeContent(const QString &uuid) {
+    return u"https://open.weixin.qq.com/connect/confirm?uuid="_s + uuid;
+}
+
+WeixinLoginBatch::WeixinLoginBatch(const QString &appId, const QString &redirectUri,
+                                   RqstExecutor &executor, QObject *parent)
+    : QObject{parent}, appId{appId}, redirectUri{redirectUri}, executor{executor}
+{
+    scheduleTimer.setSingleShot(true);
+    scheduleTimer.callOnTimeout(this, &WeixinLoginBatch::schedule);
+}
+
+WeixinLoginBatch::~WeixinLoginBatch() = default;
+
+int WeixinLoginBatch::addSlots(int n) {
+    int first = qrSlots.size();
+    for (int i = 0; i < n; i++) {
+        qrSlots.emplace_back().nextRqstTime = SteadyClockNow();
+    }
+    schedule();
+    return first;
+}
+
+int WeixinLoginBatch::slotCount() const {
+    return qrSlots.size();
+}
+
+WeixinLoginBatch::Status WeixinLoginBatch::getStatus(int index) const {
+    return qrSlots[index].status;
+}
+
+int WeixinLoginBatch::doneCount() const {
+    return std::ranges::count_if(qrSlots, [](const QrSlot &slot) {
+        return slot.status == Status::Done;
+    });
+}
+
+void WeixinLoginBatch::refresh(int index) {
+    QrSlot &slot = qrSlots[index];
+    if (slot.status != Status::Expired && slot.status != Status::Error) {
+        return;
+    }
+    slot.errorCnt = 0;
+    slot.autoRefreshCnt = 0;
+    slot.nextRqstTime = SteadyClockNow();
+    setStatus(index, Status::Loading);
+    schedule();
+}
+
+void WeixinLoginBatch::setQrSaveDir(const QString &dir) {
+    qrSaveDir = dir;
+    if (qrSaveDir.isEmpty()) {
+        return;
+    }
+    QDir{}.mkpath(qrSaveDir);
+    for (size_t i = 0; i < qrSlots.size(); i++) {
+        saveQrCode(i);
+    }
+    log() << u"二维码图片保存在 "_s << QDir::toNativeSeparators(qrSaveDir);
+}
+
+void WeixinLoginBatch::schedule() {
+    auto now = SteadyClockNow();
+    optional<SteadyTimepoint> nextTime;
+    auto isDue = [&](const QrSlot &slot) {
+        switch (slot.status) {
+        case Status::Loading: case Status::Waiting: case Status::Scanned: case Status::Canceled:
+            break;
+        default:
+            return false;
+        }
+        if (slot.inFlight) {
+            return false;
+        }
+        if (slot.nextRqstTime > now) {
+            nextTime = min(nextTime.value_or(slot.nextRqstTime), slot.nextRqstTime);
+            return false;
+        }
+        return true;
+    };
+
+    // the user is confirming on scanned slots, so they go first
+    for (size_t i = 0; i < qrSlots.size() && inFlightCnt < MaxConcurrentRqsts; i++) {
+        if (qrSlots[i].status == Status::Scanned && isDue(qrSlots[i])) {
+            startRqst(i);
+        }
+    }
+    // round robin over the others, so that no slot starves when there are more than the cap
+    size_t start = cursor;
+    for (size_t n = 0; n < qrSlots.size() && inFlightCnt < MaxConcurrentRqsts; n++) {
+        size_t i = (start + n) % qrSlots.size();
+        if (isDue(qrSlots[i])) {
+            startRqst(i);
+            cursor = i + 1;
+        }
+    }
+
+    // slots still due are started when a request finishes
+    if (nextTime.has_value()) {
+        scheduleTimer.start(max(DurationCast::ceil<milliseconds>(*nextTime - now), 0ms));
+    }
+}
+
+void WeixinLoginBatch::startRqst(int index) {
+    QrSlot &slot = qrSlots[index];
+    slot.inFlight = true;
+    inFlightCnt++;
+    if (slot.status == Status::Loading) {
+        rqstLoginUrl(index);
+    } else {
+        pollStatus(index);
+    }
+}
+
+void WeixinLoginBatch::onRqstFinished(int index) {
+    QrSlot &slot = qrSlots[index];
+    slot.inFlight = false;
+    inFlightCnt--;
+    // in the next round, not this call stack
+    scheduleTimer.start(0ms);
+}
+
+milliseconds WeixinLoginBatch::pollHoldTime() const {
+    auto pollingCnt = std::ranges::count_if(qrSlots, [](const QrSlot &slot) {
+        return slot.status == Status::Waiting || slot.status == Status::Scanned
+               || slot.status == Status::Canceled;
+    });
+    if (pollingCnt <= MaxConcurrentRqsts) {
+        return MaxPollHoldTime;
+    }
+    milliseconds t = milliseconds{TargetPollCycle} * MaxConcurrentRqsts / pollingCnt;
+    return std::clamp<milliseconds>(t, MinPollHoldTime, MaxPollHoldTime);
+}
+
+void WeixinLoginBatch::rqstLoginUrl(int index) {
+    QUrlQuery params{
+        {u"appid"_s, appId},
+        {u"scope"_s, u"snsapi_login"_s},
+        {u"redirect_uri"_s, redirectUri},
+        {u"state"_s, generateTempId()},
+        {u"login_type"_s, u"jssdk"_s},
+        {u"self_redirect"_s, u"true"_s},
+        {u"styletype"_s, QString{}},
+        {u"sizetype"_s, QString{}},
+        {u"bgcolor"_s, QString{}},
+        {u"rst"_s, QString{}},
+        {u"style"_s, u"white"_s}
+    };
+    QNetworkRequest rqst = makeWxRqst(u"https://open.weixin.qq.com/connect/qrconnect"_s, params);
+    qrSlots[index].rqst = executor.run(this,
+        [rqst] {
+            static const QRegExp re{uR"#(/connect/l/qrconnect\?uuid=([^"]+))#"_s};
+            return RqstHandler<QString>{getNamInst()->get(rqst), [](QNetworkReply *r) -> Expected<QString> {
+                unique_ptr<RqstError> err = checkReplyError(r);
+                if (err != nullptr) {
+                    return std::move(err);
+                }
+                auto m = re.match(QString::fromUtf8(r->readAll()));
+                if (!m.hasMatch()) {
+                    return makeApiRespError(u"uuid not found"_s);
+                }
+                return m.captured(1);
+            }};
+        },
+        [this, index](QString uuid) {
+            onRqstFinished(index);
+            QrSlot &slot = qrSlots[index];
+            slot.uuid = uuid;
+            slot.lastResult = 0;
+            slot.pollCnt = 0;
+            slot.errorCnt = 0;
+            slot.nextRqstTime = SteadyClockNow();
+            setStatus(index, Status::Waiting);
+            emit qrCodeChanged(index, qrCodeContent(uuid));
+            saveQrCode(index);
+        },
+        [this, index](const RqstError &err) { onRqstFailed(index, err); }
+    );
+}
+
+void WeixinLoginBatch::pollStatus(int index) {
+    QrSlot &slot = qrSlots[index];
+    if (slot.pollCnt == 0) {
+        slot.firstPollTs = QDateTime::currentMSecsSinceEpoch();
+    }
+    slot.pollCnt++;
+
+    QUrlQuery params;
+    params.addQueryItem(u"uuid"_s, slot.uuid);
+    params.addQueryItem(u"_"_s, QString::number(slot.firstPollTs + slot.pollCnt));
+    if (slot.lastResult != 0) {
+        params.addQueryItem(u"last"_s, QString::number(slot.lastResult));
+    }
+    QNetworkRequest rqst = makeWxRqst(u"https://lp.open.weixin.qq.com/connect/l/qrconnect"_s, params);
+    rqst.setTransferTimeout(pollHoldTime().count());
+    slot.rqst = executor.run(this,
+        [rqst] {
+            static const QRegExp re{uR"#(window\.wx_errcode=([0-9]+);window\.wx_code='([^']*)';)#"_s};
+            return RqstHandler<WxPollResult>{getNamInst()->get(rqst), [](QNetworkReply *r) -> Expected<WxPollResult> {
+                if (r->error() == QNetworkReply::OperationCanceledError) {
+                    // TransferTimeout. Nothing happened while the poll was held
+                    return WxPollResult{408, {}};
+                }
+                unique_ptr<RqstError> err = checkReplyError(r);
+                if (err != nullptr) {
+                    return std::move(err);
+                }
+                auto m = re.match(QString::fromUtf8(r->readAll()));
+                if (!m.hasMatch()) {
+                    return makeApiRespError(u"unexpected poll response"_s);
+                }
+                return WxPollResult{m.captured(1).toInt(), m.captured(2)};
+            }};
+        },
+        [this, index](WxPollResult res) {
+            onRqstFinished(index);
+            onPollResult(index, res.result, res.code);
+        },
+        [this, index](const RqstError &err) { onRqstFailed(index, err); }
+    );
+}
+
+void WeixinLoginBatch::onPollResult(int index, int result, const QString &code) {
+    QrSlot &slot = qrSlots[index];
+    slot.errorCnt = 0;
+    slot.lastResult = 0;
+    auto now = SteadyClockNow();
+    switch (result) {
+    case 408:
+        slot.nextRqstTime = now;
+        break;
+    case 404:
+        slot.lastResult = 404;
+        slot.nextRqstTime = now + 100ms;
+        setStatus(index, Status::Scanned);
+        break;
+    case 405:
+        removeQrCode(index);
+        setStatus(index, Status::Done);
+        qDebug() << "wx login success." << index << code;
+        emit codeReceived(index, code);
+        break;
+    case 403:
+        slot.lastResult = 403;
+        slot.nextRqstTime = now + 2s;
+        setStatus(index, Status::Canceled);
+        break;
+    case 402: case 500:
+        removeQrCode(index);
+        if (slot.autoRefreshCnt < MaxAutoRefreshes) {
+            slot.autoRefreshCnt++;
+            slot.nextRqstTime = now;
+            setStatus(index, Status::Loading);
+        } else {
+            setStatus(index, Status::Expired);
+        }
+        break;
+    default:
+        slot.nextRqstTime = now + 2s;
+        break;
+    }
+}
+
+void WeixinLoginBatch::onRqstFailed(int index, const RqstError &err) {
+    onRqstFinished(index);
+    QrSlot &slot = qrSlots[index];
+    qDebug() << "wx login request failed." << index << err.getDescription();
+    slot.errorCnt++;
+    if (slot.errorCnt > MaxRqstRetries) {
+        removeQrCode(index);
+        setStatus(index, Status::Error);
+        return;
+    }
+    slot.nextRqstTime = SteadyClockNow() + 2s * slot.errorCnt;
+}
+
+void WeixinLoginBatch::setStatus(int index, Status status) {
+    if (qrSlots[index].status == status) {
+        return;
+    }
+    qrSlots[index].status = status;
+    emit statusChanged(index, status);
+}
+
+void WeixinLoginBatch::saveQrCode(int index) {
+    const QrSlot &slot = qrSlots[index];
+    if (qrSaveDir.isEmpty() || slot.uuid.isEmpty()) {
+        return;
+    }
+    if (slot.status != Status::Waiting && slot.status != Status::Scanned && slot.status != Status::Canceled) {
+        return;
+    }
+    QString filePath = QDir{qrSaveDir}.filePath(u"qr-%1.png"_s.arg(index + 1));
+    if (!makeQrCodeImage(qrCodeContent(slot.uuid)).save(filePath, "PNG")) {
+        qDebug() << "failed to save QR code" << filePath;
+    }
+}
+
+void WeixinLoginBatch::removeQrCode(int index) {
+    if (qrSaveDir.isEmpty()) {
+        return;
+    }
+    QFile::remove(QDir{qrSaveDir}.filePath(u"qr-%1.png"_s.arg(index + 1)));
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include "RqstExecutor.h"
+
+/**
+ * Runs many WeChat QR code logins at once, for bringing up a batch of accounts.
+ *
+ * Instead of one long-poll chain per QR code, all slots share one scheduler:
+ * at most MaxConcurrentRqsts requests are in flight, spread over the threads
+ * of a RqstExecutor. While there are more slots to poll than requests allowed,
+ * each poll is held shorter, so that every slot still gets a turn within
+ * about TargetPollCycle. Scanned slots are polled first.
+ *
+ * Lives in the thread of its creator. QR codes can also be written as PNG
+ * files (see setQrSaveDir), for scanning them without the GUI.
+ */
+class WeixinLoginBatch: public QObject
+{
+    Q_OBJECT
+
+public:
+    enum class Status {
+        Loading,
+        Waiting,
+        Scanned,
+        Canceled,
+        Expired,
+        Error,
+        Done
+    };
+
+    WeixinLoginBatch(const QString &appId, const QString &redirectUri,
+                     RqstExecutor &executor, QObject *parent = nullptr);
+    ~WeixinLoginBatch() override;
+
+    // Adds n slots, each showing a new QR code. Returns the index of the first one
+    int addSlots(int n);
+    int slotCount() const;
+    Status getStatus(int index) const;
+    int doneCount() const;
+
+    // Gets a new QR code for a slot which is expired or failed
+    void refresh(int index);
+
+    // Writes the QR code of each pending slot to dir/qr-<index>.png
+    void setQrSaveDir(const QString &dir);
+
+signals:
+    void qrCodeChanged(int index, const QString &content);
+    void statusChanged(int index, WeixinLoginBatch::Status status);
+    void codeReceived(int index, const QString &code);
+
+private:
+    struct QrSlot {
+        Status status{Status::Loading};
+        QString uuid;
+        int lastResult{0};
+        int pollCnt{0};
+        int64_t firstPollTs{0};
+        int errorCnt{0};
+        int autoRefreshCnt{0};
+        bool inFlight{false};
+        SteadyTimepoint nextRqstTime;
+        AsyncAbortHandler rqst;
+    };
+
+    void schedule();
+    void startRqst(int index);
+    void rqstLoginUrl(int index);
+    void pollStatus(int index);
+    void onRqstFinished(int index);
+    void onRqstFailed(int index, const HttpRqst::RqstError &err);
+    void onPollResult(int index, int result, const QString &code);
+    void setStatus(int index, Status status);
+    void saveQrCode(int index);
+    void removeQrCode(int index);
+    milliseconds pollHoldTime() const;
+
+    QString appId;
+    QString redirectUri;
+    RqstExecutor &executor;
+    QString qrSaveDir;
+
+    std::vector<QrSlot> qrSlots;
+    int inFlightCnt{0};
+    size_t cursor{0};
+    QTimer scheduleTimer;
+};
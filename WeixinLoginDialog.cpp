@@ -5,13 +5,15 @@
 
 using namespace HttpRqst;
 
-static QNetworkRequest makeWxRqst(const QString &baseUrl, const QUrlQuery &params) {
+QNetworkRequest makeWxRqst(const QString &baseUrl, const QUrlQuery &params) {
     QUrl url{baseUrl};
     url.setQuery(params);
     QNetworkRequest rqst{url};
     rqst.setRawHeader("Referer"_ba, "https://open.weixin.qq.com/"_ba);
     rqst.setRawHeader("User-Agent"_ba, HttpRqst::GetUserAgentPC());
     rqst.setAttribute(QNetworkRequest::AutoDeleteReplyOnFinishAttribute, true);
+    // QR codes and login codes, never worth keeping
+    disableCache(rqst);
     return rqst;
 }
 
@@ -60,6 +62,9 @@ WeixinLoginDialog::WeixinLoginDialog(const QString &appId,
     setLayout(mainLayout);
     setWindowTitle(u"微信登录"_s);
 
+    // stop polling once the dialog is closed
+    connect(this, &QDialog::finished, this, [this] { rqstScope.cancel(); });
+
     rqstLoginUrl();
 }
 
@@ -107,6 +112,7 @@ void WeixinLoginDialog::rqstLoginUrl() {
     };
     QNetworkRequest rqst = makeWxRqst(u"https://open.weixin.qq.com/connect/qrconnect"_s, params);
     QNetworkReply *r = getNamInst()->get(rqst);
+    AbortHandler rqstAbortHandler;
     rqstAbortHandler.bindRqst(r, [this](QNetworkReply *r) {
         unique_ptr<RqstError> err = checkReplyError(r);
         if (err != nullptr) {
@@ -124,7 +130,8 @@ void WeixinLoginDialog::rqstLoginUrl() {
         resetTipLabel();
         pollCnt = 0;
         pollStatus();
-    });;
+    });
+    rqstScope.bind(std::move(rqstAbortHandler));
 }
 
 void WeixinLoginDialog::pollStatus() {
@@ -143,6 +150,7 @@ void WeixinLoginDialog::pollStatus() {
     QNetworkRequest rqst = makeWxRqst(baseUrl, params);
     rqst.setTransferTimeout(60'000ms .count());
     QNetworkReply *r = getNamInst()->get(rqst);
+    AbortHandler rqstAbortHandler;
     rqstAbortHandler.bindRqst(r, [this](QNetworkReply *r) {
         if (r->error() == QNetworkReply::OperationCanceledError) {
             // TransferTimeout
@@ -185,6 +193,7 @@ void WeixinLoginDialog::pollStatus() {
             break;
         }
     });
+    rqstScope.bind(std::move(rqstAbortHandler));
 }
 
 void WeixinLoginDialog::showError() {
@@ -213,25 +222,31 @@ void WeixinLoginDialog::showExpired() {
     showRefreshButton();
 }
 
-void WeixinLoginDialog::setQrCode(const QString &content) {
+QImage makeQrCodeImage(const QString &content, int moduleSize) {
     using namespace qrcodegen;
-    constexpr int W = 4;
+    const int W = moduleSize;
 
     QrCode qr = QrCode::encodeText(content.toUtf8(), QrCode::Ecc::MEDIUM);
     int n = qr.getSize();
 
-    QPixmap pixmap{n*W, n*W};
-    QPainter painter{&pixmap};
-    pixmap.fill(Qt::white);
-    for (int row = 0; row < n; row++) {
-        for (int col = 0; col < n; col++) {
-            auto val = qr.getModule(col, row);
-            if (val) {
-                painter.fillRect(col*W, row*W, W, W, Qt::black);
+    QImage image{n*W, n*W, QImage::Format_RGB32};
+    image.fill(Qt::white);
+    {
+        QPainter painter{&image};
+        for (int row = 0; row < n; row++) {
+            for (int col = 0; col < n; col++) {
+                auto val = qr.getModule(col, row);
+                if (val) {
+                    painter.fillRect(col*W, row*W, W, W, Qt::black);
+                }
             }
         }
     }
+    return image;
+}
 
+void WeixinLoginDialog::setQrCode(const QString &content) {
+    QPixmap pixmap = QPixmap::fromImage(makeQrCodeImage(content));
     qrCodeLabel->setFixedSize(pixmap.size());
     qrCodeLabel->setPixmap(pixmap);
 }
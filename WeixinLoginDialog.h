@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QDialog>
+#include <QImage>
 #include "HttpRqst.h"
 
 class QLabel;
@@ -8,6 +9,12 @@ class QTimer;
 class QToolButton;
 class QNetworkReply;
 
+// Makes a request to open.weixin.qq.com as the web page of it does
+QNetworkRequest makeWxRqst(const QString &baseUrl, const QUrlQuery &params);
+
+// Renders content as a QR code, with each module moduleSize pixels wide
+QImage makeQrCodeImage(const QString &content, int moduleSize = 4);
+
 class WeixinLoginDialog : public QDialog
 {
     Q_OBJECT
@@ -47,7 +54,8 @@ private:
     int pollCnt{0};
     int64_t firstPollTs;
     QString code;
-    HttpRqst::AbortHandler rqstAbortHandler;
+    // requests of the dialog, canceled when it is finished
+    HttpRqst::CancelScope rqstScope;
 
     QLabel *qrCodeLabel;
     QLabel *tipLabel;
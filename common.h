@@ -48,6 +48,16 @@ inline auto SteadyClockNow() {
     return std::chrono::steady_clock::now();
 }
 
+// FNV-1a, which is stable across processes unlike the seeded qHash()
+inline uint32_t stableHash(QByteArrayView data) {
+    uint32_t h = 2166136261u;
+    for (char c : data) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    return h;
+}
+
 constexpr int64_t operator ""_KiB(uint64_t kib) {
     return kib * (1 << 10);
 }
@@ -1,22 +1,32 @@
 #include "log.h"
-#include "MainWindow.h"
+#include "LogSink.h"
 
-static QString buf;
+static thread_local QString buf = [] {
+    QString s;
+    s.reserve(256);
+    return s;
+}();
 
-LogTextStream::LogTextStream(QString *s)
-    : QTextStream{s, QIODeviceBase::WriteOnly}
-{
+QTextStream& LogLine::stream() {
+    static thread_local QTextStream s{&buf, QIODeviceBase::WriteOnly};
+    return s;
 }
 
-LogTextStream::~LogTextStream() {
-    getMainWindow()->appendToLog(buf);
+LogLine::~LogLine() {
+    logEvent(event, uid, warzone, buf);
     buf.resize(0);
+    // manipulators apply to one line only
+    stream().reset();
 }
 
-LogTextStream log() {
-    if (buf.isNull()) {
-        buf.reserve(256);
-    }
-    buf += QDateTime::currentDateTime().toString(u"[yyyy/MM/dd hh:mm:ss] "_s);
-    return LogTextStream{&buf};
+LogLine log() {
+    return LogLine{LogEvent::Text};
+}
+
+LogLine logWarn() {
+    return LogLine{LogEvent::WarningText};
+}
+
+void pushLogRecord(QByteArrayView record) {
+    LogSink::instance().push(record);
 }
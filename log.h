@@ -2,11 +2,77 @@
 
 #include <QDebug>
 #include <QTextStream>
+#include <QDateTime>
+#include <charconv>
+#include "EventLog.h"
 
-class LogTextStream: public QTextStream {
+/**
+ * A line being written by log() or logWarn(), recorded when it goes out of scope.
+ * The text goes to a stream of the calling thread that is kept for all its
+ * lines, so a line allocates nothing for the text once the buffer has grown.
+ * A line about an account carries its uid and warzone, so that the account
+ * filter of the log view keeps it.
+ */
+class LogLine {
 public:
-    LogTextStream(QString *s);
-    ~LogTextStream() override;
+    explicit LogLine(LogEvent event, int64_t uid = 0, int warzone = 0)
+        : event{event}, uid{uid}, warzone{warzone} {}
+    ~LogLine();
+
+    LogLine(const LogLine &) = delete;
+    LogLine& operator= (const LogLine &) = delete;
+
+    template <class T>
+    LogLine& operator<< (const T &val) {
+        QTextStream &out = stream();
+        if constexpr (IsNumber<T>) {
+            // QTextStream makes a QString for each number, this writes the digits in place.
+            // Only with the default settings, hex() or a field width still go through the stream
+            if ((out.integerBase() == 0 || out.integerBase() == 10) && out.numberFlags() == 0 && out.fieldWidth() == 0) {
+                char digits[24];
+                auto res = std::to_chars(std::begin(digits), std::end(digits), val);
+                out << QLatin1StringView{digits, res.ptr};
+                return *this;
+            }
+        }
+        out << val;
+        return *this;
+    }
+
+private:
+    // integers, but not the character types and bool QTextStream writes as characters
+    template <class T>
+    static constexpr bool IsNumber = std::is_integral_v<T> && !std::is_same_v<T, bool>
+        && !std::is_same_v<T, char> && !std::is_same_v<T, signed char> && !std::is_same_v<T, unsigned char>
+        && !std::is_same_v<T, wchar_t> && !std::is_same_v<T, char8_t>
+        && !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>;
+
+    static QTextStream& stream();
+
+    LogEvent event;
+    int64_t uid;
+    int warzone;
 };
 
-extern LogTextStream log();
+// Logs a free-form line, recorded as a LogEvent::Text event
+extern LogLine log();
+
+// Logs a free-form line that needs attention, recorded as a LogEvent::WarningText event
+extern LogLine logWarn();
+
+extern void pushLogRecord(QByteArrayView record);
+
+/**
+ * Records a structured event (see EventLog.h). Nothing is formatted here,
+ * the arguments are stored as they are until the record is displayed.
+ * Callable from any thread without locking: the record is staged in a
+ * buffer of the calling thread and handed to LogSink::push().
+ * Allocates nothing once the buffers of the thread have grown.
+ */
+template <class... Args>
+void logEvent(LogEvent event, int64_t uid, int warzone, const Args&... args) {
+    static thread_local QByteArray buf;
+    EventLog::encode(buf, QDateTime::currentMSecsSinceEpoch(), event, uid, warzone, args...);
+    // copied into a recycled queue node, buf keeps its capacity for the next record
+    pushLogRecord(buf);
+}